@@ -0,0 +1,84 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "cache/cache.hpp"
+#include "cache/gdfs_cache.hpp"
+#include "cache/sharded_cache.hpp"
+
+namespace {
+
+using PlanCache = opossum::Cache<std::shared_ptr<const std::string>, std::string>;
+
+constexpr auto CACHE_CAPACITY = size_t{1'024};
+
+// Number of distinct statements that are executed repeatedly. Together, they fit into the cache.
+constexpr auto REPEATED_QUERY_COUNT = size_t{768};
+
+// One out of AD_HOC_QUERY_RATIO statements is an ad-hoc query that is executed only once
+constexpr auto AD_HOC_QUERY_RATIO = 10;
+
+// Shared by all threads of a benchmark run
+std::unique_ptr<PlanCache> plan_cache;
+std::vector<std::string> repeated_queries;
+
+}  // namespace
+
+namespace opossum {
+
+// Models the accesses of concurrently running clients to the SQLPhysicalPlanCache: Each statement is looked up first
+// and, on a miss, the plan is inserted.
+template <typename CacheImpl>
+void BM_PlanCache_ConcurrentLookups(benchmark::State& state) {  // NOLINT
+  if (state.thread_index == 0) {
+    plan_cache = std::make_unique<PlanCache>(CACHE_CAPACITY);
+    plan_cache->template replace_cache_impl<CacheImpl>(CACHE_CAPACITY);
+
+    repeated_queries.clear();
+    for (auto query_id = size_t{0}; query_id < REPEATED_QUERY_COUNT; ++query_id) {
+      repeated_queries.emplace_back("SELECT * FROM customer WHERE c_custkey = " + std::to_string(query_id));
+      plan_cache->set(repeated_queries.back(), std::make_shared<const std::string>(repeated_queries.back()));
+    }
+  }
+
+  auto generator = std::mt19937{static_cast<std::mt19937::result_type>(state.thread_index)};
+  auto repeated_query_distribution = std::uniform_int_distribution<size_t>{0, REPEATED_QUERY_COUNT - 1};
+  auto ad_hoc_distribution = std::uniform_int_distribution<int>{0, AD_HOC_QUERY_RATIO - 1};
+
+  const auto ad_hoc_query_prefix = "SELECT * FROM orders WHERE o_comment LIKE '" + std::to_string(state.thread_index);
+  auto ad_hoc_query_id = size_t{0};
+  auto ad_hoc_query = std::string{};
+  auto hit_count = size_t{0};
+
+  for (auto _ : state) {
+    const auto is_ad_hoc_query = ad_hoc_distribution(generator) == 0;
+    if (is_ad_hoc_query) ad_hoc_query = ad_hoc_query_prefix + "_" + std::to_string(ad_hoc_query_id++) + "'";
+    const auto& query = is_ad_hoc_query ? ad_hoc_query : repeated_queries[repeated_query_distribution(generator)];
+
+    auto plan = plan_cache->try_get(query);
+    if (plan) {
+      ++hit_count;
+    } else {
+      plan_cache->set(query, std::make_shared<const std::string>(query));
+    }
+    benchmark::DoNotOptimize(plan);
+  }
+
+  state.counters["hit_ratio"] = benchmark::Counter(static_cast<double>(hit_count) / state.iterations(),
+                                                   benchmark::Counter::kAvgThreads);
+
+  if (state.thread_index == 0) {
+    plan_cache.reset();
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_PlanCache_ConcurrentLookups, GDFSCache<std::string, std::shared_ptr<const std::string>>)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PlanCache_ConcurrentLookups, ShardedCache<std::string, std::shared_ptr<const std::string>>)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+
+}  // namespace opossum
@@ -21,6 +21,11 @@ constexpr auto TABLE_SIZE_SMALL = size_t{1'000};
 constexpr auto TABLE_SIZE_MEDIUM = size_t{100'000};
 constexpr auto TABLE_SIZE_BIG = size_t{10'000'000};
 
+// With an exponent of 1.0, the most frequent of 10,000 keys makes up about 10% of the rows. 0.5 is a milder skew.
+constexpr auto ZIPF_DISTINCT_VALUES = 10'000;
+constexpr auto ZIPF_EXPONENT_STRONG = 1.0;
+constexpr auto ZIPF_EXPONENT_MILD = 0.5;
+
 void clear_cache() {
   std::vector<int> clear = std::vector<int>();
   clear.resize(500 * 1000 * 1000, 42);
@@ -33,10 +38,11 @@ void clear_cache() {
 
 namespace opossum {
 
-std::shared_ptr<TableWrapper> generate_table(const size_t number_of_rows) {
+std::shared_ptr<TableWrapper> generate_table(
+    const size_t number_of_rows,
+    const ColumnDataDistribution& config = ColumnDataDistribution::make_uniform_config(0.0, 10000)) {
   auto table_generator = std::make_shared<TableGenerator>();
 
-  ColumnDataDistribution config = ColumnDataDistribution::make_uniform_config(0.0, 10000);
   const auto chunk_size = static_cast<ChunkID::base_type>(number_of_rows / NUMBER_OF_CHUNKS);
   Assert(chunk_size > 0, "The chunk size is 0 or less, can not generate such a table");
 
@@ -98,6 +104,24 @@ void BM_Join_MediumAndMedium(benchmark::State& state) {  // NOLINT 100,000 x 100
   bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
 }
 
+template <class C>
+void BM_Join_SmallAndMediumZipfian(benchmark::State& state) {  // NOLINT 1,000 x 100,000
+  const auto config = ColumnDataDistribution::make_zipfian_config(ZIPF_DISTINCT_VALUES, ZIPF_EXPONENT_STRONG);
+  auto table_wrapper_left = generate_table(TABLE_SIZE_SMALL, config);
+  auto table_wrapper_right = generate_table(TABLE_SIZE_MEDIUM, config);
+
+  bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
+}
+
+template <class C>
+void BM_Join_MediumAndMediumZipfian(benchmark::State& state) {  // NOLINT 100,000 x 100,000
+  const auto config = ColumnDataDistribution::make_zipfian_config(ZIPF_DISTINCT_VALUES, ZIPF_EXPONENT_MILD);
+  auto table_wrapper_left = generate_table(TABLE_SIZE_MEDIUM, config);
+  auto table_wrapper_right = generate_table(TABLE_SIZE_MEDIUM, config);
+
+  bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
+}
+
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinNestedLoop);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinIndex);
@@ -107,10 +131,14 @@ BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinIndex);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinHash);
+BENCHMARK_TEMPLATE(BM_Join_SmallAndMediumZipfian, JoinHash);
+BENCHMARK_TEMPLATE(BM_Join_MediumAndMediumZipfian, JoinHash);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinSortMerge);
+BENCHMARK_TEMPLATE(BM_Join_SmallAndMediumZipfian, JoinSortMerge);
+BENCHMARK_TEMPLATE(BM_Join_MediumAndMediumZipfian, JoinSortMerge);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinMPSM);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinMPSM);
@@ -9,6 +9,9 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "table_generator.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -52,4 +55,25 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_Projection_ConstantTerm)(benchmark::S
   benchmark_projection_impl(state, _table_wrapper_a, {add_(a, 5)});
 }
 
+// Measures how the projection scales with the number of workers (given as the benchmark argument). The expression
+// is expensive enough per row that scheduling one job per chunk pays off.
+BENCHMARK_DEFINE_F(MicroBenchmarkBasicFixture, BM_Projection_CaseTerm_Workers)(benchmark::State& state) {
+  _clear_cache();
+
+  const auto worker_count = static_cast<uint32_t>(state.range(0));
+  Topology::use_non_numa_topology(worker_count);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // CASE WHEN "a" > "b" THEN "a" * "b" + 3 ELSE "b" / ("a" + 1) END
+  const auto a = PQPColumnExpression::from_table(*_table_wrapper_a->get_output(), "a");
+  const auto b = PQPColumnExpression::from_table(*_table_wrapper_a->get_output(), "b");
+
+  benchmark_projection_impl(state, _table_wrapper_a,
+                            {case_(greater_than_(a, b), add_(mul_(a, b), 3), div_(b, add_(a, 1))), add_(a, b)});
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+BENCHMARK_REGISTER_F(MicroBenchmarkBasicFixture, BM_Projection_CaseTerm_Workers)->RangeMultiplier(2)->Range(1, 16);
+
 }  // namespace opossum
@@ -5,6 +5,7 @@
 #include "expression/expression_functional.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "table_generator.hpp"
 #include "utils/load_table.hpp"
@@ -58,6 +59,61 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanVariable_OnDict)(benchmark::
   benchmark_tablescan_impl(state, _table_dict_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, ColumnID{1});
 }
 
+// The following benchmarks cover the scans that are evaluated directly on the compressed attribute vectors of
+// dictionary segments. The generated values lie between 0 and 10'000, which results in 2-byte wide value ids for
+// FixedSizeByteAligned.
+void benchmark_tablescan_on_attribute_vector(benchmark::State& state, const VectorCompressionType compression_type,
+                                             const PredicateCondition predicate_condition,
+                                             const AllParameterVariant right_parameter) {
+  micro_benchmark_clear_cache();
+
+  const auto table = TableGenerator{}.generate_table(ChunkID{100'000});
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary, compression_type});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  benchmark_tablescan_impl(state, table_wrapper, ColumnID{0}, predicate_condition, right_parameter);
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanConstant_OnDict_FixedSize_Equals)(benchmark::State& state) {
+  benchmark_tablescan_on_attribute_vector(state, VectorCompressionType::FixedSizeByteAligned,
+                                          PredicateCondition::Equals, 7);
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanConstant_OnDict_FixedSize_LessThan)(benchmark::State& state) {
+  benchmark_tablescan_on_attribute_vector(state, VectorCompressionType::FixedSizeByteAligned,
+                                          PredicateCondition::LessThan, 5'000);
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanConstant_OnDict_SimdBp128_Equals)(benchmark::State& state) {
+  benchmark_tablescan_on_attribute_vector(state, VectorCompressionType::SimdBp128, PredicateCondition::Equals, 7);
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanConstant_OnDict_SimdBp128_LessThan)(benchmark::State& state) {
+  benchmark_tablescan_on_attribute_vector(state, VectorCompressionType::SimdBp128, PredicateCondition::LessThan,
+                                          5'000);
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanBetween_OnDict_FixedSize)(benchmark::State& state) {
+  micro_benchmark_clear_cache();
+
+  const auto table = TableGenerator{}.generate_table(ChunkID{100'000});
+  ChunkEncoder::encode_all_chunks(
+      table, SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto column = pqp_column_(ColumnID{0}, DataType::Int, false, "");
+  const auto predicate = between_(column, value_(2'500), value_(7'500));
+
+  for (auto _ : state) {
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    table_scan->execute();
+  }
+}
+
 BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScan_Like)(benchmark::State& state) {
   const auto lineitem_table = load_table("resources/test_data/tbl/tpch/sf-0.001/lineitem.tbl");
 
@@ -0,0 +1,160 @@
+#include <arpa/inet.h>
+
+#include <boost/asio.hpp>
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "micro_benchmark_basic_fixture.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "server/io_service_pool.hpp"
+#include "server/server.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/assert.hpp"
+#include "utils/load_table.hpp"
+
+namespace {
+
+using boost::asio::ip::tcp;
+
+// Number of concurrent clients of the load generator and the number of connections each of them opens per iteration
+constexpr auto CLIENT_COUNT = size_t{64};
+constexpr auto CONNECTIONS_PER_CLIENT = size_t{16};
+
+void append_uint32(std::vector<char>& buffer, const uint32_t value) {
+  const auto network_value = htonl(value);
+  const auto chars = reinterpret_cast<const char*>(&network_value);
+  buffer.insert(buffer.end(), chars, chars + sizeof(network_value));
+}
+
+// Reads (and discards) messages until the server sends ReadyForQuery
+void receive_until_ready_for_query(tcp::socket& socket) {
+  while (true) {
+    auto header = std::array<char, 5>{};
+    boost::asio::read(socket, boost::asio::buffer(header));
+
+    auto length = uint32_t{};
+    std::memcpy(&length, header.data() + 1, sizeof(length));
+    auto body = std::vector<char>(ntohl(length) - sizeof(length));
+    boost::asio::read(socket, boost::asio::buffer(body));
+
+    Assert(header[0] != 'E', "Server returned an error");
+    if (header[0] == 'Z') return;
+  }
+}
+
+// A minimal PostgreSQL client: It connects, executes a single query using the simple query protocol, and disconnects.
+// This models the short-lived connections of an OLTP application without a connection pool.
+void run_short_lived_session(boost::asio::io_service& io_service, const uint16_t port, const std::string& query) {
+  tcp::socket socket{io_service};
+  socket.connect(tcp::endpoint(boost::asio::ip::address_v4::loopback(), port));
+  socket.set_option(tcp::no_delay(true));
+
+  // StartupMessage: length, protocol version 3.0, and the (ignored) parameters
+  const auto startup_parameters = std::string{"user\0benchmark\0\0", 16};
+  auto startup_message = std::vector<char>{};
+  append_uint32(startup_message, static_cast<uint32_t>(2 * sizeof(uint32_t) + startup_parameters.size()));
+  append_uint32(startup_message, 196608);
+  startup_message.insert(startup_message.end(), startup_parameters.begin(), startup_parameters.end());
+  boost::asio::write(socket, boost::asio::buffer(startup_message));
+  receive_until_ready_for_query(socket);
+
+  // Query: 'Q', length, null-terminated SQL string
+  auto query_message = std::vector<char>{'Q'};
+  append_uint32(query_message, static_cast<uint32_t>(sizeof(uint32_t) + query.size() + 1));
+  query_message.insert(query_message.end(), query.begin(), query.end());
+  query_message.push_back('\0');
+  boost::asio::write(socket, boost::asio::buffer(query_message));
+  receive_until_ready_for_query(socket);
+
+  // Terminate: 'X', length
+  auto terminate_message = std::vector<char>{'X'};
+  append_uint32(terminate_message, sizeof(uint32_t));
+  boost::asio::write(socket, boost::asio::buffer(terminate_message));
+}
+
+}  // namespace
+
+namespace opossum {
+
+class ServerBenchmarkFixture : public MicroBenchmarkBasicFixture {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    MicroBenchmarkBasicFixture::SetUp(state);
+
+    StorageManager::get().add_table("int_float", load_table("resources/test_data/tbl/int_float.tbl"));
+
+    Topology::use_default_topology();
+    CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+    // state.range(0) == 0 runs the server with a single io_service for all connections, as it used to be
+    const auto io_thread_count = static_cast<size_t>(state.range(0));
+    if (io_thread_count > 0) _io_service_pool = std::make_shared<IoServicePool>(io_thread_count);
+
+    // The io_service is stopped at the end of each run and must be restarted before it can run again
+    _accept_io_service.restart();
+    _server = std::make_unique<Server>(_accept_io_service, /* port = */ 0, _io_service_pool);
+    _port = _server->get_port_number();
+    _server_thread = std::thread([&]() { _accept_io_service.run(); });
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    _accept_io_service.stop();
+    _server_thread.join();
+    _server.reset();
+    if (_io_service_pool) _io_service_pool->stop();
+    _io_service_pool.reset();
+
+    CurrentScheduler::get()->finish();
+    CurrentScheduler::set(nullptr);
+    StorageManager::get().reset();
+
+    MicroBenchmarkBasicFixture::TearDown(state);
+  }
+
+ protected:
+  boost::asio::io_service _accept_io_service;
+  std::shared_ptr<IoServicePool> _io_service_pool;
+  std::unique_ptr<Server> _server;
+  std::thread _server_thread;
+  uint16_t _port{0};
+};
+
+BENCHMARK_DEFINE_F(ServerBenchmarkFixture, BM_Server_ConnectionStorm)(benchmark::State& state) {
+  const auto query = std::string{"SELECT a FROM int_float WHERE a = 123;"};
+
+  for (auto _ : state) {
+    auto clients = std::vector<std::thread>{};
+    clients.reserve(CLIENT_COUNT);
+    for (auto client_id = size_t{0}; client_id < CLIENT_COUNT; ++client_id) {
+      clients.emplace_back([&]() {
+        boost::asio::io_service io_service;
+        for (auto connection_id = size_t{0}; connection_id < CONNECTIONS_PER_CLIENT; ++connection_id) {
+          run_short_lived_session(io_service, _port, query);
+        }
+      });
+    }
+
+    for (auto& client : clients) {
+      client.join();
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * CLIENT_COUNT * CONNECTIONS_PER_CLIENT));
+}
+
+// The argument is the number of io threads in the pool, 0 means that a single io_service handles all connections
+BENCHMARK_REGISTER_F(ServerBenchmarkFixture, BM_Server_ConnectionStorm)
+    ->Arg(0)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime();
+
+}  // namespace opossum
@@ -1,6 +1,7 @@
 #include "table_generator.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
 #include <memory>
 #include <random>
@@ -165,6 +166,27 @@ std::shared_ptr<Table> TableGenerator::generate_table(
           };
           break;
         }
+        case DataDistributionType::Zipfian: {
+          auto cumulative_probabilities = std::vector<double>(column_data_distribution.num_different_values);
+          auto frequency_sum = 0.0;
+          for (auto value_id = size_t{0}; value_id < cumulative_probabilities.size(); ++value_id) {
+            frequency_sum += 1.0 / std::pow(static_cast<double>(value_id + 1), column_data_distribution.zipf_exponent);
+            cumulative_probabilities[value_id] = frequency_sum;
+          }
+          for (auto& cumulative_probability : cumulative_probabilities) {
+            cumulative_probability /= frequency_sum;
+          }
+
+          generate_value_by_distribution_type = [cumulative_probabilities, &probability_dist, &pseudorandom_engine]() {
+            const auto probability = probability_dist(pseudorandom_engine);
+            const auto value_it =
+                std::lower_bound(cumulative_probabilities.cbegin(), cumulative_probabilities.cend(), probability);
+            const auto value_id = std::min(std::distance(cumulative_probabilities.cbegin(), value_it),
+                                           static_cast<std::ptrdiff_t>(cumulative_probabilities.size()) - 1);
+            return static_cast<int>(value_id) + 1;
+          };
+          break;
+        }
       }
 
       // generate values according to distribution
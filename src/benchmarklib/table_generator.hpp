@@ -11,7 +11,7 @@ namespace opossum {
 
 class Table;
 
-enum class DataDistributionType { Uniform, NormalSkewed, Pareto };
+enum class DataDistributionType { Uniform, NormalSkewed, Pareto, Zipfian };
 
 struct ColumnDataDistribution {
   static ColumnDataDistribution make_uniform_config(double min, double max) {
@@ -40,6 +40,15 @@ struct ColumnDataDistribution {
     return c;
   }
 
+  // Generates the values 1 to num_different_values, where the frequency of a value v is proportional to 1 / v^exponent
+  static ColumnDataDistribution make_zipfian_config(int num_different_values = 1000, double zipf_exponent = 1.0) {
+    ColumnDataDistribution c{};
+    c.num_different_values = num_different_values;
+    c.zipf_exponent = zipf_exponent;
+    c.distribution_type = DataDistributionType::Zipfian;
+    return c;
+  }
+
   DataDistributionType distribution_type = DataDistributionType::Uniform;
 
   int num_different_values = 1000;
@@ -51,6 +60,8 @@ struct ColumnDataDistribution {
   double skew_scale = 1.0;
   double skew_shape = 0.0;
 
+  double zipf_exponent = 1.0;
+
   double min_value = 0.0;
   double max_value = 1.0;
 };
@@ -3,6 +3,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <string>
 
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
@@ -23,15 +24,38 @@ int main(int argc, char* argv[]) {
       port = static_cast<uint16_t>(port_long);
     }
 
+    // Number of threads that handle the network IO of the sessions. By default, one per NUMA node is used.
+    auto io_thread_count = size_t{0};
+    if (argc >= 3) {
+      char* endptr{nullptr};
+      errno = 0;
+      auto io_thread_count_long = std::strtol(argv[2], &endptr, 10);
+      Assert(errno == 0 && io_thread_count_long > 0 && *endptr == 0, "invalid number of io threads");
+      io_thread_count = static_cast<size_t>(io_thread_count_long);
+    }
+
+    // Replace the literals of simple queries by parameters so that queries differing only in their literals share a
+    // plan. This helps short-running (OLTP) workloads, but prevents value-specific optimizations such as chunk pruning.
+    auto parameterize_literals = opossum::ParameterizeLiterals::No;
+    if (argc >= 4) {
+      const auto argument = std::string{argv[3]};
+      Assert(argument == "0" || argument == "1", "invalid value for literal parameterization, expected 0 or 1");
+      if (argument == "1") parameterize_literals = opossum::ParameterizeLiterals::Yes;
+    }
+
     // Set scheduler so that the server can execute the tasks on separate threads.
     opossum::CurrentScheduler::set(std::make_shared<opossum::NodeQueueScheduler>());
 
     boost::asio::io_service io_service;
 
+    // The sessions are distributed over a pool of io_services, each run by a thread that is pinned to a CPU. The main
+    // io_service only accepts new connections.
+    auto io_service_pool = std::make_shared<opossum::IoServicePool>(io_thread_count);
+
     // The server registers itself to the boost io_service. The io_service is the main IO control unit here and it lives
     // until the server doesn't request any IO any more, i.e. is has terminated. The server requests IO in its
     // constructor and then runs forever.
-    opossum::Server server{io_service, port};
+    opossum::Server server{io_service, port, io_service_pool, parameterize_literals};
 
     io_service.run();
   } catch (std::exception& e) {
@@ -2,7 +2,9 @@
 
 #include <boost/iterator/iterator_facade.hpp>
 
+#include <optional>
 #include <utility>
+#include <vector>
 
 namespace opossum {
 
@@ -52,6 +54,15 @@ class AbstractCacheImpl {
   // Returns true if the cache holds an item at the given key.
   virtual bool has(const Key& key) const = 0;
 
+  // Returns a copy of the cached value at the given key or std::nullopt if there is none.
+  virtual std::optional<Value> try_get(const Key& key) {
+    if (!has(key)) return std::nullopt;
+    return get(key);
+  }
+
+  // Returns true if the implementation can be accessed concurrently without external synchronization.
+  virtual bool is_thread_safe() const { return false; }
+
   // Returns the number of elements currently held in the cache.
   virtual size_t size() const = 0;
 
@@ -64,6 +75,16 @@ class AbstractCacheImpl {
   virtual ErasedIterator begin() = 0;
   virtual ErasedIterator end() = 0;
 
+  // Returns a copy of all cached key-value pairs. Thread-safe implementations copy them consistently.
+  virtual std::vector<KeyValuePair> snapshot() {
+    auto key_value_pairs = std::vector<KeyValuePair>{};
+    const auto end_iter = end();
+    for (auto iter = begin(); iter != end_iter; ++iter) {
+      key_value_pairs.emplace_back(*iter);
+    }
+    return key_value_pairs;
+  }
+
   // Return the capacity of the cache.
   size_t capacity() const { return _capacity; }
 
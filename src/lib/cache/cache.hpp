@@ -9,20 +9,23 @@
 
 #include "gdfs_cache.hpp"
 
+#include "utils/assert.hpp"
 #include "utils/singleton.hpp"
 
 namespace opossum {
 
 inline constexpr size_t DefaultCacheCapacity = 1024;
 
-// Per-default, uses the GDFS cache as underlying storage.
-template <typename Value, typename Key = std::string>
-class Cache : public Singleton<Cache<Value, Key>> {
+// Per-default, uses the GDFS cache as underlying storage. Accesses are serialized using a single mutex, unless the
+// underlying cache is thread-safe itself (e.g., the ShardedCache).
+template <typename Value, typename Key = std::string,
+          template <typename, typename> typename DefaultCacheImpl = GDFSCache>
+class Cache : public Singleton<Cache<Value, Key, DefaultCacheImpl>> {
  public:
   using Iterator = typename AbstractCacheImpl<Key, Value>::ErasedIterator;
 
   explicit Cache(size_t capacity = DefaultCacheCapacity)
-      : _impl(std::move(std::make_unique<GDFSCache<Key, Value>>(capacity))) {}
+      : _impl(std::move(std::make_unique<DefaultCacheImpl<Key, Value>>(capacity))) {}
 
   virtual ~Cache() {}
 
@@ -30,7 +33,7 @@ class Cache : public Singleton<Cache<Value, Key>> {
   void set(const Key& query, const Value& value) {
     if (_impl->capacity() == 0) return;
 
-    std::lock_guard<std::mutex> lock(_mutex);
+    const auto lock = _lock();
     _impl->set(query, value);
   }
 
@@ -39,11 +42,8 @@ class Cache : public Singleton<Cache<Value, Key>> {
   std::optional<Value> try_get(const Key& query) {
     if (_impl->capacity() == 0) return {};
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (!_impl->has(query)) {
-      return {};
-    }
-    return _impl->get(query);
+    const auto lock = _lock();
+    return _impl->try_get(query);
   }
 
   // Checks whether an entry for the query exists.
@@ -51,9 +51,13 @@ class Cache : public Singleton<Cache<Value, Key>> {
 
   // Returns and refreshes the cache entry for the given query.
   // Causes undefined behavior if the query is not in the cache.
+  // The entry is copied by try_get(), i.e., while it is protected by the lock of the (shard of the) cache. The
+  // reference returned by AbstractCacheImpl::get() might be invalidated by concurrent evictions once that lock is
+  // released.
   Value get_entry(const Key& query) {
-    std::lock_guard<std::mutex> lock(_mutex);
-    return _impl->get(query);
+    auto value = try_get(query);
+    DebugAssert(value, "Query is not in the cache");
+    return std::move(*value);
   }
 
   // Purges all entries from the cache.
@@ -74,6 +78,12 @@ class Cache : public Singleton<Cache<Value, Key>> {
     _impl = std::make_unique<cache_t>(capacity);
   }
 
+  // Returns a copy of all entries. Different from iterating the cache, this can be done concurrently to other accesses.
+  std::vector<std::pair<Key, Value>> snapshot() {
+    const auto lock = _lock();
+    return _impl->snapshot();
+  }
+
   Iterator begin() { return _impl->begin(); }
 
   Iterator end() { return _impl->end(); }
@@ -83,6 +93,12 @@ class Cache : public Singleton<Cache<Value, Key>> {
   std::unique_ptr<AbstractCacheImpl<Key, Value>> _impl;
 
   std::mutex _mutex;
+
+  // Locks the mutex if the underlying cache is not thread-safe
+  std::unique_lock<std::mutex> _lock() {
+    if (_impl->is_thread_safe()) return {};
+    return std::unique_lock<std::mutex>{_mutex};
+  }
 };
 
 }  // namespace opossum
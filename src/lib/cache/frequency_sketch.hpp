@@ -0,0 +1,82 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace opossum {
+
+// Approximate access frequencies of keys, as used by the TinyLFU admission policy. The sketch is a count-min sketch
+// with four rows of counters that saturate at 15 (i.e., they would fit into four bits). After sample_size accesses,
+// all counters are halved, so that keys that were popular a long time ago lose their advantage ("aging").
+// Only the hash of a key is stored. Recording and estimating is thread-safe, clear() and resize() are not.
+class FrequencySketch {
+ public:
+  explicit FrequencySketch(const size_t capacity) { resize(capacity); }
+
+  // Records an access to the key with the given hash
+  void record(const size_t hash) {
+    for (auto row = size_t{0}; row < ROW_COUNT; ++row) {
+      auto& counter = _counters[_counter_index(hash, row)];
+      if (counter.load(std::memory_order_relaxed) < MAX_COUNT) counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (_access_count.fetch_add(1, std::memory_order_relaxed) + 1 == _sample_size) _age();
+  }
+
+  // Returns the estimated number of recent accesses to the key with the given hash
+  uint8_t estimate(const size_t hash) const {
+    auto frequency = MAX_COUNT;
+    for (auto row = size_t{0}; row < ROW_COUNT; ++row) {
+      frequency = std::min(frequency, _counters[_counter_index(hash, row)].load(std::memory_order_relaxed));
+    }
+    return frequency;
+  }
+
+  void clear() {
+    for (auto& counter : _counters) {
+      counter.store(0, std::memory_order_relaxed);
+    }
+    _access_count.store(0, std::memory_order_relaxed);
+  }
+
+  // Resets the sketch and sizes it for a cache of the given capacity
+  void resize(const size_t capacity) {
+    _row_width = 64;
+    while (_row_width < capacity) _row_width *= 2;
+    _sample_size = 10 * _row_width;
+
+    _counters = std::vector<std::atomic<uint8_t>>(ROW_COUNT * _row_width);
+    clear();
+  }
+
+ protected:
+  static constexpr auto ROW_COUNT = size_t{4};
+  static constexpr auto MAX_COUNT = uint8_t{15};
+
+  size_t _counter_index(const size_t hash, const size_t row) const {
+    // Each row uses a different multiplicative hash of the key's hash, so that keys that collide in one row are
+    // unlikely to collide in the others
+    static constexpr auto SEEDS = std::array<uint64_t, ROW_COUNT>{0x97CB3127A5D1E4F3ull, 0xC3A5C85C97CB3127ull,
+                                                                  0xB492B66FBE98F273ull, 0x9AE16A3B2F90404Full};
+    auto row_hash = (static_cast<uint64_t>(hash) + row) * SEEDS[row];
+    row_hash ^= row_hash >> 32;
+    return row * _row_width + (row_hash & (_row_width - 1));
+  }
+
+  void _age() {
+    for (auto& counter : _counters) {
+      counter.store(counter.load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
+    }
+    _access_count.store(0, std::memory_order_relaxed);
+  }
+
+  std::vector<std::atomic<uint8_t>> _counters;
+  size_t _row_width{0};
+  size_t _sample_size{0};
+  std::atomic<size_t> _access_count{0};
+};
+
+}  // namespace opossum
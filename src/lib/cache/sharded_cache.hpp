@@ -0,0 +1,323 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "abstract_cache_impl.hpp"
+#include "frequency_sketch.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Generic cache implementation for concurrent use. Different from the other implementations, it is thread-safe.
+//
+// The keys are distributed over up to MAX_SHARD_COUNT shards, each with its own reader-writer lock. Lookups only take
+// the shared lock of their shard and mark the entry as referenced using an atomic flag, so concurrent lookups do not
+// block each other. Within a shard, entries are evicted using the CLOCK policy, i.e., the first entry that was not
+// referenced since the clock hand last passed it is evicted.
+//
+// New keys are only admitted to a full shard if they were accessed more often than the entry that would be evicted for
+// them (TinyLFU). The access frequencies of all keys, including those that are not cached, are approximated using a
+// FrequencySketch. Thus, a one-off query does not evict a plan that is used repeatedly.
+//
+// The capacity is split evenly between the shards, so the cache may hold up to one entry per shard more than its
+// capacity. get() returns a reference to the cached value, which is invalidated if the entry is evicted concurrently.
+// Prefer try_get(), which returns a copy. Similarly, prefer snapshot() over iterating the cache.
+template <typename Key, typename Value>
+class ShardedCache : public AbstractCacheImpl<Key, Value> {
+ public:
+  using typename AbstractCacheImpl<Key, Value>::KeyValuePair;
+  using typename AbstractCacheImpl<Key, Value>::AbstractIterator;
+  using typename AbstractCacheImpl<Key, Value>::ErasedIterator;
+
+  // Smallest number of entries per shard and maximum number of shards. Small caches have only a single shard.
+  static constexpr auto MIN_SHARD_CAPACITY = size_t{32};
+  static constexpr auto MAX_SHARD_COUNT = size_t{16};
+
+  struct Statistics {
+    size_t hit_count{0};
+    size_t miss_count{0};
+    size_t eviction_count{0};
+    // Number of new keys that were not admitted because they were accessed less often than the eviction candidate
+    size_t rejection_count{0};
+  };
+
+ protected:
+  struct Entry {
+    Entry(const Key& init_key, const Value& init_value) : key(init_key), value(init_value) {}
+
+    Key key;
+    Value value;
+    std::atomic<bool> referenced{false};
+  };
+
+  // Aligned to separate cache lines, so that the locks and counters of different shards do not interfere
+  struct alignas(64) Shard {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<Key, size_t> entry_idx_by_key;
+    std::vector<std::unique_ptr<Entry>> entries;
+    size_t clock_hand{0};
+    size_t capacity{0};
+
+    std::atomic<size_t> hit_count{0};
+    std::atomic<size_t> miss_count{0};
+    std::atomic<size_t> eviction_count{0};
+    std::atomic<size_t> rejection_count{0};
+  };
+
+ public:
+  // Iterates over all shards. Like the iterators of the other implementations, this is not thread-safe.
+  class Iterator : public AbstractIterator {
+   public:
+    Iterator(std::vector<Shard>& shards, const size_t shard_idx) : _shards(shards), _shard_idx(shard_idx) {
+      _skip_exhausted_shards();
+    }
+
+   private:
+    friend class boost::iterator_core_access;
+    friend class AbstractCacheImpl<Key, Value>::ErasedIterator;
+
+    std::vector<Shard>& _shards;
+    size_t _shard_idx;
+    size_t _entry_idx{0};
+    mutable KeyValuePair _tmp_return_value;
+
+    void _skip_exhausted_shards() {
+      while (_shard_idx < _shards.size() && _entry_idx >= _shards[_shard_idx].entries.size()) {
+        ++_shard_idx;
+        _entry_idx = 0;
+      }
+    }
+
+    void increment() {
+      ++_entry_idx;
+      _skip_exhausted_shards();
+    }
+
+    bool equal(const AbstractIterator& other) const {
+      const auto& other_iterator = static_cast<const Iterator&>(other);
+      return _shard_idx == other_iterator._shard_idx && _entry_idx == other_iterator._entry_idx;
+    }
+
+    const KeyValuePair& dereference() const {
+      const auto& entry = *_shards[_shard_idx].entries[_entry_idx];
+      _tmp_return_value = {entry.key, entry.value};
+      return _tmp_return_value;
+    }
+  };
+
+  explicit ShardedCache(size_t capacity)
+      : AbstractCacheImpl<Key, Value>(capacity),
+        _shards(std::clamp(capacity / MIN_SHARD_CAPACITY, size_t{1}, MAX_SHARD_COUNT)),
+        _sketch(capacity) {
+    _set_shard_capacities();
+  }
+
+  void set(const Key& key, const Value& value, double cost = 1.0, double size = 1.0) {
+    const auto hash = _hash(key);
+    auto& shard = _shard(hash);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+    const auto entry_idx_iter = shard.entry_idx_by_key.find(key);
+    if (entry_idx_iter != shard.entry_idx_by_key.end()) {
+      shard.entries[entry_idx_iter->second]->value = value;
+      return;
+    }
+
+    if (shard.entries.size() < shard.capacity) {
+      shard.entry_idx_by_key.emplace(key, shard.entries.size());
+      shard.entries.emplace_back(std::make_unique<Entry>(key, value));
+      return;
+    }
+
+    if (shard.capacity == 0) return;
+
+    // TinyLFU admission: Only replace the eviction candidate if the new key is more popular
+    const auto victim_idx = _next_victim(shard);
+    auto& victim = shard.entries[victim_idx];
+    if (_sketch.estimate(hash) <= _sketch.estimate(_hash(victim->key))) {
+      shard.rejection_count.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+
+    shard.entry_idx_by_key.erase(victim->key);
+    victim = std::make_unique<Entry>(key, value);
+    shard.entry_idx_by_key.emplace(key, victim_idx);
+    shard.eviction_count.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  std::optional<Value> try_get(const Key& key) {
+    const auto hash = _hash(key);
+    auto& shard = _shard(hash);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+    // Misses are recorded as well, so that a key that is requested repeatedly is admitted eventually
+    _sketch.record(hash);
+
+    const auto entry_idx_iter = shard.entry_idx_by_key.find(key);
+    if (entry_idx_iter == shard.entry_idx_by_key.end()) {
+      shard.miss_count.fetch_add(1, std::memory_order_relaxed);
+      return std::nullopt;
+    }
+
+    auto& entry = *shard.entries[entry_idx_iter->second];
+    entry.referenced.store(true, std::memory_order_relaxed);
+    shard.hit_count.fetch_add(1, std::memory_order_relaxed);
+    return entry.value;
+  }
+
+  Value& get(const Key& key) {
+    const auto hash = _hash(key);
+    auto& shard = _shard(hash);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+    _sketch.record(hash);
+
+    const auto entry_idx_iter = shard.entry_idx_by_key.find(key);
+    DebugAssert(entry_idx_iter != shard.entry_idx_by_key.end(), "Key is not in the cache");
+
+    auto& entry = *shard.entries[entry_idx_iter->second];
+    entry.referenced.store(true, std::memory_order_relaxed);
+    shard.hit_count.fetch_add(1, std::memory_order_relaxed);
+    return entry.value;
+  }
+
+  bool has(const Key& key) const {
+    const auto& shard = _shard(_hash(key));
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.entry_idx_by_key.find(key) != shard.entry_idx_by_key.end();
+  }
+
+  size_t size() const {
+    auto size = size_t{0};
+    for (const auto& shard : _shards) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      size += shard.entries.size();
+    }
+    return size;
+  }
+
+  void clear() {
+    const auto locks = _lock_all_shards();
+    for (auto& shard : _shards) {
+      shard.entry_idx_by_key.clear();
+      shard.entries.clear();
+      shard.clock_hand = 0;
+    }
+    _sketch.clear();
+  }
+
+  void resize(size_t capacity) {
+    const auto locks = _lock_all_shards();
+    this->_capacity = capacity;
+    _set_shard_capacities();
+
+    for (auto& shard : _shards) {
+      while (shard.entries.size() > shard.capacity) {
+        _evict(shard);
+      }
+    }
+    _sketch.resize(capacity);
+  }
+
+  bool is_thread_safe() const { return true; }
+
+  // Sums up the counters of all shards. The counters are not reset by clear().
+  Statistics statistics() const {
+    auto statistics = Statistics{};
+    for (const auto& shard : _shards) {
+      statistics.hit_count += shard.hit_count.load(std::memory_order_relaxed);
+      statistics.miss_count += shard.miss_count.load(std::memory_order_relaxed);
+      statistics.eviction_count += shard.eviction_count.load(std::memory_order_relaxed);
+      statistics.rejection_count += shard.rejection_count.load(std::memory_order_relaxed);
+    }
+    return statistics;
+  }
+
+  std::vector<KeyValuePair> snapshot() {
+    auto key_value_pairs = std::vector<KeyValuePair>{};
+    for (const auto& shard : _shards) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      for (const auto& entry : shard.entries) {
+        key_value_pairs.emplace_back(entry->key, entry->value);
+      }
+    }
+    return key_value_pairs;
+  }
+
+  ErasedIterator begin() { return ErasedIterator{std::make_unique<Iterator>(_shards, 0)}; }
+
+  ErasedIterator end() { return ErasedIterator{std::make_unique<Iterator>(_shards, _shards.size())}; }
+
+ protected:
+  std::vector<Shard> _shards;
+  FrequencySketch _sketch;
+
+  size_t _hash(const Key& key) const { return std::hash<Key>{}(key); }
+
+  Shard& _shard(const size_t hash) { return _shards[_shard_idx(hash)]; }
+  const Shard& _shard(const size_t hash) const { return _shards[_shard_idx(hash)]; }
+
+  size_t _shard_idx(const size_t hash) const {
+    // std::hash is the identity for integers, so we mix the bits before distributing the keys
+    return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> 32) % _shards.size();
+  }
+
+  void _set_shard_capacities() {
+    for (auto& shard : _shards) {
+      shard.capacity = (this->_capacity + _shards.size() - 1) / _shards.size();
+    }
+  }
+
+  std::vector<std::unique_lock<std::shared_mutex>> _lock_all_shards() {
+    auto locks = std::vector<std::unique_lock<std::shared_mutex>>{};
+    locks.reserve(_shards.size());
+    for (auto& shard : _shards) {
+      locks.emplace_back(shard.mutex);
+    }
+    return locks;
+  }
+
+  // Advances the clock hand to the next entry that was not referenced since the hand last passed it. Clears the
+  // referenced flags of all entries it passes. The shard must not be empty.
+  static size_t _next_victim(Shard& shard) {
+    while (true) {
+      const auto entry_idx = shard.clock_hand;
+      shard.clock_hand = (shard.clock_hand + 1) % shard.entries.size();
+      if (!shard.entries[entry_idx]->referenced.exchange(false, std::memory_order_relaxed)) return entry_idx;
+    }
+  }
+
+  // Removes the next victim from the shard, keeping the entries contiguous. The shard must be locked exclusively.
+  void _evict(Shard& shard) {
+    const auto victim_idx = _next_victim(shard);
+    shard.entry_idx_by_key.erase(shard.entries[victim_idx]->key);
+
+    if (victim_idx + 1 != shard.entries.size()) {
+      shard.entries[victim_idx] = std::move(shard.entries.back());
+      shard.entry_idx_by_key[shard.entries[victim_idx]->key] = victim_idx;
+    }
+    shard.entries.pop_back();
+
+    if (shard.clock_hand >= shard.entries.size()) shard.clock_hand = 0;
+    shard.eviction_count.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void _evict() {
+    const auto locks = _lock_all_shards();
+    const auto shard_iter =
+        std::max_element(_shards.begin(), _shards.end(),
+                         [](const auto& lhs, const auto& rhs) { return lhs.entries.size() < rhs.entries.size(); });
+    if (!shard_iter->entries.empty()) _evict(*shard_iter);
+  }
+};
+
+}  // namespace opossum
@@ -12,7 +12,9 @@
 #include "expression/abstract_expression.hpp"
 #include "expression/aggregate_expression.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/index/segment_index_type.hpp"
 #include "storage/table.hpp"
+#include "storage/vector_compression/compressed_vector_type.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 #include "utils/make_bimap.hpp"
 
@@ -85,6 +87,8 @@ const boost::bimap<EncodingType, std::string> encoding_type_to_string = make_bim
     {EncodingType::FixedStringDictionary, "FixedStringDictionary"},
     {EncodingType::FrameOfReference, "FrameOfReference"},
     {EncodingType::LZ4, "LZ4"},
+    {EncodingType::Delta, "Delta"},
+    {EncodingType::DecimalScaled, "DecimalScaled"},
     {EncodingType::Unencoded, "Unencoded"},
 });
 
@@ -94,6 +98,23 @@ const boost::bimap<VectorCompressionType, std::string> vector_compression_type_t
         {VectorCompressionType::SimdBp128, "SIMD-BP128"},
     });
 
+const boost::bimap<CompressedVectorType, std::string> compressed_vector_type_to_string =
+    make_bimap<CompressedVectorType, std::string>({
+        {CompressedVectorType::FixedSize4ByteAligned, "FixedSize4ByteAligned"},
+        {CompressedVectorType::FixedSize2ByteAligned, "FixedSize2ByteAligned"},
+        {CompressedVectorType::FixedSize1ByteAligned, "FixedSize1ByteAligned"},
+        {CompressedVectorType::SimdBp128, "SimdBp128"},
+    });
+
+const boost::bimap<SegmentIndexType, std::string> segment_index_type_to_string =
+    make_bimap<SegmentIndexType, std::string>({
+        {SegmentIndexType::Invalid, "Invalid"},
+        {SegmentIndexType::GroupKey, "GroupKey"},
+        {SegmentIndexType::CompositeGroupKey, "CompositeGroupKey"},
+        {SegmentIndexType::AdaptiveRadixTree, "AdaptiveRadixTree"},
+        {SegmentIndexType::BTree, "BTree"},
+    });
+
 const boost::bimap<TableType, std::string> table_type_to_string =
     make_bimap<TableType, std::string>({{TableType::Data, "Data"}, {TableType::References, "References"}});
 
@@ -11,7 +11,9 @@
 
 namespace opossum {
 
+enum class CompressedVectorType : uint8_t;
 enum class EncodingType : uint8_t;
+enum class SegmentIndexType : uint8_t;
 enum class VectorCompressionType : uint8_t;
 enum class AggregateFunction;
 enum class ExpressionType;
@@ -28,6 +30,8 @@ extern const boost::bimap<FunctionType, std::string> function_type_to_string;
 extern const boost::bimap<DataType, std::string> data_type_to_string;
 extern const boost::bimap<EncodingType, std::string> encoding_type_to_string;
 extern const boost::bimap<VectorCompressionType, std::string> vector_compression_type_to_string;
+extern const boost::bimap<CompressedVectorType, std::string> compressed_vector_type_to_string;
+extern const boost::bimap<SegmentIndexType, std::string> segment_index_type_to_string;
 extern const boost::bimap<TableType, std::string> table_type_to_string;
 
 }  // namespace opossum
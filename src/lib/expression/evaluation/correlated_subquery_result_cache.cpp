@@ -0,0 +1,79 @@
+#include "correlated_subquery_result_cache.hpp"
+
+#include <mutex>
+
+#include "boost/functional/hash.hpp"
+
+#include "storage/table.hpp"
+
+namespace opossum {
+
+CorrelatedSubqueryResultCache::CorrelatedSubqueryResultCache(const size_t memory_budget)
+    : _memory_budget(memory_budget) {}
+
+std::shared_ptr<const Table> CorrelatedSubqueryResultCache::get(
+    const std::shared_ptr<AbstractOperator>& pqp, const std::vector<AllTypeVariant>& parameter_values) const {
+  auto lock = std::shared_lock{_mutex};
+
+  const auto iter = _results.find(Key{pqp, parameter_values});
+  if (iter == _results.end()) {
+    ++_miss_count;
+    return nullptr;
+  }
+
+  ++_hit_count;
+  return iter->second;
+}
+
+void CorrelatedSubqueryResultCache::set(const std::shared_ptr<AbstractOperator>& pqp,
+                                        const std::vector<AllTypeVariant>& parameter_values,
+                                        const std::shared_ptr<const Table>& result) {
+  // Estimating the memory usage walks over all segments of the result, so do it before taking the lock
+  const auto result_memory_usage = result->estimate_memory_usage();
+
+  auto lock = std::unique_lock{_mutex};
+
+  if (_memory_usage + result_memory_usage > _memory_budget) return;
+
+  // Another job might have computed the same result concurrently, in which case the first one wins
+  const auto inserted = _results.emplace(Key{pqp, parameter_values}, result).second;
+  if (inserted) _memory_usage += result_memory_usage;
+}
+
+size_t CorrelatedSubqueryResultCache::size() const {
+  auto lock = std::shared_lock{_mutex};
+  return _results.size();
+}
+
+size_t CorrelatedSubqueryResultCache::memory_usage() const {
+  auto lock = std::shared_lock{_mutex};
+  return _memory_usage;
+}
+
+size_t CorrelatedSubqueryResultCache::hit_count() const { return _hit_count; }
+
+size_t CorrelatedSubqueryResultCache::miss_count() const { return _miss_count; }
+
+size_t CorrelatedSubqueryResultCache::KeyHash::operator()(const Key& key) const {
+  auto hash = std::hash<std::shared_ptr<AbstractOperator>>{}(key.pqp);
+  for (const auto& parameter_value : key.parameter_values) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(parameter_value));
+  }
+  return hash;
+}
+
+bool CorrelatedSubqueryResultCache::KeyEqual::operator()(const Key& lhs, const Key& rhs) const {
+  if (lhs.pqp != rhs.pqp || lhs.parameter_values.size() != rhs.parameter_values.size()) return false;
+
+  for (auto parameter_idx = size_t{0}; parameter_idx < lhs.parameter_values.size(); ++parameter_idx) {
+    const auto& lhs_value = lhs.parameter_values[parameter_idx];
+    const auto& rhs_value = rhs.parameter_values[parameter_idx];
+
+    if (variant_is_null(lhs_value) != variant_is_null(rhs_value)) return false;
+    if (!variant_is_null(lhs_value) && !(lhs_value == rhs_value)) return false;
+  }
+
+  return true;
+}
+
+}  // namespace opossum
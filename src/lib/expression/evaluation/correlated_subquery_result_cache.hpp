@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <shared_mutex>  // NOLINT lint thinks this is a C header or something
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+/**
+ * Memoizes the results of correlated subqueries, keyed by the subquery's PQP and the values of its parameters.
+ *
+ * A correlated subquery is executed once for every row of the outer query. Often, many outer rows share the same
+ * parameter values (e.g., the same foreign key). For those, the result is taken from the cache instead of deep copying
+ * and executing the PQP again. One cache is created per execution of the operator that evaluates the expression and is
+ * shared by all of its chunks and jobs, so it is thread-safe.
+ *
+ * The cache is bounded by the estimated memory usage of the cached tables. Once the budget is used up, no further
+ * results are admitted. Results that are already cached remain valid for the rest of the operator's execution.
+ */
+class CorrelatedSubqueryResultCache final {
+ public:
+  static constexpr auto DEFAULT_MEMORY_BUDGET = size_t{64'000'000};
+
+  explicit CorrelatedSubqueryResultCache(const size_t memory_budget = DEFAULT_MEMORY_BUDGET);
+
+  // Returns nullptr if no result is cached for the parameter values
+  std::shared_ptr<const Table> get(const std::shared_ptr<AbstractOperator>& pqp,
+                                   const std::vector<AllTypeVariant>& parameter_values) const;
+
+  // Caches the result if it fits into the remaining memory budget
+  void set(const std::shared_ptr<AbstractOperator>& pqp, const std::vector<AllTypeVariant>& parameter_values,
+           const std::shared_ptr<const Table>& result);
+
+  size_t size() const;
+  size_t memory_usage() const;
+  size_t hit_count() const;
+  size_t miss_count() const;
+
+ private:
+  struct Key {
+    std::shared_ptr<AbstractOperator> pqp;
+    std::vector<AllTypeVariant> parameter_values;
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  // Unlike the SQL semantics of AllTypeVariant comparisons, two NULL parameters are considered equal
+  struct KeyEqual {
+    bool operator()(const Key& lhs, const Key& rhs) const;
+  };
+
+  const size_t _memory_budget;
+  size_t _memory_usage{0};
+
+  std::unordered_map<Key, std::shared_ptr<const Table>, KeyHash, KeyEqual> _results;
+  mutable std::shared_mutex _mutex;
+
+  mutable std::atomic<size_t> _hit_count{0};
+  mutable std::atomic<size_t> _miss_count{0};
+};
+
+}  // namespace opossum
@@ -7,6 +7,7 @@
 #include "boost/variant/apply_visitor.hpp"
 
 #include "all_parameter_variant.hpp"
+#include "correlated_subquery_result_cache.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/abstract_predicate_expression.hpp"
 #include "expression/arithmetic_expression.hpp"
@@ -133,11 +134,13 @@ namespace opossum {
 
 ExpressionEvaluator::ExpressionEvaluator(
     const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
-    const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results)
+    const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results,
+    const std::shared_ptr<CorrelatedSubqueryResultCache>& correlated_subquery_result_cache)
     : _table(table),
       _chunk(_table->get_chunk(chunk_id)),
       _chunk_id(chunk_id),
-      _uncorrelated_subquery_results(uncorrelated_subquery_results) {
+      _uncorrelated_subquery_results(uncorrelated_subquery_results),
+      _correlated_subquery_result_cache(correlated_subquery_result_cache) {
   _output_row_count = _chunk->size();
   _segment_materializations.resize(_chunk->column_count());
 }
@@ -594,6 +597,41 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_case_ex
   std::vector<Result> values;
   std::vector<bool> nulls;
 
+  // If all rows take the same branch, the other branch is not evaluated at all. This is not only faster, it also
+  // avoids executing, e.g., correlated subqueries in the branch that is never taken.
+  auto any_then = false;
+  auto any_otherwise = false;
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < when->size() && !(any_then && any_otherwise);
+       ++chunk_offset) {
+    if (when->value(chunk_offset) && !when->is_null(chunk_offset)) {
+      any_then = true;
+    } else {
+      any_otherwise = true;
+    }
+  }
+
+  if (any_then != any_otherwise) {
+    const auto& branch = any_then ? *case_expression.then() : *case_expression.otherwise();
+    _resolve_to_expression_result(branch, [&](const auto& branch_result) {
+      using BranchResultType = typename std::decay_t<decltype(branch_result)>::Type;
+
+      if constexpr (CaseEvaluator::supports_v<Result, BranchResultType, BranchResultType>) {
+        const auto result_size = _result_size(when->size(), branch_result.size());
+        values.resize(result_size);
+        nulls.resize(result_size);
+
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < result_size; ++chunk_offset) {
+          values[chunk_offset] = to_value<Result>(branch_result.value(chunk_offset));
+          nulls[chunk_offset] = branch_result.is_null(chunk_offset);
+        }
+      } else {
+        Fail("Illegal operands for CaseExpression");
+      }
+    });
+
+    return std::make_shared<ExpressionResult<Result>>(std::move(values), std::move(nulls));
+  }
+
   _resolve_to_expression_results(
       *case_expression.then(), *case_expression.otherwise(), [&](const auto& then_result, const auto& else_result) {
         using ThenResultType = typename std::decay_t<decltype(then_result)>::Type;
@@ -861,7 +899,7 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_subquer
 }
 
 std::vector<std::shared_ptr<const Table>> ExpressionEvaluator::_evaluate_subquery_expression_to_tables(
-    const PQPSubqueryExpression& expression) {
+    const PQPSubqueryExpression& expression, const PosList* selection) {
   // If the SubqueryExpression is uncorrelated, evaluating it once is sufficient
   if (expression.parameters.empty()) {
     if (_uncorrelated_subquery_results) {
@@ -883,9 +921,9 @@ std::vector<std::shared_ptr<const Table>> ExpressionEvaluator::_evaluate_subquer
 
   std::vector<std::shared_ptr<const Table>> results(_output_row_count);
 
-  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
+  _for_each_selected_chunk_offset(selection, [&](const auto chunk_offset) {
     results[chunk_offset] = _evaluate_subquery_expression_for_row(expression, chunk_offset);
-  }
+  });
 
   return results;
 }
@@ -917,6 +955,8 @@ std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_subquery_expression_
          "Sub-SELECT references external Columns but Expression doesn't operate on a Table/Chunk");
 
   std::unordered_map<ParameterID, AllTypeVariant> parameters;
+  std::vector<AllTypeVariant> parameter_values;
+  parameter_values.reserve(expression.parameters.size());
 
   for (auto parameter_idx = size_t{0}; parameter_idx < expression.parameters.size(); ++parameter_idx) {
     const auto& parameter_id_column_id = expression.parameters[parameter_idx];
@@ -926,6 +966,14 @@ std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_subquery_expression_
     const auto value = _segment_materializations[column_id]->value_as_variant(chunk_offset);
 
     parameters.emplace(parameter_id, value);
+    parameter_values.emplace_back(value);
+  }
+
+  // Rows with the same parameter values as a previous row (of this or any other chunk) reuse that row's result
+  const auto use_cache = _correlated_subquery_result_cache && !parameter_values.empty();
+  if (use_cache) {
+    auto cached_result = _correlated_subquery_result_cache->get(expression.pqp, parameter_values);
+    if (cached_result) return cached_result;
   }
 
   // TODO(moritz) deep_copy() shouldn't be necessary for every row if we could re-execute PQPs...
@@ -935,21 +983,37 @@ std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_subquery_expression_
   const auto tasks = OperatorTask::make_tasks_from_operator(row_pqp, CleanupTemporaries::Yes);
   CurrentScheduler::schedule_and_wait_for_tasks(tasks);
 
-  return row_pqp->get_output();
+  const auto result = row_pqp->get_output();
+  if (use_cache) _correlated_subquery_result_cache->set(expression.pqp, parameter_values, result);
+
+  return result;
 }
 
 std::shared_ptr<BaseValueSegment> ExpressionEvaluator::evaluate_expression_to_segment(
     const AbstractExpression& expression) {
+  Assert(expression.data_type() != DataType::Null, "Can't create a Segment from a NULL");
+
   std::shared_ptr<BaseValueSegment> segment;
-  std::vector<bool> nulls;
 
-  _resolve_to_expression_result_view(expression, [&](const auto& view) {
-    using ColumnDataType = typename std::decay_t<decltype(view)>::Type;
+  resolve_data_type(expression.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
 
-    // clang-format off
-    if constexpr (std::is_same_v<ColumnDataType, NullValue>) {
-      Fail("Can't create a Segment from a NULL");
-    } else {
+    const auto result = evaluate_expression_to_result<ColumnDataType>(expression);
+
+    // If nobody else holds the result (as opposed to, e.g., the cached materialization of a column), its buffers are
+    // handed over to the segment instead of being copied value by value.
+    const auto result_is_series = result->size() == _output_row_count &&
+                                  (!result->is_nullable() || result->nulls.size() == _output_row_count);
+    if (result.use_count() == 1 && result_is_series) {
+      if (result->is_nullable()) {
+        segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(result->values), std::move(result->nulls));
+      } else {
+        segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(result->values));
+      }
+      return;
+    }
+
+    result->as_view([&](const auto& view) {
       std::vector<ColumnDataType> values(_output_row_count);
 
       for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
@@ -957,7 +1021,7 @@ std::shared_ptr<BaseValueSegment> ExpressionEvaluator::evaluate_expression_to_se
       }
 
       if (view.is_nullable()) {
-        nulls.resize(_output_row_count);
+        std::vector<bool> nulls(_output_row_count);
         for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
           nulls[chunk_offset] = view.is_null(chunk_offset);
         }
@@ -965,14 +1029,32 @@ std::shared_ptr<BaseValueSegment> ExpressionEvaluator::evaluate_expression_to_se
       } else {
         segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
       }
-    }
-    // clang-format on
+    });
   });
 
   return segment;
 }
 
 PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpression& expression) {
+  return _evaluate_expression_to_pos_list(expression, nullptr);
+}
+
+template <typename Functor>
+void ExpressionEvaluator::_for_each_selected_chunk_offset(const PosList* selection, const Functor& fn) const {
+  if (selection) {
+    for (const auto& row_id : *selection) {
+      DebugAssert(row_id.chunk_id == _chunk_id, "Selection must only reference the evaluated Chunk");
+      fn(row_id.chunk_offset);
+    }
+  } else {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
+      fn(chunk_offset);
+    }
+  }
+}
+
+PosList ExpressionEvaluator::_evaluate_expression_to_pos_list(const AbstractExpression& expression,
+                                                              const PosList* selection) {
   /**
    * Only Expressions returning a Bool can be evaluated to a PosList of matches.
    *
@@ -981,6 +1063,8 @@ PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpre
    * TODO(anybody) Add fast implementations for (Not)In and (Not)Like as well.
    *
    * All other Expression types have dedicated, hopefully fast implementations.
+   *
+   * Only the rows in `selection` are checked. Since the selection is sorted, so is the result.
    */
 
   auto result_pos_list = PosList{};
@@ -1016,14 +1100,14 @@ PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpre
 
               if constexpr (ExpressionFunctorType::template supports<ExpressionEvaluator::Bool, LeftDataType,
                                                                      RightDataType>::value) {
-                for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
-                  if (left_result.is_null(chunk_offset) || right_result.is_null(chunk_offset)) continue;
+                _for_each_selected_chunk_offset(selection, [&](const auto chunk_offset) {
+                  if (left_result.is_null(chunk_offset) || right_result.is_null(chunk_offset)) return;
 
                   auto matches = ExpressionEvaluator::Bool{0};
                   ExpressionFunctorType{}(matches, left_result.value(chunk_offset),  // NOLINT
                                           right_result.value(chunk_offset));
                   if (matches != 0) result_pos_list.emplace_back(_chunk_id, chunk_offset);
-                }
+                });
               } else {
                 Fail("Argument types not compatible");
               }
@@ -1032,7 +1116,7 @@ PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpre
         } break;
 
         case PredicateCondition::Between:
-          return evaluate_expression_to_pos_list(*rewrite_between_expression(expression));
+          return _evaluate_expression_to_pos_list(*rewrite_between_expression(expression), selection);
 
         case PredicateCondition::IsNull:
         case PredicateCondition::IsNotNull: {
@@ -1040,13 +1124,13 @@ PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpre
 
           _resolve_to_expression_result_view(*is_null_expression.operand(), [&](const auto& result) {
             if (is_null_expression.predicate_condition == PredicateCondition::IsNull) {
-              for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
+              _for_each_selected_chunk_offset(selection, [&](const auto chunk_offset) {
                 if (result.is_null(chunk_offset)) result_pos_list.emplace_back(_chunk_id, chunk_offset);
-              }
+              });
             } else {  // PredicateCondition::IsNotNull
-              for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
+              _for_each_selected_chunk_offset(selection, [&](const auto chunk_offset) {
                 if (!result.is_null(chunk_offset)) result_pos_list.emplace_back(_chunk_id, chunk_offset);
-              }
+              });
             }
           });
         } break;
@@ -1063,11 +1147,11 @@ PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpre
           // b) Like/In are on the slower end anyway
           const auto result = evaluate_expression_to_result<ExpressionEvaluator::Bool>(expression);
           result->as_view([&](const auto& result_view) {
-            for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
+            _for_each_selected_chunk_offset(selection, [&](const auto chunk_offset) {
               if (result_view.value(chunk_offset) != 0 && !result_view.is_null(chunk_offset)) {
                 result_pos_list.emplace_back(_chunk_id, chunk_offset);
               }
-            }
+            });
           });
         } break;
       }
@@ -1076,19 +1160,39 @@ PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpre
     case ExpressionType::Logical: {
       const auto& logical_expression = static_cast<const LogicalExpression&>(expression);
 
-      const auto left_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[0]);
-      const auto right_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[1]);
+      auto left_pos_list = _evaluate_expression_to_pos_list(*logical_expression.arguments[0], selection);
 
       switch (logical_expression.logical_operator) {
         case LogicalOperator::And:
-          std::set_intersection(left_pos_list.begin(), left_pos_list.end(), right_pos_list.begin(),
-                                right_pos_list.end(), std::back_inserter(result_pos_list));
-          break;
-
-        case LogicalOperator::Or:
-          std::set_union(left_pos_list.begin(), left_pos_list.end(), right_pos_list.begin(), right_pos_list.end(),
-                         std::back_inserter(result_pos_list));
-          break;
+          // Rows that did not pass the left side cannot pass the conjunction, so the right side only needs to look at
+          // the rows in left_pos_list.
+          if (left_pos_list.empty()) return left_pos_list;
+          return _evaluate_expression_to_pos_list(*logical_expression.arguments[1], &left_pos_list);
+
+        case LogicalOperator::Or: {
+          // Rows that passed the left side pass the disjunction, so the right side only needs to look at the rest.
+          const auto selected_row_count = selection ? selection->size() : size_t{_output_row_count};
+          if (left_pos_list.size() == selected_row_count) return left_pos_list;
+
+          auto remaining_pos_list = PosList{};
+          remaining_pos_list.reserve(selected_row_count - left_pos_list.size());
+          auto left_iter = left_pos_list.cbegin();
+          _for_each_selected_chunk_offset(selection, [&](const auto chunk_offset) {
+            if (left_iter != left_pos_list.cend() && left_iter->chunk_offset == chunk_offset) {
+              ++left_iter;
+            } else {
+              remaining_pos_list.emplace_back(_chunk_id, chunk_offset);
+            }
+          });
+
+          const auto right_pos_list =
+              _evaluate_expression_to_pos_list(*logical_expression.arguments[1], &remaining_pos_list);
+
+          // Both sides are sorted and disjoint
+          result_pos_list.resize(left_pos_list.size() + right_pos_list.size());
+          std::merge(left_pos_list.cbegin(), left_pos_list.cend(), right_pos_list.cbegin(), right_pos_list.cend(),
+                     result_pos_list.begin());
+        } break;
       }
     } break;
 
@@ -1099,18 +1203,18 @@ PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpre
 
       const auto invert = exists_expression.exists_expression_type == ExistsExpressionType::NotExists;
 
-      const auto subquery_result_tables = _evaluate_subquery_expression_to_tables(*subquery_expression);
+      // Correlated subqueries are only executed for the selected rows
+      const auto subquery_result_tables = _evaluate_subquery_expression_to_tables(*subquery_expression, selection);
       if (subquery_expression->is_correlated()) {
-        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
+        _for_each_selected_chunk_offset(selection, [&](const auto chunk_offset) {
           if ((subquery_result_tables[chunk_offset]->row_count() > 0) ^ invert) {
             result_pos_list.emplace_back(_chunk_id, chunk_offset);
           }
-        }
+        });
       } else {
         if ((subquery_result_tables.front()->row_count() > 0) ^ invert) {
-          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
-            result_pos_list.emplace_back(_chunk_id, chunk_offset);
-          }
+          _for_each_selected_chunk_offset(
+              selection, [&](const auto chunk_offset) { result_pos_list.emplace_back(_chunk_id, chunk_offset); });
         }
       }
     } break;
@@ -1120,8 +1224,10 @@ PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpre
       const auto& value_expression = static_cast<const ValueExpression&>(expression);
       Assert(value_expression.value.type() == typeid(ExpressionEvaluator::Bool),
              "Cannot evaluate non-boolean literal to PosList");
-      // TRUE literal returns the entire Chunk, FALSE literal returns empty PosList
+      // TRUE literal returns the entire selection, FALSE literal returns empty PosList
       if (boost::get<ExpressionEvaluator::Bool>(value_expression.value) != 0) {
+        if (selection) return PosList{selection->cbegin(), selection->cend()};
+
         result_pos_list.resize(_output_row_count);
         for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
           result_pos_list[chunk_offset] = {_chunk_id, chunk_offset};
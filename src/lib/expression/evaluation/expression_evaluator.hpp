@@ -22,6 +22,7 @@ class BinaryPredicateExpression;
 class CaseExpression;
 class CastExpression;
 class Chunk;
+class CorrelatedSubqueryResultCache;
 class ExistsExpression;
 class ExtractExpression;
 class FunctionExpression;
@@ -36,7 +37,9 @@ class PQPColumnExpression;
  *                                         single row if no input chunk is specified
  *      - evaluate_expression_to_segment(): wraps evaluate_expression_to_result() into a Segment.
  *      - evaluate_expression_to_pos_list(): Only for Expressions returning Bools; a PosList of the Rows where the
- *                                           Expression is True. Useful for, e.g., scans with complex predicates
+ *                                           Expression is True. Useful for, e.g., scans with complex predicates.
+ *                                           Conjunctions and disjunctions are evaluated with selection vectors, i.e.,
+ *                                           the second operand only looks at rows whose result is still open.
  *
  * Operates either
  *      - ...on a Chunk, thus returning a value for each row in it
@@ -62,9 +65,12 @@ class ExpressionEvaluator final {
    * For Expressions that reference segments from a single table
    * @param uncorrelated_subquery_results  Results from pre-computed uncorrelated selects, so they do not need to be
    *                                     evaluated for every chunk. Solely for performance.
+   * @param correlated_subquery_result_cache  Memoizes results of correlated subqueries by their parameter values.
+   *                                     Should be shared by the evaluators of all chunks. Solely for performance.
    */
   ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
-                      const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results = {});
+                      const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results = {},
+                      const std::shared_ptr<CorrelatedSubqueryResultCache>& correlated_subquery_result_cache = {});
 
   std::shared_ptr<BaseValueSegment> evaluate_expression_to_segment(const AbstractExpression& expression);
   PosList evaluate_expression_to_pos_list(const AbstractExpression& expression);
@@ -77,6 +83,17 @@ class ExpressionEvaluator final {
       const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
 
  private:
+  /**
+   * Evaluates @param expression to a PosList, but only considers the rows in @param selection (all rows of the Chunk if
+   * it is nullptr). @param selection has to be sorted and only reference _chunk_id. This is used to, e.g., evaluate the
+   * right side of an AND only for the rows that passed the left side.
+   */
+  PosList _evaluate_expression_to_pos_list(const AbstractExpression& expression, const PosList* selection);
+
+  // Calls @param fn for each ChunkOffset in @param selection, or for each row of the Chunk if selection is nullptr
+  template <typename Functor>
+  void _for_each_selected_chunk_offset(const PosList* selection, const Functor& fn) const;
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_arithmetic_expression(const ArithmeticExpression& expression);
 
@@ -104,8 +121,10 @@ class ExpressionEvaluator final {
   std::shared_ptr<ExpressionResult<Result>> _evaluate_subquery_expression(
       const PQPSubqueryExpression& subquery_expression);
 
+  // If a @param selection is given for a correlated subquery, it is only executed for the selected rows. The tables of
+  // all other rows are left as nullptr.
   std::vector<std::shared_ptr<const Table>> _evaluate_subquery_expression_to_tables(
-      const PQPSubqueryExpression& expression);
+      const PQPSubqueryExpression& expression, const PosList* selection = nullptr);
 
   std::shared_ptr<const Table> _evaluate_subquery_expression_for_row(const PQPSubqueryExpression& expression,
                                                                      const ChunkOffset chunk_offset);
@@ -198,6 +217,7 @@ class ExpressionEvaluator final {
   std::vector<std::shared_ptr<BaseExpressionResult>> _segment_materializations;
 
   const std::shared_ptr<const UncorrelatedSubqueryResults> _uncorrelated_subquery_results;
+  const std::shared_ptr<CorrelatedSubqueryResultCache> _correlated_subquery_result_cache;
 };
 
 }  // namespace opossum
@@ -25,6 +25,7 @@ enum class LQPNodeType {
   Insert,
   Join,
   Limit,
+  MetaTable,
   Predicate,
   Projection,
   Root,
@@ -1,5 +1,6 @@
 #include "lqp_translator.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -30,9 +31,11 @@
 #include "insert_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "meta_table_node.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/delete.hpp"
+#include "operators/get_meta_table.hpp"
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
@@ -94,6 +97,10 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
   }
 
   const auto pqp = _translate_by_node_type(node->type, node);
+
+  // Some translations return the operator of an input node, which keeps referring to that input node
+  if (!pqp->lqp_node) pqp->lqp_node = node;
+
   _operator_by_lqp_node.emplace(node, pqp);
   return pqp;
 }
@@ -104,6 +111,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     // clang-format off
     case LQPNodeType::Alias:              return _translate_alias_node(node);
     case LQPNodeType::StoredTable:        return _translate_stored_table_node(node);
+    case LQPNodeType::MetaTable:          return _translate_meta_table_node(node);
     case LQPNodeType::Predicate:          return _translate_predicate_node(node);
     case LQPNodeType::Projection:         return _translate_projection_node(node);
     case LQPNodeType::Sort:               return _translate_sort_node(node);
@@ -137,6 +145,10 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
   const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node);
   const auto get_table = std::make_shared<GetTable>(stored_table_node->table_name);
   get_table->set_excluded_chunk_ids(stored_table_node->excluded_chunk_ids());
+  get_table->set_excluded_chunk_statistics_versions(stored_table_node->excluded_chunk_statistics_versions());
+  if (stored_table_node->parameter_pruning_predicates()) {
+    get_table->set_parameter_pruning_predicates(*stored_table_node->parameter_pruning_predicates());
+  }
   return get_table;
 }
 
@@ -312,8 +324,18 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
 
   if (primary_join_predicate.predicate_condition == PredicateCondition::Equals &&
       join_node->join_mode != JoinMode::FullOuter) {
+    // Aggregates and sorts materialize all columns of the join result, which is cheaper if the accesses to each input
+    // chunk are batched
+    const auto outputs = node->outputs();
+    const auto output_is_materialized = std::any_of(outputs.cbegin(), outputs.cend(), [](const auto& output) {
+      return output->type == LQPNodeType::Aggregate || output->type == LQPNodeType::Sort;
+    });
+    const auto output_order =
+        output_is_materialized ? JoinHash::OutputOrder::GroupedByChunk : JoinHash::OutputOrder::Partitioned;
+
     return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode,
-                                      primary_join_predicate, std::nullopt, std::move(secondary_join_predicates));
+                                      primary_join_predicate, std::nullopt, std::move(secondary_join_predicates),
+                                      output_order);
   } else {
     return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode,
                                            primary_join_predicate, std::move(secondary_join_predicates));
@@ -419,6 +441,13 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
   return std::make_shared<Validate>(input_operator);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_meta_table_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  DebugAssert(!node->left_input(), "MetaTable should not have an input operator.");
+  const auto meta_table_node = std::dynamic_pointer_cast<MetaTableNode>(node);
+  return std::make_shared<GetMetaTable>(meta_table_node->table_name);
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_show_tables_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   DebugAssert(!node->left_input(), "ShowTables should not have an input operator.");
@@ -180,6 +180,37 @@ bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp) {
   return lqp_is_validated(lqp->left_input()) && lqp_is_validated(lqp->right_input());
 }
 
+bool lqp_has_statistics(const std::shared_ptr<AbstractLQPNode>& node,
+                        std::unordered_map<std::shared_ptr<AbstractLQPNode>, bool>& has_statistics_by_node) {
+  const auto has_statistics_iter = has_statistics_by_node.find(node);
+  if (has_statistics_iter != has_statistics_by_node.end()) return has_statistics_iter->second;
+
+  auto has_statistics = false;
+  switch (node->type) {
+    case LQPNodeType::StoredTable:
+    case LQPNodeType::Mock:
+    case LQPNodeType::MetaTable:
+      has_statistics = true;
+      break;
+
+    case LQPNodeType::Union:
+      has_statistics = false;
+      break;
+
+    case LQPNodeType::Join:
+      has_statistics = lqp_has_statistics(node->left_input(), has_statistics_by_node) &&
+                       lqp_has_statistics(node->right_input(), has_statistics_by_node);
+      break;
+
+    default:
+      has_statistics = node->left_input() && !node->right_input() &&
+                       lqp_has_statistics(node->left_input(), has_statistics_by_node);
+  }
+
+  has_statistics_by_node.emplace(node, has_statistics);
+  return has_statistics;
+}
+
 std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQPNode>& lqp) {
   std::set<std::string> modified_tables;
 
@@ -214,6 +245,7 @@ std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQP
       case LQPNodeType::DummyTable:
       case LQPNodeType::Join:
       case LQPNodeType::Limit:
+      case LQPNodeType::MetaTable:
       case LQPNodeType::Predicate:
       case LQPNodeType::Projection:
       case LQPNodeType::Root:
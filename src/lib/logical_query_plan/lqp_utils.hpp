@@ -4,6 +4,7 @@
 #include <optional>
 #include <queue>
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "logical_query_plan/abstract_lqp_node.hpp"
@@ -50,6 +51,13 @@ void lqp_insert_node(const std::shared_ptr<AbstractLQPNode>& parent_node, const
  */
 bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp);
 
+/**
+ * @return whether statistics can be derived for @param node. Not all LQP nodes support this (e.g., UnionNodes or nodes
+ *         without a StoredTableNode below). @param has_statistics_by_node caches the results for the nodes below.
+ */
+bool lqp_has_statistics(const std::shared_ptr<AbstractLQPNode>& node,
+                        std::unordered_map<std::shared_ptr<AbstractLQPNode>, bool>& has_statistics_by_node);
+
 /**
  * @return all names of tables that have been accessed in modifying nodes (e.g., InsertNode, UpdateNode)
  */
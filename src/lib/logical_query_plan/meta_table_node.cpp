@@ -0,0 +1,58 @@
+#include "meta_table_node.hpp"
+
+#include <memory>
+#include <string>
+
+#include "expression/expression_functional.hpp"
+#include "statistics/generate_table_statistics.hpp"
+#include "storage/table.hpp"
+#include "utils/meta_table_manager.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+MetaTableNode::MetaTableNode(const std::string& table_name)
+    : AbstractLQPNode(LQPNodeType::MetaTable), table_name(table_name) {}
+
+std::string MetaTableNode::description() const { return "[MetaTable] Name: '" + table_name + "'"; }
+
+const std::vector<std::shared_ptr<AbstractExpression>>& MetaTableNode::column_expressions() const {
+  if (!_column_expressions) {
+    const auto column_count = MetaTableManager::get().column_definitions(table_name).size();
+
+    _column_expressions.emplace();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      _column_expressions->emplace_back(lqp_column_(LQPColumnReference{shared_from_this(), column_id}));
+    }
+  }
+
+  return *_column_expressions;
+}
+
+bool MetaTableNode::is_column_nullable(const ColumnID column_id) const {
+  return MetaTableManager::get().column_definitions(table_name).at(column_id).nullable;
+}
+
+std::shared_ptr<TableStatistics> MetaTableNode::derive_statistics_from(
+    const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
+  DebugAssert(!left_input && !right_input, "MetaTableNode must be leaf");
+  if (!_table_statistics) {
+    const auto table = MetaTableManager::get().generate_table(table_name);
+    _table_statistics = std::make_shared<TableStatistics>(generate_table_statistics(*table));
+  }
+  return _table_statistics;
+}
+
+std::shared_ptr<AbstractLQPNode> MetaTableNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
+  const auto copy = MetaTableNode::make(table_name);
+  copy->_table_statistics = _table_statistics;
+  return copy;
+}
+
+bool MetaTableNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
+  const auto& meta_table_node_rhs = static_cast<const MetaTableNode&>(rhs);
+  return table_name == meta_table_node_rhs.table_name;
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_lqp_node.hpp"
+
+namespace opossum {
+
+/**
+ * This node type represents a meta table (see MetaTableManager), which is generated when the plan is executed.
+ */
+class MetaTableNode : public EnableMakeForLQPNode<MetaTableNode>, public AbstractLQPNode {
+ public:
+  explicit MetaTableNode(const std::string& table_name);
+
+  std::string description() const override;
+
+  const std::vector<std::shared_ptr<AbstractExpression>>& column_expressions() const override;
+  bool is_column_nullable(const ColumnID column_id) const override;
+
+  // Meta tables are small, so their statistics are generated from the state of the table when they are first requested.
+  // As the optimizer derives statistics repeatedly, they are cached in the node (and its copies) afterwards.
+  std::shared_ptr<TableStatistics> derive_statistics_from(
+      const std::shared_ptr<AbstractLQPNode>& left_input,
+      const std::shared_ptr<AbstractLQPNode>& right_input) const override;
+
+  const std::string table_name;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
+  bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+
+ private:
+  mutable std::optional<std::vector<std::shared_ptr<AbstractExpression>>> _column_expressions;
+  mutable std::shared_ptr<TableStatistics> _table_statistics;
+};
+
+}  // namespace opossum
@@ -19,6 +19,22 @@ void StoredTableNode::set_excluded_chunk_ids(const std::vector<ChunkID>& chunks)
 
 const std::vector<ChunkID>& StoredTableNode::excluded_chunk_ids() const { return _excluded_chunk_ids; }
 
+void StoredTableNode::set_excluded_chunk_statistics_versions(const std::map<ChunkID, uint64_t>& statistics_versions) {
+  _excluded_chunk_statistics_versions = statistics_versions;
+}
+
+const std::map<ChunkID, uint64_t>& StoredTableNode::excluded_chunk_statistics_versions() const {
+  return _excluded_chunk_statistics_versions;
+}
+
+void StoredTableNode::set_parameter_pruning_predicates(const std::vector<OperatorScanPredicate>& predicates) {
+  _parameter_pruning_predicates = predicates;
+}
+
+const std::optional<std::vector<OperatorScanPredicate>>& StoredTableNode::parameter_pruning_predicates() const {
+  return _parameter_pruning_predicates;
+}
+
 std::string StoredTableNode::description() const { return "[StoredTable] Name: '" + table_name + "'"; }
 
 const std::vector<std::shared_ptr<AbstractExpression>>& StoredTableNode::column_expressions() const {
@@ -51,12 +67,20 @@ std::shared_ptr<TableStatistics> StoredTableNode::derive_statistics_from(
 std::shared_ptr<AbstractLQPNode> StoredTableNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
   const auto copy = make(table_name);
   copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  copy->set_excluded_chunk_statistics_versions(_excluded_chunk_statistics_versions);
+  copy->_parameter_pruning_predicates = _parameter_pruning_predicates;
   return copy;
 }
 
 bool StoredTableNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& stored_table_node = static_cast<const StoredTableNode&>(rhs);
-  return table_name == stored_table_node.table_name && _excluded_chunk_ids == stored_table_node._excluded_chunk_ids;
+
+  // Whether the ChunkPruningRule has visited a node does not matter, only the predicates passed on to GetTable do
+  const auto no_predicates = std::vector<OperatorScanPredicate>{};
+  return table_name == stored_table_node.table_name && _excluded_chunk_ids == stored_table_node._excluded_chunk_ids &&
+         _excluded_chunk_statistics_versions == stored_table_node._excluded_chunk_statistics_versions &&
+         _parameter_pruning_predicates.value_or(no_predicates) ==
+             stored_table_node._parameter_pruning_predicates.value_or(no_predicates);
 }
 
 }  // namespace opossum
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <map>
 #include <optional>
 #include <vector>
 
 #include "abstract_lqp_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "lqp_column_reference.hpp"
+#include "operators/operator_scan_predicate.hpp"
 
 namespace opossum {
 
@@ -20,6 +22,15 @@ class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public Abs
   void set_excluded_chunk_ids(const std::vector<ChunkID>& chunks);
   const std::vector<ChunkID>& excluded_chunk_ids() const;
 
+  // Statistics versions (see Chunk::statistics_version) of excluded chunks that were mutable when they were pruned
+  void set_excluded_chunk_statistics_versions(const std::map<ChunkID, uint64_t>& statistics_versions);
+  const std::map<ChunkID, uint64_t>& excluded_chunk_statistics_versions() const;
+
+  // Predicates on parameters (e.g., placeholders of prepared statements) that GetTable uses to prune chunks once the
+  // parameter values are known. std::nullopt if the ChunkPruningRule has not visited the node yet.
+  void set_parameter_pruning_predicates(const std::vector<OperatorScanPredicate>& predicates);
+  const std::optional<std::vector<OperatorScanPredicate>>& parameter_pruning_predicates() const;
+
   std::string description() const override;
   const std::vector<std::shared_ptr<AbstractExpression>>& column_expressions() const override;
   bool is_column_nullable(const ColumnID column_id) const override;
@@ -36,6 +47,8 @@ class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public Abs
  private:
   mutable std::optional<std::vector<std::shared_ptr<AbstractExpression>>> _expressions;
   std::vector<ChunkID> _excluded_chunk_ids;
+  std::map<ChunkID, uint64_t> _excluded_chunk_statistics_versions;
+  std::optional<std::vector<OperatorScanPredicate>> _parameter_pruning_predicates;
 };
 
 }  // namespace opossum
@@ -0,0 +1,46 @@
+#include "tracking_memory_resource.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace opossum {
+
+TrackingMemoryResource::TrackingMemoryResource(const std::optional<size_t>& budget,
+                                               boost::container::pmr::memory_resource* upstream)
+    : _upstream(upstream), _parent(dynamic_cast<const TrackingMemoryResource*>(upstream)), _budget(budget) {}
+
+size_t TrackingMemoryResource::current_bytes() const { return _current_bytes.load(); }
+
+size_t TrackingMemoryResource::peak_bytes() const { return _peak_bytes.load(); }
+
+const std::optional<size_t>& TrackingMemoryResource::budget() const { return _budget; }
+
+size_t TrackingMemoryResource::remaining_budget() const {
+  const auto parent_budget = _parent ? _parent->remaining_budget() : std::numeric_limits<size_t>::max();
+  if (!_budget) return parent_budget;
+
+  const auto current_bytes = _current_bytes.load();
+  return std::min(parent_budget, current_bytes < *_budget ? *_budget - current_bytes : size_t{0});
+}
+
+const TrackingMemoryResource* TrackingMemoryResource::parent() const { return _parent; }
+
+void* TrackingMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  auto* const pointer = _upstream->allocate(bytes, alignment);
+
+  const auto current_bytes = _current_bytes.fetch_add(bytes) + bytes;
+  auto peak_bytes = _peak_bytes.load();
+  while (current_bytes > peak_bytes && !_peak_bytes.compare_exchange_weak(peak_bytes, current_bytes)) {
+  }
+
+  return pointer;
+}
+
+void TrackingMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+  _upstream->deallocate(p, bytes, alignment);
+  _current_bytes.fetch_sub(bytes);
+}
+
+bool TrackingMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return &other == this; }
+
+}  // namespace opossum
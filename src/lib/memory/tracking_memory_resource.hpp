@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+
+namespace opossum {
+
+/**
+ * A memory resource that forwards all allocations to an upstream resource and keeps track of the number of bytes that
+ * are currently allocated through it as well as of the peak. Optionally, it holds a memory budget. Exceeding the
+ * budget does not make allocations fail, as this would abort queries halfway. Instead, memory-intensive operators
+ * check the remaining budget and adapt their execution (e.g., JoinHash spills partitions to disk).
+ *
+ * Resources can be nested by passing a TrackingMemoryResource as the upstream resource. The SQLPipelineStatement uses
+ * this to give every operator its own resource below the resource of the query, so that the allocations are accounted
+ * for on both levels. The remaining budget of a nested resource is also limited by the budgets of its ancestors.
+ *
+ * The resource has to outlive all allocations made through it. Thus, it should only be used for data structures that
+ * do not outlive the operator (or query) that owns the resource, such as hash tables, but not for output tables.
+ */
+class TrackingMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  explicit TrackingMemoryResource(const std::optional<size_t>& budget = std::nullopt,
+                                  boost::container::pmr::memory_resource* upstream =
+                                      boost::container::pmr::get_default_resource());
+
+  size_t current_bytes() const;
+  size_t peak_bytes() const;
+
+  const std::optional<size_t>& budget() const;
+
+  // Number of bytes that can still be allocated without exceeding the budget of this resource or of any of its
+  // ancestors (0 if one of them is already exceeded, the maximum value of size_t if there is no budget)
+  size_t remaining_budget() const;
+
+  // The TrackingMemoryResource that this resource forwards its allocations to, if any
+  const TrackingMemoryResource* parent() const;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  boost::container::pmr::memory_resource* const _upstream;
+  const TrackingMemoryResource* const _parent;
+  const std::optional<size_t> _budget;
+
+  std::atomic<size_t> _current_bytes{0};
+  std::atomic<size_t> _peak_bytes{0};
+};
+
+}  // namespace opossum
@@ -5,6 +5,8 @@
 #include <utility>
 
 #include "constant_mappings.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/table.hpp"
 
 using namespace std::string_literals;  // NOLINT
 
@@ -58,6 +60,14 @@ const std::string AbstractJoinOperator::description(DescriptionMode description_
 
 void AbstractJoinOperator::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
+void AbstractJoinOperator::_record_join_column_accesses() const {
+  const auto left_in_table = _input_left->get_output();
+  const auto right_in_table = _input_right->get_output();
+
+  record_segment_accesses(*left_in_table, _primary_predicate.column_ids.first, SegmentAccessType::Materialization);
+  record_segment_accesses(*right_in_table, _primary_predicate.column_ids.second, SegmentAccessType::Materialization);
+}
+
 std::shared_ptr<Table> AbstractJoinOperator::_initialize_output_table() const {
   const auto left_in_table = _input_left->get_output();
   const auto right_in_table = _input_right->get_output();
@@ -42,6 +42,9 @@ class AbstractJoinOperator : public AbstractReadOnlyOperator {
 
   std::shared_ptr<Table> _initialize_output_table() const;
 
+  // Records the materialization of the primary join columns of both inputs, see SegmentAccessCounter
+  void _record_join_column_accesses() const;
+
   // Some operators need an internal implementation class, mostly in cases where
   // their execute method depends on a template parameter. An example for this is
   // found in join_hash.hpp.
@@ -7,6 +7,7 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "memory/tracking_memory_resource.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/format_duration.hpp"
@@ -54,8 +55,22 @@ void AbstractOperator::execute() {
 
   _performance_data->walltime = performance_timer.lap();
 
+  if (_input_left && _input_left->get_output()) {
+    _performance_data->input_row_count_left = _input_left->get_output()->row_count();
+  }
+  if (_input_right && _input_right->get_output()) {
+    _performance_data->input_row_count_right = _input_right->get_output()->row_count();
+  }
+  if (_output) {
+    _performance_data->output_row_count = _output->row_count();
+    _performance_data->output_chunk_count = _output->chunk_count();
+  }
+  if (_memory_resource) {
+    _performance_data->peak_memory_bytes = _memory_resource->peak_bytes();
+  }
+
   DTRACE_PROBE5(HYRISE, OPERATOR_EXECUTED, name().c_str(), _performance_data->walltime.count(),
-                _output ? _output->row_count() : 0, _output ? _output->chunk_count() : 0,
+                _performance_data->output_row_count, _performance_data->output_chunk_count,
                 reinterpret_cast<uintptr_t>(this));
 }
 
@@ -111,6 +126,19 @@ void AbstractOperator::set_transaction_context_recursively(
   if (_input_right) mutable_input_right()->set_transaction_context_recursively(transaction_context);
 }
 
+const std::shared_ptr<TrackingMemoryResource>& AbstractOperator::memory_resource() const { return _memory_resource; }
+
+void AbstractOperator::set_memory_resource(const std::shared_ptr<TrackingMemoryResource>& memory_resource) {
+  _memory_resource = memory_resource;
+}
+
+void AbstractOperator::set_memory_resource_recursively(const std::shared_ptr<TrackingMemoryResource>& memory_resource) {
+  set_memory_resource(memory_resource);
+
+  if (_input_left) mutable_input_left()->set_memory_resource_recursively(memory_resource);
+  if (_input_right) mutable_input_right()->set_memory_resource_recursively(memory_resource);
+}
+
 std::shared_ptr<AbstractOperator> AbstractOperator::mutable_input_left() const {
   return std::const_pointer_cast<AbstractOperator>(_input_left);
 }
@@ -132,7 +160,7 @@ void AbstractOperator::print(std::ostream& stream) const {
     if (op->input_right()) children.emplace_back(op->input_right());
     return children;
   };
-  const auto node_print_fn = [& performance_data = *_performance_data](const auto& op, auto& fn_stream) {
+  const auto node_print_fn = [](const auto& op, auto& fn_stream) {
     fn_stream << op->description();
 
     // If the operator was already executed, print some info about data and performance
@@ -143,7 +171,7 @@ void AbstractOperator::print(std::ostream& stream) const {
 
       fn_stream << format_bytes(output->estimate_memory_usage());
       fn_stream << "/";
-      fn_stream << performance_data.to_string(DescriptionMode::SingleLine) << ")";
+      fn_stream << op->performance_data().to_string(DescriptionMode::SingleLine) << ")";
     }
   };
 
@@ -172,6 +200,7 @@ std::shared_ptr<AbstractOperator> AbstractOperator::_deep_copy_impl(
 
   const auto copied_op = _on_deep_copy(copied_input_left, copied_input_right);
   if (_transaction_context) copied_op->set_transaction_context(*_transaction_context);
+  copied_op->lqp_node = lqp_node;
 
   copied_ops.emplace(this, copied_op);
 
@@ -11,8 +11,10 @@
 
 namespace opossum {
 
+class AbstractLQPNode;
 class OperatorTask;
 class Table;
+class TrackingMemoryResource;
 class TransactionContext;
 
 enum class OperatorType {
@@ -22,6 +24,7 @@ enum class OperatorType {
   Difference,
   ExportBinary,
   ExportCsv,
+  GetMetaTable,
   GetTable,
   ImportBinary,
   ImportCsv,
@@ -103,6 +106,16 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Calls set_transaction_context on itself and both input operators recursively
   void set_transaction_context_recursively(const std::weak_ptr<TransactionContext>& transaction_context);
 
+  // Memory resource for the large intermediates of the operator (e.g., hash tables). It tracks their memory consumption
+  // and limits the remaining budget of the query, if any. The SQLPipelineStatement gives each operator its own resource
+  // nested below the resource of the query. Can be nullptr, in which case the intermediates are allocated from the
+  // default resource.
+  const std::shared_ptr<TrackingMemoryResource>& memory_resource() const;
+  void set_memory_resource(const std::shared_ptr<TrackingMemoryResource>& memory_resource);
+
+  // Calls set_memory_resource on itself and both input operators recursively
+  void set_memory_resource_recursively(const std::shared_ptr<TrackingMemoryResource>& memory_resource);
+
   // Returns a new instance of the same operator with the same configuration.
   // Recursively copies the input operators.
   // An operator needs to implement this method in order to be cacheable.
@@ -129,6 +142,11 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Set parameters (AllParameterVariants or CorrelatedParameterExpressions) to their respective values
   void set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
 
+  // LQP node from which this operator was translated, set by the LQPTranslator and kept by deep_copy(). Used to compare
+  // the estimated with the actual cardinality (see explain_analyze.hpp). Can be nullptr, e.g., for operators that were
+  // created manually or for operators that are not the topmost operator of an LQP node's translation.
+  std::shared_ptr<AbstractLQPNode> lqp_node;
+
  protected:
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
@@ -169,6 +187,8 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
 
+  std::shared_ptr<TrackingMemoryResource> _memory_resource;
+
   const std::unique_ptr<OperatorPerformanceData> _performance_data;
 };
 
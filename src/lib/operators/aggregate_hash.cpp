@@ -12,11 +12,14 @@
 
 #include "aggregate/aggregate_traits.hpp"
 #include "constant_mappings.hpp"
+#include "memory/tracking_memory_resource.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/segment_accessor.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/aligned_size.hpp"
@@ -144,6 +147,10 @@ void AggregateHash::_aggregate() {
   using AggregateKeysAllocator =
       boost::container::scoped_allocator_adaptor<PolymorphicAllocator<AggregateKeys<AggregateKey>>>;
 
+  // The buffers obtain their memory from the memory resource of the query (if any), so that it is tracked
+  auto* const upstream_resource = _memory_resource ? _memory_resource.get()
+                                                   : boost::container::pmr::get_default_resource();
+
   auto input_table = input_table_left();
 
   for ([[maybe_unused]] const auto& groupby_column_id : _groupby_column_ids) {
@@ -153,6 +160,14 @@ void AggregateHash::_aggregate() {
   // Check for invalid aggregates
   _validate_aggregates();
 
+  for (const auto& groupby_column_id : _groupby_column_ids) {
+    record_segment_accesses(*input_table, groupby_column_id, SegmentAccessType::Materialization);
+  }
+  for (const auto& aggregate : _aggregates) {
+    if (!aggregate.column) continue;
+    record_segment_accesses(*input_table, *aggregate.column, SegmentAccessType::Materialization);
+  }
+
   /*
   PARTITIONING PHASE
   First we partition the input chunks by the given group key(s).
@@ -173,7 +188,7 @@ void AggregateHash::_aggregate() {
                          input_table->row_count() * needed_size_per_aggregate_key;
     needed_size *= 1.1;  // Give it a little bit more, just in case
 
-    auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(needed_size);
+    auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(needed_size, upstream_resource);
     auto allocator = AggregateKeysAllocator{PolymorphicAllocator<AggregateKeys<AggregateKey>>{&temp_buffer}};
     allocator.allocate(1);  // Make sure that the buffer is initialized
     const auto start_next_buffer_size = temp_buffer.next_buffer_size();
@@ -204,7 +219,8 @@ void AggregateHash::_aggregate() {
   jobs.reserve(_groupby_column_ids.size());
 
   for (size_t group_column_index = 0; group_column_index < _groupby_column_ids.size(); ++group_column_index) {
-    jobs.emplace_back(std::make_shared<JobTask>([&input_table, group_column_index, &keys_per_chunk, this]() {
+    jobs.emplace_back(std::make_shared<JobTask>([&input_table, group_column_index, &keys_per_chunk, upstream_resource,
+                                                 this]() {
       const auto column_id = _groupby_column_ids.at(group_column_index);
       const auto data_type = input_table->column_data_type(column_id);
 
@@ -219,7 +235,7 @@ void AggregateHash::_aggregate() {
         // This time, we have no idea how much space we need, so we take some memory and then rely on the automatic
         // resizing. The size is quite random, but since single memory allocations do not cost too much, we rather
         // allocate a bit too much.
-        auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(1'000'000);
+        auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(1'000'000, upstream_resource);
         auto allocator = PolymorphicAllocator<std::pair<const ColumnDataType, AggregateKeyEntry>>{&temp_buffer};
 
         auto id_map = std::unordered_map<ColumnDataType, AggregateKeyEntry, std::hash<ColumnDataType>,
@@ -579,33 +595,18 @@ void AggregateHash::_write_groupby_output(PosList& pos_list) {
     resolve_data_type(input_table->column_data_type(column_id), [&](const auto typed_value) {
       using ColumnDataType = typename decltype(typed_value)::type;
 
-      auto values = pmr_concurrent_vector<ColumnDataType>(pos_list.size());
-      auto null_values = pmr_concurrent_vector<bool>(pos_list.size());
+      // pos_list was generated by grouping the input data. While it might point to rows that contain NULL values, no
+      // new NULL values should have been added.
+      const auto row_count = pos_list.size();
+      auto values = std::vector<ColumnDataType>(row_count);
+      auto null_values = std::make_unique<bool[]>(row_count);
       std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>> accessors(input_table->chunk_count());
+      access_row_ids(*input_table, column_id, pos_list.cbegin(), pos_list.cend(), accessors, values.data(),
+                     null_values.get());
 
-      auto output_offset = ChunkOffset{0};
-
-      for (const auto& row_id : pos_list) {
-        // pos_list was generated by grouping the input data. While it might point to rows that contain NULL
-        // values, no new NULL values should have been added.
-        DebugAssert(!row_id.is_null(), "Did not expect NULL value here");
-
-        auto& accessor = accessors[row_id.chunk_id];
-        if (!accessor) {
-          accessor =
-              create_segment_accessor<ColumnDataType>(input_table->get_chunk(row_id.chunk_id)->get_segment(column_id));
-        }
-
-        const auto& optional_value = accessor->access(row_id.chunk_offset);
-        if (!optional_value) {
-          null_values[output_offset] = true;
-        } else {
-          values[output_offset] = *optional_value;
-        }
-        ++output_offset;
-      }
-
-      auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+      auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(
+          pmr_concurrent_vector<ColumnDataType>(std::move(values)),
+          pmr_concurrent_vector<bool>(null_values.get(), null_values.get() + row_count));
       _output_segments.push_back(value_segment);
     });
   }
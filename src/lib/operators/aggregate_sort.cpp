@@ -8,6 +8,7 @@
 #include "constant_mappings.hpp"
 #include "operators/sort.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/segments_are_sorted.hpp"
 #include "table_wrapper.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
@@ -241,7 +242,8 @@ void AggregateSort::_set_and_write_aggregate_value(
  *
  * Sort the input table after all group by columns.
  *  Currently, this is done using multiple passes of the Sort operator (which is stable)
- *  For future implementations, the fact that the input table is already sorted could be used to skip this step.
+ *  If there is a single group by column and the input table is already sorted by it (see Chunk::ordered_by), this step
+ *    is skipped. Otherwise, the Sort operator still benefits from chunks that are already sorted.
  *    See https://github.com/hyrise/hyrise/issues/1519 for a discussion about operators using sortedness.
  *
  * Find the group boundaries
@@ -340,14 +342,37 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
    * However, we did not benchmark it, so we cannot prove it.
    */
 
+  /**
+   * The rows of each group are already consecutive if the input is sorted by the only group by column. This is verified
+   * in linear time if all chunks are ordered_by the column in the same way. Empty chunks are not expected below.
+   */
+  auto input_is_sorted = false;
+  if (_groupby_column_ids.size() == 1) {
+    const auto column_id = _groupby_column_ids.front();
+    const auto ordered_by = input_table->get_chunk(ChunkID{0})->ordered_by();
+
+    auto chunks_are_sorted = ordered_by && ordered_by->first == column_id;
+    auto segments = std::vector<std::shared_ptr<const BaseSegment>>{};
+    for (const auto& chunk : input_table->chunks()) {
+      if (!chunks_are_sorted) break;
+      chunks_are_sorted = chunk->size() > 0 && chunk->ordered_by() == ordered_by;
+      segments.emplace_back(chunk->get_segment(column_id));
+    }
+
+    input_is_sorted = chunks_are_sorted && segments_are_sorted(segments, input_table->column_data_type(column_id),
+                                                               ordered_by->second);
+  }
+
   // Sort input table consecutively by the group by columns (stable sort)
   auto sorted_table = input_table;
-  for (const auto& column_id : _groupby_column_ids) {
-    const auto sorted_wrapper = std::make_shared<TableWrapper>(sorted_table);
-    sorted_wrapper->execute();
-    Sort sort = Sort(sorted_wrapper, column_id);
-    sort.execute();
-    sorted_table = sort.get_output();
+  if (!input_is_sorted) {
+    for (const auto& column_id : _groupby_column_ids) {
+      const auto sorted_wrapper = std::make_shared<TableWrapper>(sorted_table);
+      sorted_wrapper->execute();
+      Sort sort = Sort(sorted_wrapper, column_id);
+      sort.execute();
+      sorted_table = sort.get_output();
+    }
   }
 
   _output_segments.resize(_aggregates.size() + _groupby_column_ids.size());
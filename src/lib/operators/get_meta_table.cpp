@@ -0,0 +1,33 @@
+#include "get_meta_table.hpp"
+
+#include <memory>
+#include <string>
+
+#include "storage/table.hpp"
+#include "utils/meta_table_manager.hpp"
+
+namespace opossum {
+
+GetMetaTable::GetMetaTable(const std::string& name)
+    : AbstractReadOnlyOperator(OperatorType::GetMetaTable), _name(name) {}
+
+const std::string GetMetaTable::name() const { return "GetMetaTable"; }
+
+const std::string GetMetaTable::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+  return name() + separator + "(" + _name + ")";
+}
+
+const std::string& GetMetaTable::table_name() const { return _name; }
+
+std::shared_ptr<AbstractOperator> GetMetaTable::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<GetMetaTable>(_name);
+}
+
+void GetMetaTable::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> GetMetaTable::_on_execute() { return MetaTableManager::get().generate_table(_name); }
+
+}  // namespace opossum
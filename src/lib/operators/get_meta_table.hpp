@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_read_only_operator.hpp"
+
+namespace opossum {
+
+// Generates a meta table (see MetaTableManager) from the current state of the engine
+class GetMetaTable : public AbstractReadOnlyOperator {
+ public:
+  explicit GetMetaTable(const std::string& name);
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  const std::string& table_name() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const std::string _name;
+};
+
+}  // namespace opossum
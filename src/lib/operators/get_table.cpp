@@ -7,6 +7,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "storage/storage_manager.hpp"
 #include "types.hpp"
 
@@ -32,22 +33,62 @@ void GetTable::set_excluded_chunk_ids(const std::vector<ChunkID>& excluded_chunk
   _excluded_chunk_ids = excluded_chunk_ids;
 }
 
+void GetTable::set_excluded_chunk_statistics_versions(const std::map<ChunkID, uint64_t>& statistics_versions) {
+  _excluded_chunk_statistics_versions = statistics_versions;
+}
+
+void GetTable::set_parameter_pruning_predicates(const std::vector<OperatorScanPredicate>& predicates) {
+  _parameter_pruning_predicates = predicates;
+}
+
 std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
   auto copy = std::make_shared<GetTable>(_name);
   copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  copy->set_excluded_chunk_statistics_versions(_excluded_chunk_statistics_versions);
+  copy->set_parameter_pruning_predicates(_parameter_pruning_predicates);
+  copy->_parameters = _parameters;
   return copy;
 }
 
-void GetTable::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+void GetTable::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  for (const auto& predicate : _parameter_pruning_predicates) {
+    for (const auto& value : {std::optional<AllParameterVariant>{predicate.value}, predicate.value2}) {
+      if (!value || !is_parameter_id(*value)) continue;
+
+      const auto parameter_iter = parameters.find(boost::get<ParameterID>(*value));
+      if (parameter_iter != parameters.end()) _parameters[parameter_iter->first] = parameter_iter->second;
+    }
+  }
+}
 
 std::shared_ptr<const Table> GetTable::_on_execute() {
   DebugAssert(!transaction_context_is_set() || transaction_context()->phase() == TransactionPhase::Active,
               "Transaction is not active anymore.");
 
   auto original_table = StorageManager::get().get_table(_name);
-  auto temp_excluded_chunk_ids = std::vector<ChunkID>(_excluded_chunk_ids);
+  auto temp_excluded_chunk_ids = std::vector<ChunkID>{};
+  temp_excluded_chunk_ids.reserve(_excluded_chunk_ids.size());
+
+  // Chunks that were pruned while they were mutable might have received matching rows since. In that case, their
+  // zone maps have been widened and we have to scan them after all.
+  for (const auto& chunk_id : _excluded_chunk_ids) {
+    const auto statistics_version_iter = _excluded_chunk_statistics_versions.find(chunk_id);
+    if (statistics_version_iter != _excluded_chunk_statistics_versions.end()) {
+      const auto chunk = original_table->get_chunk(chunk_id);
+      if (chunk && chunk->statistics_version() != statistics_version_iter->second) continue;
+    }
+    temp_excluded_chunk_ids.emplace_back(chunk_id);
+  }
+
+  // Prune the chunks that do not match the predicates on parameters, now that the parameter values are known
+  if (!_parameter_pruning_predicates.empty()) {
+    for (ChunkID chunk_id{0}; chunk_id < original_table->chunk_count(); ++chunk_id) {
+      const auto chunk = original_table->get_chunk(chunk_id);
+      if (chunk && _can_prune_with_parameters(*chunk)) temp_excluded_chunk_ids.emplace_back(chunk_id);
+    }
+  }
 
   if (HYRISE_DEBUG && !transaction_context_is_set()) {
     for (ChunkID chunk_id{0}; chunk_id < original_table->chunk_count(); ++chunk_id) {
@@ -90,4 +131,30 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
   return pruned_table;
 }
 
+bool GetTable::_can_prune_with_parameters(const Chunk& chunk) const {
+  // Returns the value of a predicate, or std::nullopt if it is a parameter whose value has not been set
+  const auto resolve_value = [&](const AllParameterVariant& value) -> std::optional<AllTypeVariant> {
+    if (is_variant(value)) return boost::get<AllTypeVariant>(value);
+
+    const auto parameter_iter = _parameters.find(boost::get<ParameterID>(value));
+    if (parameter_iter == _parameters.end()) return std::nullopt;
+    return parameter_iter->second;
+  };
+
+  for (const auto& predicate : _parameter_pruning_predicates) {
+    const auto value = resolve_value(predicate.value);
+    if (!value) continue;
+
+    auto value2 = std::optional<AllTypeVariant>{};
+    if (predicate.value2) {
+      value2 = resolve_value(*predicate.value2);
+      if (!value2) continue;
+    }
+
+    if (chunk_can_be_pruned(chunk, predicate.column_id, predicate.predicate_condition, *value, value2)) return true;
+  }
+
+  return false;
+}
+
 }  // namespace opossum
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "operators/operator_scan_predicate.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -22,6 +25,14 @@ class GetTable : public AbstractReadOnlyOperator {
 
   void set_excluded_chunk_ids(const std::vector<ChunkID>& excluded_chunk_ids);
 
+  // Excluded chunks that were pruned while they were mutable are only excluded if their statistics version (see
+  // Chunk::statistics_version) still matches, i.e., if no Insert has widened their zone maps since.
+  void set_excluded_chunk_statistics_versions(const std::map<ChunkID, uint64_t>& statistics_versions);
+
+  // Predicates on parameters (see ChunkPruningRule). Once the parameters are set, chunks whose statistics show that
+  // they do not match one of these predicates are pruned as well.
+  void set_parameter_pruning_predicates(const std::vector<OperatorScanPredicate>& predicates);
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -30,8 +41,13 @@ class GetTable : public AbstractReadOnlyOperator {
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
+  bool _can_prune_with_parameters(const Chunk& chunk) const;
+
   // name of the table to retrieve
   const std::string _name;
   std::vector<ChunkID> _excluded_chunk_ids;
+  std::map<ChunkID, uint64_t> _excluded_chunk_statistics_versions;
+  std::vector<OperatorScanPredicate> _parameter_pruning_predicates;
+  std::unordered_map<ParameterID, AllTypeVariant> _parameters;
 };
 }  // namespace opossum
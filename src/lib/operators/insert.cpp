@@ -6,10 +6,13 @@
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_segment.hpp"
+#include "tasks/chunk_finalization_task.hpp"
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
 
@@ -63,7 +66,9 @@ class TypedSegmentProcessor : public AbstractTypedSegmentProcessor {
         Assert(
             target_is_nullable || std::none_of(nulls_begin_iter, nulls_end_iter, [](const auto& null) { return null; }),
             "Trying to insert NULL into non-NULL segment");
-        std::copy(nulls_begin_iter, nulls_end_iter, casted_target->null_values().begin() + target_start_index);
+        if (target_is_nullable) {
+          std::copy(nulls_begin_iter, nulls_end_iter, casted_target->null_values().begin() + target_start_index);
+        }
       }
     } else if (auto casted_dummy_source = std::dynamic_pointer_cast<const ValueSegment<int32_t>>(source)) {
       // We use the segment type of the Dummy table used to insert a single null value.
@@ -114,7 +119,19 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
         make_unique_by_data_type<AbstractTypedSegmentProcessor, TypedSegmentProcessor>(column_type));
   }
 
-  auto total_rows_to_insert = static_cast<uint32_t>(input_table_left()->row_count());
+  // Rows are inserted in the order of the target table's clustering column, so that chunks filled by a single Insert
+  // end up sorted (see Table::set_clustering_column)
+  auto input_table = input_table_left();
+  const auto& clustering_column = _target_table->clustering_column();
+  if (clustering_column && input_table->row_count() > 1) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(input_table);
+    table_wrapper->execute();
+    const auto sort = std::make_shared<Sort>(table_wrapper, clustering_column->first, clustering_column->second);
+    sort->execute();
+    input_table = sort->get_output();
+  }
+
+  auto total_rows_to_insert = static_cast<uint32_t>(input_table->row_count());
 
   // First, allocate space for all the rows to insert. Do so while locking the table to prevent multiple threads
   // modifying the table's size simultaneously.
@@ -164,6 +181,8 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     }
   }
   // TODO(all): make compress chunk thread-safe; if it gets called here by another thread, things will likely break.
+  // The ChunkFinalizationTask is not affected, as it only encodes chunks that no Insert writes to anymore and does not
+  // shrink their MVCC data.
 
   // Then, actually insert the data.
   auto input_offset = 0u;
@@ -181,7 +200,7 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
 
     // while target chunk is not full
     while (target_start_index != target_chunk->size()) {
-      const auto source_chunk = input_table_left()->get_chunk(source_chunk_id);
+      const auto source_chunk = input_table->get_chunk(source_chunk_id);
       auto num_to_insert = std::min(source_chunk->size() - source_chunk_start_index, still_to_insert);
       for (ColumnID column_id{0}; column_id < target_chunk->column_count(); ++column_id) {
         const auto& source_segment = source_chunk->get_segment(column_id);
@@ -200,6 +219,9 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
       }
     }
 
+    // Widen the zone maps before the rows become visible, so that no transaction that sees them prunes the chunk
+    target_chunk->widen_zone_maps(start_index, start_index + current_num_rows_to_insert);
+
     for (auto i = start_index; i < start_index + current_num_rows_to_insert; i++) {
       // we do not need to check whether other operators have locked the rows, we have just created them
       // and they are not visible for other operators.
@@ -225,6 +247,8 @@ void Insert::_on_commit_records(const CommitID cid) {
     mvcc_data->begin_cids[row_id.chunk_offset] = cid;
     mvcc_data->tids[row_id.chunk_offset] = 0u;
   }
+
+  _finalize_complete_chunks();
 }
 
 void Insert::_on_rollback_records() {
@@ -238,6 +262,33 @@ void Insert::_on_rollback_records() {
 
     chunk->get_scoped_mvcc_data_lock()->tids[row_id.chunk_offset] = 0u;
   }
+
+  _finalize_complete_chunks();
+}
+
+void Insert::_finalize_complete_chunks() {
+  if (!_target_table->finalization_encoding_spec()) return;
+
+  // The inserted rows are ordered by chunk, so each chunk is looked at once. The begin-cids of our rows are already
+  // set, so if another Insert into the same chunk is still pending, it will find the chunk complete when it finishes.
+  auto previous_chunk_id = INVALID_CHUNK_ID;
+  for (const auto& row_id : _inserted_rows) {
+    if (row_id.chunk_id == previous_chunk_id) continue;
+    previous_chunk_id = row_id.chunk_id;
+
+    const auto chunk = _target_table->get_chunk(row_id.chunk_id);
+    if (!ChunkFinalizationTask::chunk_is_complete(*chunk, _target_table->max_chunk_size())) continue;
+    if (!chunk->try_begin_finalization()) continue;
+
+    // No further rows are appended to a full chunk, so it can be marked immutable right away (under the append mutex,
+    // as concurrent Inserts check whether the last chunk is mutable). Encoding and indexing run in a separate task so
+    // that the commit is not delayed by them (unless there is no scheduler).
+    {
+      const auto append_lock = _target_table->acquire_append_mutex();
+      chunk->mark_immutable();
+    }
+    std::make_shared<ChunkFinalizationTask>(_target_table, row_id.chunk_id)->schedule();
+  }
 }
 
 std::shared_ptr<AbstractOperator> Insert::_on_deep_copy(
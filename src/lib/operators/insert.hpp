@@ -19,6 +19,9 @@ class TransactionContext;
  *
  * Assumption: The input has been validated before.
  * Note: Insert does not support null values at the moment
+ *
+ * When an Insert commits or rolls back, it finalizes the chunks it inserted into that are now complete (see
+ * Table::set_finalization_encoding_spec() and ChunkFinalizationTask).
  */
 class Insert : public AbstractReadWriteOperator {
  public:
@@ -37,6 +40,8 @@ class Insert : public AbstractReadWriteOperator {
   void _on_rollback_records() override;
 
  private:
+  void _finalize_complete_chunks();
+
   const std::string _target_table_name;
   std::shared_ptr<Table> _target_table;
 
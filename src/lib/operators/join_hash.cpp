@@ -1,6 +1,9 @@
 #include "join_hash.hpp"
 
+#include <algorithm>
+#include <climits>
 #include <cmath>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -12,12 +15,17 @@
 #include "bytell_hash_map.hpp"
 #include "join_hash/join_hash_steps.hpp"
 #include "join_hash/join_hash_traits.hpp"
+#include "memory/tracking_memory_resource.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "type_cast.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_bytes.hpp"
+#include "utils/format_duration.hpp"
 #include "utils/timer.hpp"
 
 namespace opossum {
@@ -25,9 +33,11 @@ namespace opossum {
 JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
                    const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                    const OperatorJoinPredicate& primary_predicate, const std::optional<size_t>& radix_bits,
-                   const std::vector<OperatorJoinPredicate>& secondary_predicates)
-    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, primary_predicate, secondary_predicates),
-      _radix_bits(radix_bits) {
+                   const std::vector<OperatorJoinPredicate>& secondary_predicates, const OutputOrder output_order)
+    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, primary_predicate, secondary_predicates,
+                           std::make_unique<JoinHash::PerformanceData>()),
+      _radix_bits(radix_bits),
+      _output_order(output_order) {
   Assert(primary_predicate.predicate_condition == PredicateCondition::Equals,
          "Unsupported primary PredicateCondition.");
   Assert(mode != JoinMode::FullOuter, "Full outer joins are not supported by JoinHash.");
@@ -37,11 +47,13 @@ JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
 
 const std::string JoinHash::name() const { return "JoinHash"; }
 
+JoinHash::OutputOrder JoinHash::output_order() const { return _output_order; }
+
 std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
   return std::make_shared<JoinHash>(copied_input_left, copied_input_right, _mode, _primary_predicate, _radix_bits,
-                                    _secondary_predicates);
+                                    _secondary_predicates, _output_order);
 }
 
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -93,11 +105,29 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
       build_input->column_data_type(build_column_id), probe_input->column_data_type(probe_column_id), *this,
       build_operator, probe_operator, _mode, adjusted_column_ids, _primary_predicate.predicate_condition,
       inputs_swapped, _radix_bits, std::move(adjusted_secondary_predicates));
+
+  _record_join_column_accesses();
   return _impl->_on_execute();
 }
 
 void JoinHash::_on_cleanup() { _impl.reset(); }
 
+std::string JoinHash::PerformanceData::to_string(DescriptionMode description_mode) const {
+  const auto separator = std::string{description_mode == DescriptionMode::SingleLine ? " / " : "\\n"};
+  auto string = OperatorPerformanceData::to_string(description_mode);
+  string += separator + "Radix bits: " + std::to_string(radix_bits);
+  string += separator + "Build side: " + format_duration(build_side_materialization) + " materialization, " +
+            format_duration(build_side_partitioning) + " partitioning, " + format_duration(build) + " build";
+  string += separator + "Probe side: " + format_duration(probe_side_materialization) + " materialization, " +
+            format_duration(probe_side_partitioning) + " partitioning, " + format_duration(probe) + " probe";
+  string += separator + "Output: " + format_duration(output_reordering) + " reordering, " +
+            format_duration(output_writing) + " writing";
+  if (spilled_bytes > 0) {
+    string += separator + "Spilled: " + format_bytes(spilled_bytes);
+  }
+  return string;
+}
+
 template <typename LeftType, typename RightType>
 class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
  public:
@@ -119,6 +149,26 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     } else {
       _radix_bits = _calculate_radix_bits();
     }
+
+    // Writing to more partitions than there are TLB entries causes a TLB miss for almost every element. In this case,
+    // the inputs are partitioned in two passes.
+    _max_radix_bits_per_pass =
+        static_cast<size_t>(std::max(1.0, std::floor(std::log2(Topology::get().tlb_entry_count()))));
+
+    // If the join is expected to exceed the memory budget of the query, the partitions are spilled to disk and
+    // processed a few at a time (see _probe_spilled_partitions()). Thus, we need enough partitions so that several of
+    // them fit into the budget. This overrides the number of radix bits given by the caller.
+    const auto& memory_resource = _join_hash.memory_resource();
+    const auto remaining_budget =
+        memory_resource ? memory_resource->remaining_budget() : std::numeric_limits<size_t>::max();
+    if (remaining_budget != std::numeric_limits<size_t>::max()) {
+      const auto memory_budget = std::max(size_t{1}, remaining_budget);
+      const auto estimated_memory_usage = _estimate_memory_usage();
+      if (estimated_memory_usage > static_cast<double>(memory_budget)) {
+        _spill_memory_budget = memory_budget;
+        _radix_bits = std::max(_radix_bits, _spill_radix_bits(estimated_memory_usage));
+      }
+    }
   }
 
  protected:
@@ -132,7 +182,27 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
   std::shared_ptr<Table> _output_table;
 
+  // The probe side input. Might be a copy of the right input without the chunks that cannot match any value of the
+  // build side (see _prune_probe_side()).
+  std::shared_ptr<const Table> _right_in_table;
+
   size_t _radix_bits;
+  size_t _max_radix_bits_per_pass;
+
+  // Only set if the partitions are spilled to disk
+  std::optional<size_t> _spill_memory_budget;
+
+  // Estimated number of bytes per row while a partition is built and probed. For the build side, these are the
+  // partitioned element and the hash table entry (see _calculate_radix_bits()), for the probe side the partitioned
+  // element.
+  static constexpr auto BUILD_BYTES_PER_ROW =
+      sizeof(PartitionedElement<LeftType>) + (sizeof(LeftType) + 2 * sizeof(RowID) + 1) / 0.8;
+  static constexpr auto PROBE_BYTES_PER_ROW = static_cast<double>(sizeof(PartitionedElement<RightType>));
+
+  // Spilled partitions that still exceed the memory budget are split up recursively, but only up to this depth. Beyond
+  // that, we assume that the partition consists of few distinct values, which cannot be split further.
+  static constexpr auto MAX_SPILL_DEPTH = size_t{3};
+  static constexpr auto MAX_SPILL_RADIX_BITS = size_t{16};
 
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<LeftType, RightType>::HashType;
@@ -141,14 +211,14 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     /*
       Setting number of bits for radix clustering:
       The number of bits is used to create probe partitions with a size that can
-      be expected to fit into the L2 cache.
-      This should incorporate hardware knowledge, once available in Hyrise.
-      As of now, we assume a L2 cache size of 256 KB.
+      be expected to fit into the L2 cache (as determined by the Topology).
       We estimate the size the following way:
         - we assume each key appears once (that is an overestimation space-wise, but we
         aim rather for a hash map that is slightly smaller than L2 than slightly larger)
         - each entry in the hash map is a data structure holding the actual value
         and the RowID
+      Furthermore, the partitions are built and probed in parallel. For large inputs, we thus create at least one
+      partition per core.
     */
     const auto build_relation_size = _left->get_output()->row_count();
     const auto probe_relation_size = _right->get_output()->row_count();
@@ -164,7 +234,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       PerformanceWarning(warning);
     }
 
-    const auto l2_cache_size = 256'000;  // bytes
+    const auto& topology = Topology::get();
+    const auto l2_cache_size = static_cast<double>(topology.l2_cache_size());
 
     // To get a pessimistic estimation (ensure that the hash table fits within the cache), we assume
     // that each value maps to a PosList with a single RowID. For the used small_vector's, we assume a
@@ -179,17 +250,287 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         / 0.8;
 
     const auto adaption_factor = 2.0f;  // don't occupy the whole L2 cache
-    const auto cluster_count = std::max(1.0, (adaption_factor * complete_hash_map_size) / l2_cache_size);
+    auto cluster_count = std::max(1.0, (adaption_factor * complete_hash_map_size) / l2_cache_size);
+
+    // Below this size, the additional partitioning pass over the inputs does not pay off
+    const auto min_rows_per_core = size_t{10'000};
+    const auto num_cpus = topology.num_cpus();
+    if (build_relation_size + probe_relation_size >= min_rows_per_core * num_cpus) {
+      cluster_count = std::max(cluster_count, static_cast<double>(num_cpus));
+    }
 
     return static_cast<size_t>(std::ceil(std::log2(cluster_count)));
   }
 
+  // Estimated memory usage of the join if it is executed in memory, i.e., with the materialized and the partitioned
+  // elements of both sides as well as all hash tables. The output is not included.
+  double _estimate_memory_usage() const {
+    const auto build_relation_size = _left->get_output()->row_count();
+    const auto probe_relation_size = _right->get_output()->row_count();
+
+    return build_relation_size * (sizeof(PartitionedElement<LeftType>) + BUILD_BYTES_PER_ROW) +
+           probe_relation_size * (sizeof(PartitionedElement<RightType>) + PROBE_BYTES_PER_ROW);
+  }
+
+  // Number of radix bits needed so that about four partitions (or partitions of a partition) of the given size fit
+  // into the memory budget
+  size_t _spill_radix_bits(const double estimated_memory_usage) const {
+    const auto partition_count = 4.0 * estimated_memory_usage / static_cast<double>(*_spill_memory_budget);
+    return std::clamp(static_cast<size_t>(std::ceil(std::log2(partition_count))), size_t{1}, MAX_SPILL_RADIX_BITS);
+  }
+
+  // Inner and Semi joins only output rows of the probe side that have a match on the build side. Thus, chunks of the
+  // probe side whose statistics show that they do not contain any value within the range of the build side can be
+  // skipped. As the statistics cast the values to the column's data type, this requires both sides to have the same
+  // type. Pruning needs the entire build side to be materialized first, which is avoided when spilling.
+  // Note that the probe side input has already been produced (e.g., by GetTable and TableScans) when the join executes.
+  // Thus, pruning only saves materializing and probing the pruned chunks, not the work of the operators below the join.
+  bool _probe_side_can_be_pruned() const {
+    if constexpr (std::is_same_v<LeftType, RightType>) {
+      return (_mode == JoinMode::Inner || _mode == JoinMode::Semi) && _right_in_table->chunk_count() > 1 &&
+             !_spill_memory_budget;
+    } else {
+      return false;
+    }
+  }
+
+  // Returns a copy of the probe side input without the chunks that cannot match any value of the build side, or the
+  // input itself if no chunk was pruned
+  std::shared_ptr<const Table> _prune_probe_side(const RadixContainer<LeftType>& materialized_left) const {
+    auto min = std::optional<LeftType>{};
+    auto max = std::optional<LeftType>{};
+    for (const auto& element : *materialized_left.elements) {
+      // Skip the elements that NULL values left behind (see materialize_input())
+      if (element.row_id == NULL_ROW_ID) continue;
+
+      if (!min || element.value < *min) min = element.value;
+      if (!max || element.value > *max) max = element.value;
+    }
+    if (!min) return _right_in_table;
+
+    auto pruned_chunk_ids = std::vector<ChunkID>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < _right_in_table->chunk_count(); ++chunk_id) {
+      const auto chunk = _right_in_table->get_chunk(chunk_id);
+      if (chunk_can_be_pruned(*chunk, _column_ids.second, PredicateCondition::Between, AllTypeVariant{*min},
+                              AllTypeVariant{*max})) {
+        pruned_chunk_ids.emplace_back(chunk_id);
+      }
+    }
+    if (pruned_chunk_ids.empty()) return _right_in_table;
+
+    // The output references the chunks of the copy, so MVCC information is not needed (cf. GetTable::_on_execute())
+    const auto max_chunk_size = _right_in_table->type() == TableType::Data
+                                    ? std::optional<uint32_t>{_right_in_table->max_chunk_size()}
+                                    : std::nullopt;
+    const auto pruned_table =
+        std::make_shared<Table>(_right_in_table->column_definitions(), _right_in_table->type(), max_chunk_size);
+    for (auto chunk_id = ChunkID{0}; chunk_id < _right_in_table->chunk_count(); ++chunk_id) {
+      if (std::binary_search(pruned_chunk_ids.cbegin(), pruned_chunk_ids.cend(), chunk_id)) continue;
+
+      const auto chunk = _right_in_table->get_chunk(chunk_id);
+      pruned_table->append_chunk(chunk->segments(), chunk->get_allocator());
+    }
+
+    return pruned_table;
+  }
+
+  // The resource for the materialized and partitioned elements as well as for the hash tables
+  boost::container::pmr::memory_resource* _memory_resource() const {
+    const auto& memory_resource = _join_hash.memory_resource();
+    return memory_resource ? memory_resource.get() : boost::container::pmr::get_default_resource();
+  }
+
+  void _probe(const RadixContainer<RightType>& radix_right,
+              const std::vector<std::optional<HashTable<HashedType>>>& hashtables,
+              std::vector<PosList>& left_pos_lists, std::vector<PosList>& right_pos_lists) const {
+    /*
+    NUMA notes:
+    The workers for each radix partition P should be scheduled on the same node as the input data:
+    leftP, rightP and hashtableP.
+    */
+    switch (_mode) {
+      case JoinMode::Inner:
+        probe<RightType, HashedType, false>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode,
+                                            *_left->get_output(), *_right_in_table, _secondary_join_predicates);
+        break;
+
+      case JoinMode::Left:
+      case JoinMode::Right:
+        probe<RightType, HashedType, true>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode,
+                                           *_left->get_output(), *_right_in_table, _secondary_join_predicates);
+        break;
+
+      case JoinMode::Semi:
+      case JoinMode::AntiNullAsTrue:
+        probe_semi_anti<RightType, HashedType, false>(radix_right, hashtables, right_pos_lists, _mode,
+                                                      *_left->get_output(), *_right_in_table,
+                                                      _secondary_join_predicates);
+        break;
+
+      case JoinMode::AntiNullAsFalse:
+        probe_semi_anti<RightType, HashedType, true>(radix_right, hashtables, right_pos_lists, _mode,
+                                                     *_left->get_output(), *_right_in_table,
+                                                     _secondary_join_predicates);
+        break;
+
+      default:
+        Fail("JoinMode not supported by JoinHash");
+    }
+  }
+
+  /*
+    Grace hash join: Loads as many spilled partitions as fit into the memory budget, builds their hash tables, and
+    probes them. Partitions that do not fit into the budget on their own are split up by the next bits of the hash
+    (hash_shift denotes the bits that have been used for partitioning so far) and processed recursively. The results
+    are written to the pos lists of the respective partitions.
+  */
+  void _probe_spilled_partitions(const SpilledRadixContainer& spilled_left, const SpilledRadixContainer& spilled_right,
+                                 std::vector<PosList>& left_pos_lists, std::vector<PosList>& right_pos_lists,
+                                 const size_t hash_shift, const size_t depth) {
+    auto& performance_data = static_cast<PerformanceData&>(*_join_hash._performance_data);
+    const auto memory_budget = static_cast<double>(*_spill_memory_budget);
+
+    const auto partition_size = [](const SpilledRadixContainer& spilled_container, const size_t partition_id) {
+      const auto& offsets = spilled_container.partition_offsets;
+      return offsets[partition_id] - (partition_id == 0 ? size_t{0} : offsets[partition_id - 1]);
+    };
+    const auto estimated_memory_usage = [&](const size_t partition_id) {
+      return static_cast<double>(partition_size(spilled_left, partition_id)) * BUILD_BYTES_PER_ROW +
+             static_cast<double>(partition_size(spilled_right, partition_id)) * PROBE_BYTES_PER_ROW;
+    };
+
+    const auto partition_count = spilled_right.partition_offsets.size();
+    auto begin_partition_id = size_t{0};
+    while (begin_partition_id < partition_count) {
+      // Collect partitions as long as they fit into the budget, but at least one
+      auto end_partition_id = begin_partition_id;
+      auto batch_memory_usage = 0.0;
+      while (end_partition_id < partition_count &&
+             (end_partition_id == begin_partition_id ||
+              batch_memory_usage + estimated_memory_usage(end_partition_id) <= memory_budget)) {
+        batch_memory_usage += estimated_memory_usage(end_partition_id);
+        ++end_partition_id;
+      }
+
+      Timer timer;
+      const auto sub_radix_bits = _spill_radix_bits(batch_memory_usage);
+      if (batch_memory_usage > memory_budget && depth < MAX_SPILL_DEPTH &&
+          hash_shift + sub_radix_bits <= sizeof(Hash) * CHAR_BIT) {
+        // A single partition that is too large: split it up and process the parts one after another. The partition is
+        // split run by run, so that it is never loaded as a whole.
+        const auto spilled_sub_left = repartition_spilled_partition<LeftType, HashedType>(
+            spilled_left, begin_partition_id, hash_shift, sub_radix_bits, _memory_resource());
+        const auto spilled_sub_right = repartition_spilled_partition<RightType, HashedType>(
+            spilled_right, begin_partition_id, hash_shift, sub_radix_bits, _memory_resource());
+        performance_data.spilled_bytes += spilled_sub_left.file_size + spilled_sub_right.file_size;
+
+        auto sub_left_pos_lists = std::vector<PosList>(1ull << sub_radix_bits);
+        auto sub_right_pos_lists = std::vector<PosList>(1ull << sub_radix_bits);
+        _probe_spilled_partitions(spilled_sub_left, spilled_sub_right, sub_left_pos_lists, sub_right_pos_lists,
+                                  hash_shift + sub_radix_bits, depth + 1);
+
+        for (auto sub_partition_id = size_t{0}; sub_partition_id < sub_left_pos_lists.size(); ++sub_partition_id) {
+          auto& left_pos_list = left_pos_lists[begin_partition_id];
+          auto& right_pos_list = right_pos_lists[begin_partition_id];
+          left_pos_list.insert(left_pos_list.end(), sub_left_pos_lists[sub_partition_id].begin(),
+                               sub_left_pos_lists[sub_partition_id].end());
+          right_pos_list.insert(right_pos_list.end(), sub_right_pos_lists[sub_partition_id].begin(),
+                                sub_right_pos_lists[sub_partition_id].end());
+        }
+      } else {
+        const auto batch_left =
+            load_partitions<LeftType>(spilled_left, begin_partition_id, end_partition_id, _memory_resource());
+        const auto batch_right =
+            load_partitions<RightType>(spilled_right, begin_partition_id, end_partition_id, _memory_resource());
+
+        const auto hashtables = build<LeftType, HashedType>(batch_left, _memory_resource());
+        performance_data.build += timer.lap();
+
+        const auto batch_partition_count = end_partition_id - begin_partition_id;
+        auto batch_left_pos_lists = std::vector<PosList>(batch_partition_count);
+        auto batch_right_pos_lists = std::vector<PosList>(batch_partition_count);
+        _probe(batch_right, hashtables, batch_left_pos_lists, batch_right_pos_lists);
+
+        for (auto partition_id = size_t{0}; partition_id < batch_partition_count; ++partition_id) {
+          left_pos_lists[begin_partition_id + partition_id] = std::move(batch_left_pos_lists[partition_id]);
+          right_pos_lists[begin_partition_id + partition_id] = std::move(batch_right_pos_lists[partition_id]);
+        }
+      }
+
+      begin_partition_id = end_partition_id;
+    }
+  }
+
+  /*
+    Materializes and radix-partitions an input in batches of chunks and appends the partitions of each batch to the
+    returned container as a run. Thus, only one batch of the input resides in memory at a time. As both inputs are
+    processed concurrently, a batch may use half of the memory budget. contains_discarded_null is set if a materialized
+    element has been left behind by a discarded NULL value (see AntiNullAsTrue).
+  */
+  template <typename T, bool retain_null_values>
+  SpilledRadixContainer _materialize_and_spill(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                                               std::chrono::nanoseconds& materialization_time,
+                                               std::chrono::nanoseconds& partitioning_time,
+                                               bool& contains_discarded_null) const {
+    // A batch holds the materialized and the partitioned elements, plus the intermediate result of the first pass if
+    // the elements are partitioned in two passes
+    const auto copy_count = _radix_bits > _max_radix_bits_per_pass ? 3.0 : 2.0;
+    const auto bytes_per_row = copy_count * static_cast<double>(sizeof(PartitionedElement<T>));
+    const auto batch_memory_budget = static_cast<double>(*_spill_memory_budget) / 2.0;
+
+    auto spilled_container = create_spilled_radix_container(size_t{1} << _radix_bits, retain_null_values);
+
+    const auto chunk_count = in_table->chunk_count();
+    auto begin_chunk_id = ChunkID{0};
+    while (begin_chunk_id < chunk_count) {
+      // Collect chunks as long as they fit into the budget, but at least one
+      auto end_chunk_id = begin_chunk_id;
+      auto chunk_offsets = std::vector<size_t>{};
+      auto row_count = size_t{0};
+      while (end_chunk_id < chunk_count) {
+        const auto chunk_size = in_table->get_chunk(end_chunk_id)->size();
+        if (end_chunk_id > begin_chunk_id &&
+            static_cast<double>(row_count + chunk_size) * bytes_per_row > batch_memory_budget) {
+          break;
+        }
+        chunk_offsets.emplace_back(row_count);
+        row_count += chunk_size;
+        ++end_chunk_id;
+      }
+
+      Timer timer;
+      auto histograms = std::vector<std::vector<size_t>>{};
+      auto materialized = materialize_input<T, HashedType, retain_null_values>(
+          in_table, column_id, chunk_offsets, histograms, _radix_bits, _memory_resource(), begin_chunk_id);
+      materialization_time += timer.lap();
+
+      if (!retain_null_values && _mode == JoinMode::AntiNullAsTrue) {
+        contains_discarded_null |=
+            std::any_of(materialized.elements->begin(), materialized.elements->end(),
+                        [](const auto& element) { return element.row_id == NULL_ROW_ID; });
+      }
+
+      const auto partitioned = partition_radix_parallel<T, HashedType, retain_null_values>(
+          materialized, chunk_offsets, histograms, _radix_bits, _max_radix_bits_per_pass, _memory_resource());
+      materialized = {};
+      spill_partitions(partitioned, spilled_container);
+      partitioning_time += timer.lap();
+
+      begin_chunk_id = end_chunk_id;
+    }
+
+    return spilled_container;
+  }
+
   std::shared_ptr<const Table> _on_execute() override {
-    auto right_in_table = _right->get_output();
+    _right_in_table = _right->get_output();
     auto left_in_table = _left->get_output();
 
     _output_table = _join_hash._initialize_output_table();
 
+    auto& performance_data = static_cast<PerformanceData&>(*_join_hash._performance_data);
+    performance_data.radix_bits = _radix_bits;
+
     /*
      * This flag is used in the materialization and probing phases.
      * When dealing with an OUTER join, we need to make sure that we keep the NULL values for the outer relation.
@@ -199,11 +540,6 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     const auto retain_nulls =
         (_mode == JoinMode::Left || _mode == JoinMode::Right || _mode == JoinMode::AntiNullAsFalse);
 
-    // Pre-partitioning:
-    // Save chunk offsets into the input relation.
-    const auto left_chunk_offsets = determine_chunk_offsets(left_in_table);
-    const auto right_chunk_offsets = determine_chunk_offsets(right_in_table);
-
     // Containers used to store histograms for (potentially subsequent) radix
     // partitioning phase (in cases _radix_bits > 0). Created during materialization phase.
     std::vector<std::vector<size_t>> histograms_left;
@@ -215,11 +551,39 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     RadixContainer<LeftType> materialized_left;
     RadixContainer<RightType> materialized_right;
 
+    // Pre-partitioning:
+    // Save chunk offsets into the input relation.
+    const auto left_chunk_offsets = determine_chunk_offsets(left_in_table);
+
+    // If chunks of the probe side can be pruned based on the values of the build side, the build side is materialized
+    // first. This gives up some parallelism, but saves materializing (and probing) the pruned chunks.
+    const auto prune_probe_side = _probe_side_can_be_pruned();
+    if (prune_probe_side) {
+      Timer timer;
+      materialized_left = materialize_input<LeftType, HashedType, false>(
+          left_in_table, _column_ids.first, left_chunk_offsets, histograms_left, _radix_bits, _memory_resource());
+      performance_data.build_side_materialization = timer.lap();
+
+      _right_in_table = _prune_probe_side(materialized_left);
+
+      // No chunk of the probe side can contain a match
+      if (_right_in_table->chunk_count() == 0) return _output_table;
+    }
+
+    const auto& right_in_table = _right_in_table;
+    const auto right_chunk_offsets = determine_chunk_offsets(right_in_table);
+
     // Containers for potential (skipped when left side small) radix partitioning phase
     RadixContainer<LeftType> radix_left;
     RadixContainer<RightType> radix_right;
     std::vector<std::optional<HashTable<HashedType>>> hashtables;
 
+    // Only used if the partitions are spilled to disk
+    SpilledRadixContainer spilled_left;
+    SpilledRadixContainer spilled_right;
+
+    auto left_contains_null = false;
+
     // Depiction of the hash join parallelization (radix partitioning can be skipped when radix_bits = 0)
     // ===============================================================================================
     // We have two data paths, one for left side and one for right input side. We can prepare (i.e.,
@@ -245,45 +609,89 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
     // Pre-Probing path of left relation
     jobs.emplace_back(std::make_shared<JobTask>([&]() {
-      // materialize left table (NULLs are always discarded for the build side)
-      materialized_left = materialize_input<LeftType, HashedType, false>(
-          left_in_table, _column_ids.first, left_chunk_offsets, histograms_left, _radix_bits);
+      // If the partitions are spilled, the hash tables are built partition by partition later on
+      if (_spill_memory_budget) {
+        spilled_left = _materialize_and_spill<LeftType, false>(
+            left_in_table, _column_ids.first, performance_data.build_side_materialization,
+            performance_data.build_side_partitioning, left_contains_null);
+        return;
+      }
+
+      Timer timer;
+
+      // materialize left table (NULLs are always discarded for the build side), unless this was done for pruning
+      if (!prune_probe_side) {
+        materialized_left = materialize_input<LeftType, HashedType, false>(
+            left_in_table, _column_ids.first, left_chunk_offsets, histograms_left, _radix_bits, _memory_resource());
+        performance_data.build_side_materialization = timer.lap();
+      }
+
+      // Discarded NULL values leave elements without a RowID, see AntiNullAsTrue below
+      if (_mode == JoinMode::AntiNullAsTrue) {
+        left_contains_null =
+            std::any_of(materialized_left.elements->begin(), materialized_left.elements->end(),
+                        [](const auto& element) { return element.row_id == NULL_ROW_ID; });
+      }
 
       if (_radix_bits > 0) {
         // radix partition the left table
-        radix_left = partition_radix_parallel<LeftType, HashedType, false>(materialized_left, left_chunk_offsets,
-                                                                           histograms_left, _radix_bits);
+        radix_left = partition_radix_parallel<LeftType, HashedType, false>(
+            materialized_left, left_chunk_offsets, histograms_left, _radix_bits, _max_radix_bits_per_pass,
+            _memory_resource());
+        performance_data.build_side_partitioning = timer.lap();
       } else {
         // short cut: skip radix partitioning and use materialized data directly
         radix_left = std::move(materialized_left);
       }
 
       // build hash tables
-      hashtables = build<LeftType, HashedType>(radix_left);
+      hashtables = build<LeftType, HashedType>(radix_left, _memory_resource());
+      performance_data.build = timer.lap();
     }));
     jobs.back()->schedule();
 
     jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      if (_spill_memory_budget) {
+        // Discarded NULL values of the probe side are irrelevant
+        auto right_contains_null = false;
+        if (retain_nulls) {
+          spilled_right = _materialize_and_spill<RightType, true>(
+              right_in_table, _column_ids.second, performance_data.probe_side_materialization,
+              performance_data.probe_side_partitioning, right_contains_null);
+        } else {
+          spilled_right = _materialize_and_spill<RightType, false>(
+              right_in_table, _column_ids.second, performance_data.probe_side_materialization,
+              performance_data.probe_side_partitioning, right_contains_null);
+        }
+        return;
+      }
+
+      Timer timer;
+
       // Materialize right table. The third template parameter signals if the relation on the right (probe
       // relation) materializes NULL values when executing OUTER joins (default is to discard NULL values).
       if (retain_nulls) {
         materialized_right = materialize_input<RightType, HashedType, true>(
-            right_in_table, _column_ids.second, right_chunk_offsets, histograms_right, _radix_bits);
+            right_in_table, _column_ids.second, right_chunk_offsets, histograms_right, _radix_bits, _memory_resource());
       } else {
         materialized_right = materialize_input<RightType, HashedType, false>(
-            right_in_table, _column_ids.second, right_chunk_offsets, histograms_right, _radix_bits);
+            right_in_table, _column_ids.second, right_chunk_offsets, histograms_right, _radix_bits, _memory_resource());
       }
+      performance_data.probe_side_materialization = timer.lap();
 
       if (_radix_bits > 0) {
         // radix partition the right table. 'retain_nulls' makes sure that the
         // relation on the right keeps NULL values when executing an OUTER join.
         if (retain_nulls) {
-          radix_right = partition_radix_parallel<RightType, HashedType, true>(materialized_right, right_chunk_offsets,
-                                                                              histograms_right, _radix_bits);
+          radix_right = partition_radix_parallel<RightType, HashedType, true>(
+              materialized_right, right_chunk_offsets, histograms_right, _radix_bits, _max_radix_bits_per_pass,
+              _memory_resource());
         } else {
-          radix_right = partition_radix_parallel<RightType, HashedType, false>(materialized_right, right_chunk_offsets,
-                                                                               histograms_right, _radix_bits);
+          radix_right = partition_radix_parallel<RightType, HashedType, false>(
+              materialized_right, right_chunk_offsets, histograms_right, _radix_bits, _max_radix_bits_per_pass,
+              _memory_resource());
         }
+        performance_data.probe_side_partitioning = timer.lap();
       } else {
         // short cut: skip radix partitioning and use materialized data directly
         radix_right = std::move(materialized_right);
@@ -293,69 +701,40 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
     CurrentScheduler::wait_for_tasks(jobs);
 
+    if (_spill_memory_budget) {
+      performance_data.spilled_bytes = spilled_left.file_size + spilled_right.file_size;
+    }
+
     // (Hacky) short cut for AntiNullAsTrue
     //          If there is any NULL value on the left side, do not bother probe as no tuples can be emitted
     //          anyway. Doing this early out here is hacky, but during probing we assume NULL values on the left
     //          side do not matter, so we'd have no chance detecting a NULL value on the left side there.
-    if (_mode == JoinMode::AntiNullAsTrue) {
-      auto any_null = false;
-      for (const auto& element : *radix_left.elements) {
-        if (element.row_id == NULL_ROW_ID) {
-          any_null = true;
-          break;
-        }
-      }
-
-      if (any_null) {
-        return _output_table;
-      }
+    if (_mode == JoinMode::AntiNullAsTrue && left_contains_null) {
+      return _output_table;
     }
 
     // Probe phase
+    Timer timer;
     std::vector<PosList> left_pos_lists;
     std::vector<PosList> right_pos_lists;
-    const size_t partition_count = radix_right.partition_offsets.size();
+    const size_t partition_count =
+        _spill_memory_budget ? spilled_right.partition_offsets.size() : radix_right.partition_offsets.size();
     left_pos_lists.resize(partition_count);
     right_pos_lists.resize(partition_count);
 
     // simple heuristic: half of the rows of the right relation will match
-    const size_t result_rows_per_partition = _right->get_output()->row_count() / partition_count / 2;
+    const size_t result_rows_per_partition = right_in_table->row_count() / partition_count / 2;
     for (size_t i = 0; i < partition_count; i++) {
       left_pos_lists[i].reserve(result_rows_per_partition);
       right_pos_lists[i].reserve(result_rows_per_partition);
     }
 
-    /*
-    NUMA notes:
-    The workers for each radix partition P should be scheduled on the same node as the input data:
-    leftP, rightP and hashtableP.
-    */
-    switch (_mode) {
-      case JoinMode::Inner:
-        probe<RightType, HashedType, false>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode,
-                                            *left_in_table, *right_in_table, _secondary_join_predicates);
-        break;
-
-      case JoinMode::Left:
-      case JoinMode::Right:
-        probe<RightType, HashedType, true>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode,
-                                           *left_in_table, *right_in_table, _secondary_join_predicates);
-        break;
-
-      case JoinMode::Semi:
-      case JoinMode::AntiNullAsTrue:
-        probe_semi_anti<RightType, HashedType, false>(radix_right, hashtables, right_pos_lists, _mode, *left_in_table,
-                                                      *right_in_table, _secondary_join_predicates);
-        break;
-
-      case JoinMode::AntiNullAsFalse:
-        probe_semi_anti<RightType, HashedType, true>(radix_right, hashtables, right_pos_lists, _mode, *left_in_table,
-                                                     *right_in_table, _secondary_join_predicates);
-        break;
-
-      default:
-        Fail("JoinMode not supported by JoinHash");
+    if (_spill_memory_budget) {
+      _probe_spilled_partitions(spilled_left, spilled_right, left_pos_lists, right_pos_lists, _radix_bits, 0);
+    } else {
+      _probe(radix_right, hashtables, left_pos_lists, right_pos_lists);
     }
+    performance_data.probe = timer.lap();
 
     auto only_output_right_input = _inputs_swapped && (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue ||
                                                        _mode == JoinMode::AntiNullAsFalse);
@@ -391,6 +770,16 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       right_pos_lists_by_segment = setup_pos_lists_by_segment(right_in_table);
     }
 
+    // Semi/Anti joins only output the probe side, which is in input order already
+    if (_join_hash._output_order == OutputOrder::GroupedByChunk) {
+      for (size_t partition_id = 0; partition_id < left_pos_lists.size(); ++partition_id) {
+        if (left_pos_lists[partition_id].empty()) continue;
+        group_matches_by_chunk(left_pos_lists[partition_id], right_pos_lists[partition_id],
+                               left_in_table->chunk_count());
+      }
+      performance_data.output_reordering = timer.lap();
+    }
+
     // for every partition create a reference segment
     for (size_t partition_id = 0; partition_id < left_pos_lists.size(); ++partition_id) {
       // moving the values into a shared pos list saves us some work in write_output_segments. We know that
@@ -402,6 +791,9 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         continue;
       }
 
+      guarantee_single_chunk_if_applicable(*left);
+      guarantee_single_chunk_if_applicable(*right);
+
       Segments output_segments;
 
       // we need to swap back the inputs, so that the order of the output columns is not harmed
@@ -419,6 +811,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
       _output_table->append_chunk(output_segments);
     }
+    performance_data.output_writing = timer.lap();
 
     return _output_table;
   }
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <chrono>
 #include <optional>
+#include <string>
 
 #include "abstract_join_operator.hpp"
 #include "operator_join_predicate.hpp"
@@ -21,13 +23,43 @@ namespace opossum {
  */
 class JoinHash : public AbstractJoinOperator {
  public:
+  /**
+   * Each output chunk holds the matches of one radix partition. On the build side, these reference the input chunks
+   * in the random order of the hash table. If the output is going to be materialized (e.g., by an aggregate), the
+   * matches can be grouped by the build side chunk that they reference, so that the later accesses to each input chunk
+   * are batched. The probe side stays in its input order within each group.
+   */
+  enum class OutputOrder { Partitioned, GroupedByChunk };
+
   JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
            const JoinMode mode, const OperatorJoinPredicate& primary_predicate,
            const std::optional<size_t>& radix_bits = std::nullopt,
-           const std::vector<OperatorJoinPredicate>& secondary_predicates = {});
+           const std::vector<OperatorJoinPredicate>& secondary_predicates = {},
+           const OutputOrder output_order = OutputOrder::Partitioned);
+
+  OutputOrder output_order() const;
 
   const std::string name() const override;
 
+  // Runtimes of the steps depicted in JoinHashImpl::_on_execute(). The build and the probe side are materialized and
+  // partitioned concurrently, so their runtimes overlap.
+  struct PerformanceData : public OperatorPerformanceData {
+    std::chrono::nanoseconds build_side_materialization{0};
+    std::chrono::nanoseconds build_side_partitioning{0};
+    std::chrono::nanoseconds probe_side_materialization{0};
+    std::chrono::nanoseconds probe_side_partitioning{0};
+    std::chrono::nanoseconds build{0};
+    std::chrono::nanoseconds probe{0};
+    std::chrono::nanoseconds output_reordering{0};
+    std::chrono::nanoseconds output_writing{0};
+    size_t radix_bits{0};
+
+    // Size of the partitions that were spilled to disk because the join exceeded the memory budget of the query
+    size_t spilled_bytes{0};
+
+    std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const override;
+  };
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -38,6 +70,7 @@ class JoinHash : public AbstractJoinOperator {
 
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
   const std::optional<size_t> _radix_bits;
+  const OutputOrder _output_order;
 
   template <typename LeftType, typename RightType>
   class JoinHashImpl;
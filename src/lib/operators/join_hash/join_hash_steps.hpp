@@ -1,5 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <boost/container/pmr/global_resource.hpp>
+
 #include <boost/container/small_vector.hpp>
 #include <boost/lexical_cast.hpp>
 
@@ -38,10 +47,22 @@ struct PartitionedElement {
 };
 
 // Initializing the partition vector takes some time. This is not necessary, because it will be overwritten anyway.
-// The uninitialized_vector behaves like a regular std::vector, but the entries are initially invalid.
+// The uninitialized_vector behaves like a regular std::vector, but the entries are initially invalid. Partitions are
+// allocated through a PolymorphicAllocator so that they count towards the memory budget of the join (see
+// TrackingMemoryResource).
 template <typename T>
-using Partition = std::conditional_t<std::is_trivially_destructible_v<T>, uninitialized_vector<PartitionedElement<T>>,
-                                     std::vector<PartitionedElement<T>>>;
+using Partition =
+    std::conditional_t<std::is_trivially_destructible_v<T>,
+                       uninitialized_vector<PartitionedElement<T>, PolymorphicAllocator<PartitionedElement<T>>>,
+                       std::vector<PartitionedElement<T>, PolymorphicAllocator<PartitionedElement<T>>>>;
+
+template <typename T>
+std::shared_ptr<Partition<T>> make_partition(const size_t size,
+                                             boost::container::pmr::memory_resource* memory_resource) {
+  auto partition = std::make_shared<Partition<T>>(PolymorphicAllocator<PartitionedElement<T>>{memory_resource});
+  partition->resize(size);
+  return partition;
+}
 
 // The small_vector holds the first n values in local storage and only resorts to heap storage after that. 1 is chosen
 // as n because in many cases, we join on primary key attributes where by definition we have only one match on the
@@ -50,8 +71,11 @@ using SmallPosList = boost::container::small_vector<RowID, 1>;
 
 // In case we consider runtime to be more relevant, the flat hash map performs better (measured to be mostly on par
 // with bytell hash map and in some cases up to 5% faster) but is significantly larger than the bytell hash map.
+// The hash tables are allocated through a PolymorphicAllocator so that their memory consumption can be tracked (see
+// TrackingMemoryResource).
 template <typename T>
-using HashTable = ska::bytell_hash_map<T, SmallPosList>;
+using HashTable = ska::bytell_hash_map<T, SmallPosList, std::hash<T>, std::equal_to<T>,
+                                       PolymorphicAllocator<std::pair<T, SmallPosList>>>;
 
 /*
 This struct contains radix-partitioned data in a contiguous buffer, as well as a list of offsets for each partition.
@@ -87,17 +111,30 @@ inline std::vector<size_t> determine_chunk_offsets(const std::shared_ptr<const T
   return chunk_offsets;
 }
 
+/*
+Materializes the chunks of the input that chunk_offsets refers to. By default, these are all chunks of the input. To
+materialize a batch of chunks only, begin_chunk_id denotes the first chunk of the batch and chunk_offsets holds the
+offsets of the batch's chunks within the batch.
+*/
 template <typename T, typename HashedType, bool retain_null_values>
-RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, ColumnID column_id,
-                                    const std::vector<size_t>& chunk_offsets,
-                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits) {
+RadixContainer<T> materialize_input(
+    const std::shared_ptr<const Table>& in_table, ColumnID column_id, const std::vector<size_t>& chunk_offsets,
+    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
+    boost::container::pmr::memory_resource* memory_resource = boost::container::pmr::get_default_resource(),
+    const ChunkID begin_chunk_id = ChunkID{0}) {
   const std::hash<HashedType> hash_function;
+  const auto chunk_count = chunk_offsets.size();
+  const auto row_count =
+      chunk_count == 0
+          ? size_t{0}
+          : chunk_offsets.back() + in_table->get_chunk(ChunkID{begin_chunk_id + chunk_count - 1})->size();
+
   // list of all elements that will be partitioned
-  auto elements = std::make_shared<Partition<T>>(in_table->row_count());
+  auto elements = make_partition<T>(row_count, memory_resource);
 
   [[maybe_unused]] auto null_value_bitvector = std::make_shared<std::vector<bool>>();
   if constexpr (retain_null_values) {
-    null_value_bitvector->resize(in_table->row_count());
+    null_value_bitvector->resize(row_count);
   }
 
   // fan-out
@@ -111,12 +148,14 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   histograms.resize(chunk_offsets.size());
 
   std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(in_table->chunk_count());
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_index]() {
+      const auto chunk_id = ChunkID{begin_chunk_id + chunk_index};
 
-  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
       // Get information from work queue
-      auto output_offset = chunk_offsets[chunk_id];
+      auto output_offset = chunk_offsets[chunk_index];
       auto output_iterator = elements->begin() + output_offset;
       auto segment = in_table->get_chunk(chunk_id)->get_segment(column_id);
 
@@ -169,15 +208,15 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
         }
       });
 
-      if constexpr (std::is_same_v<Partition<T>, uninitialized_vector<PartitionedElement<T>>>) {  // NOLINT
+      if constexpr (std::is_trivially_destructible_v<T>) {
         // Because the vector is uninitialized, we need to manually fill up all slots that we did not use
-        auto output_offset_end = chunk_id < chunk_offsets.size() - 1 ? chunk_offsets[chunk_id + 1] : elements->size();
+        auto output_offset_end = chunk_index < chunk_count - 1 ? chunk_offsets[chunk_index + 1] : elements->size();
         while (output_iterator != elements->begin() + output_offset_end) {
           *(output_iterator++) = PartitionedElement<T>{};
         }
       }
 
-      histograms[chunk_id] = std::move(histogram);
+      histograms[chunk_index] = std::move(histogram);
     }));
     jobs.back()->schedule();
   }
@@ -190,7 +229,9 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
 Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left
 */
 template <typename LeftType, typename HashedType>
-std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<LeftType>& radix_container) {
+std::vector<std::optional<HashTable<HashedType>>> build(
+    const RadixContainer<LeftType>& radix_container,
+    boost::container::pmr::memory_resource* memory_resource = boost::container::pmr::get_default_resource()) {
   /*
   NUMA notes:
   The hashtables for each partition P should also reside on the same node as the two vectors leftP and rightP.
@@ -218,7 +259,9 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Lef
       auto& partition_left = static_cast<Partition<LeftType>&>(*radix_container.elements);
 
       // slightly oversize the hash table to avoid unnecessary rebuilds
-      auto hashtable = HashTable<HashedType>(static_cast<size_t>(partition_size * 1.2));
+      const auto allocator = PolymorphicAllocator<std::pair<HashedType, SmallPosList>>{memory_resource};
+      auto hashtable = HashTable<HashedType>(static_cast<size_t>(partition_size * 1.2), std::hash<HashedType>{},
+                                             std::equal_to<HashedType>{}, allocator);
 
       for (size_t partition_offset = partition_left_begin; partition_offset < partition_left_end; ++partition_offset) {
         auto& element = partition_left[partition_offset];
@@ -247,10 +290,87 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Lef
   return hashtables;
 }
 
+/*
+Scatters the elements in [begin, end) of the input to their partitions, starting at the given output offsets (which are
+advanced accordingly). For a high fan-out, writing each element directly to its output position touches a different
+cache line and page for almost every element. Thus, elements of trivially copyable types are first collected in a
+small buffer per partition that holds a cache line worth of elements. Only full buffers are written to the output, so
+that the stores to the output are sequential per partition and the buffers stay cache-resident (software
+write-combining). If NULL flags have to be scattered as well, elements are written directly.
+*/
+template <typename T, bool retain_null_values, typename PartitionIDFunctor>
+void scatter_partitioned_elements(const Partition<T>& input, [[maybe_unused]] const std::vector<bool>& input_nulls,
+                                  const size_t begin, const size_t end, Partition<T>& output,
+                                  [[maybe_unused]] std::vector<bool>& output_nulls, std::vector<size_t>& output_offsets,
+                                  const PartitionIDFunctor& partition_id_functor) {
+  if constexpr (std::is_trivially_copyable_v<PartitionedElement<T>> && !retain_null_values) {
+    constexpr auto BUFFER_SIZE = std::max(size_t{1}, size_t{64} / sizeof(PartitionedElement<T>));
+
+    const auto num_partitions = output_offsets.size();
+    auto buffers = std::vector<PartitionedElement<T>>(num_partitions * BUFFER_SIZE);
+    auto buffer_sizes = std::vector<size_t>(num_partitions);
+
+    const auto flush = [&](const size_t partition_id) {
+      std::copy_n(buffers.begin() + partition_id * BUFFER_SIZE, buffer_sizes[partition_id],
+                  output.begin() + output_offsets[partition_id]);
+      output_offsets[partition_id] += buffer_sizes[partition_id];
+      buffer_sizes[partition_id] = 0;
+    };
+
+    for (auto input_offset = begin; input_offset < end; ++input_offset) {
+      const auto& element = input[input_offset];
+      if (element.row_id == NULL_ROW_ID) continue;
+
+      const auto partition_id = partition_id_functor(element);
+      buffers[partition_id * BUFFER_SIZE + buffer_sizes[partition_id]] = element;
+      if (++buffer_sizes[partition_id] == BUFFER_SIZE) flush(partition_id);
+    }
+
+    for (auto partition_id = size_t{0}; partition_id < num_partitions; ++partition_id) {
+      flush(partition_id);
+    }
+  } else {
+    for (auto input_offset = begin; input_offset < end; ++input_offset) {
+      const auto& element = input[input_offset];
+
+      // In case of NULL-removing inner-joins, we ignore all NULL values.
+      // Such values can be created in several ways: join input already has non-phyiscal NULL values (non-physical
+      // means no RowID, e.g., created during an OUTER join), a physical value is NULL but is ignored for an inner
+      // join (hence, we overwrite the RowID with NULL_ROW_ID), or it is simply a remainder of the pre-sized
+      // RadixPartition which is initialized with default values (i.e., NULL_ROW_IDs).
+      if (!retain_null_values && element.row_id == NULL_ROW_ID) {
+        continue;
+      }
+
+      const auto partition_id = partition_id_functor(element);
+
+      // In case NULL values have been materialized in materialize_input(),
+      // we need to keep them during the radix clustering phase.
+      if constexpr (retain_null_values) {
+        output_nulls[output_offsets[partition_id]] = input_nulls[input_offset];
+      }
+
+      output[output_offsets[partition_id]] = element;
+      ++output_offsets[partition_id];
+    }
+  }
+}
+
+/*
+Partitions the materialized elements by the lowest radix_bits bits of their hashes. Each partition that is written to
+needs a TLB entry for its current output page. Thus, if the fan-out exceeds the number of partitions that can be
+written with max_radix_bits_per_pass bits (usually chosen so that 2^bits does not exceed the number of TLB entries),
+the elements are partitioned in two passes: the first pass partitions them by the upper bits, the second pass
+partitions each of the resulting partitions by the lower bits. As the partitions of the first pass are contiguous, the
+result is the same as for a single pass.
+*/
 template <typename T, typename HashedType, bool retain_null_values>
 RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_container,
                                            const std::vector<size_t>& chunk_offsets,
-                                           std::vector<std::vector<size_t>>& histograms, const size_t radix_bits) {
+                                           std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
+                                           const size_t max_radix_bits_per_pass = std::numeric_limits<size_t>::max(),
+                                           boost::container::pmr::memory_resource* memory_resource =
+                                               boost::container::pmr::get_default_resource()) {
   if constexpr (retain_null_values) {
     DebugAssert(radix_container.null_value_bitvector->size() == radix_container.elements->size(),
                 "partition_radix_parallel() called with NULL consideration but radix container does not store any NULL "
@@ -261,20 +381,22 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
 
   // materialized items of radix container
   const auto& container_elements = *radix_container.elements;
-  [[maybe_unused]] const auto& null_value_bitvector = *radix_container.null_value_bitvector;
+  const auto& null_value_bitvector = *radix_container.null_value_bitvector;
 
   // fan-out
   const size_t num_partitions = 1ull << radix_bits;
 
-  // currently, we just do one pass
-  size_t pass = 0;
-  size_t mask = static_cast<uint32_t>(pow(2, radix_bits * (pass + 1)) - 1);
+  // The second pass uses the lower bits, so that the first pass only needs to shift the hash
+  const auto first_pass_radix_bits = radix_bits > max_radix_bits_per_pass ? (radix_bits + 1) / 2 : radix_bits;
+  const auto second_pass_radix_bits = radix_bits - first_pass_radix_bits;
+  const size_t first_pass_num_partitions = 1ull << first_pass_radix_bits;
+  const size_t first_pass_mask = first_pass_num_partitions - 1;
+  const size_t second_pass_mask = (1ull << second_pass_radix_bits) - 1;
 
   // allocate new (shared) output
-  auto output = std::make_shared<Partition<T>>();
-  output->resize(container_elements.size());
+  auto output = make_partition<T>(container_elements.size(), memory_resource);
 
-  [[maybe_unused]] auto output_nulls = std::make_shared<std::vector<bool>>();
+  auto output_nulls = std::make_shared<std::vector<bool>>();
   if constexpr (retain_null_values) {
     output_nulls->resize(null_value_bitvector.size());
   }
@@ -284,62 +406,356 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
   radix_output.partition_offsets.resize(num_partitions);
   radix_output.null_value_bitvector = output_nulls;
 
+  // The first pass writes to an intermediate buffer unless it already is the only pass
+  auto first_pass_output = output;
+  auto first_pass_output_nulls = output_nulls;
+  if (second_pass_radix_bits > 0) {
+    first_pass_output = make_partition<T>(container_elements.size(), memory_resource);
+    first_pass_output_nulls = std::make_shared<std::vector<bool>>(output_nulls->size());
+  }
+
   // use histograms to calculate partition offsets
   size_t offset = 0;
-  std::vector<std::vector<size_t>> output_offsets_by_chunk(chunk_offsets.size(), std::vector<size_t>(num_partitions));
   for (size_t partition_id = 0; partition_id < num_partitions; ++partition_id) {
     for (ChunkID chunk_id{0}; chunk_id < chunk_offsets.size(); ++chunk_id) {
-      output_offsets_by_chunk[chunk_id][partition_id] = offset;
       offset += histograms[chunk_id][partition_id];
     }
     radix_output.partition_offsets[partition_id] = offset;
   }
 
+  // The output offsets of the first pass per chunk. A partition of the first pass covers 2^second_pass_radix_bits
+  // partitions of the final output.
+  offset = 0;
+  std::vector<std::vector<size_t>> output_offsets_by_chunk(chunk_offsets.size(),
+                                                           std::vector<size_t>(first_pass_num_partitions));
+  for (size_t first_pass_partition_id = 0; first_pass_partition_id < first_pass_num_partitions;
+       ++first_pass_partition_id) {
+    for (ChunkID chunk_id{0}; chunk_id < chunk_offsets.size(); ++chunk_id) {
+      output_offsets_by_chunk[chunk_id][first_pass_partition_id] = offset;
+      for (auto partition_id = first_pass_partition_id << second_pass_radix_bits;
+           partition_id <= (first_pass_partition_id << second_pass_radix_bits | second_pass_mask); ++partition_id) {
+        offset += histograms[chunk_id][partition_id];
+      }
+    }
+  }
+
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(chunk_offsets.size());
 
   for (ChunkID chunk_id{0}; chunk_id < chunk_offsets.size(); ++chunk_id) {
     jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
-      size_t input_offset = chunk_offsets[chunk_id];
-      auto& output_offsets = output_offsets_by_chunk[chunk_id];
+      const auto input_begin = chunk_offsets[chunk_id];
+      const auto input_end =
+          chunk_id < chunk_offsets.size() - 1 ? chunk_offsets[chunk_id + 1] : container_elements.size();
+
+      scatter_partitioned_elements<T, retain_null_values>(
+          container_elements, null_value_bitvector, input_begin, input_end, *first_pass_output,
+          *first_pass_output_nulls, output_offsets_by_chunk[chunk_id], [&](const PartitionedElement<T>& element) {
+            return (hash_function(type_cast<HashedType>(element.value)) >> second_pass_radix_bits) & first_pass_mask;
+          });
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  if (second_pass_radix_bits == 0) return radix_output;
+
+  // Second pass: partition each partition of the first pass by the lower bits
+  jobs.clear();
+  jobs.reserve(first_pass_num_partitions);
+
+  for (auto first_pass_partition_id = size_t{0}; first_pass_partition_id < first_pass_num_partitions;
+       ++first_pass_partition_id) {
+    const auto first_partition_id = first_pass_partition_id << second_pass_radix_bits;
+    const auto input_begin =
+        first_partition_id == 0 ? size_t{0} : radix_output.partition_offsets[first_partition_id - 1];
+    const auto input_end = radix_output.partition_offsets[first_partition_id + second_pass_mask];
+    if (input_begin == input_end) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, first_partition_id, input_begin, input_end]() {
+      auto output_offsets = std::vector<size_t>(second_pass_mask + 1);
+      output_offsets[0] = input_begin;
+      for (auto partition_id = size_t{1}; partition_id < output_offsets.size(); ++partition_id) {
+        output_offsets[partition_id] = radix_output.partition_offsets[first_partition_id + partition_id - 1];
+      }
+
+      scatter_partitioned_elements<T, retain_null_values>(
+          *first_pass_output, *first_pass_output_nulls, input_begin, input_end, *output, *output_nulls,
+          output_offsets, [&](const PartitionedElement<T>& element) {
+            return hash_function(type_cast<HashedType>(element.value)) & second_pass_mask;
+          });
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  return radix_output;
+}
+
+/*
+Partitions the elements of a RadixContainer by the radix_bits bits of their hashes that start at bit hash_shift. This
+is used to split a partition that is too large to be processed within the memory budget of the join (see
+JoinHash). As this only happens for single partitions, it is not parallelized.
+*/
+template <typename T, typename HashedType>
+RadixContainer<T> partition_by_hash_bits(
+    const RadixContainer<T>& radix_container, const size_t hash_shift, const size_t radix_bits,
+    boost::container::pmr::memory_resource* memory_resource = boost::container::pmr::get_default_resource()) {
+  const std::hash<HashedType> hash_function;
+  const auto& elements = *radix_container.elements;
+  const auto& null_value_bitvector = *radix_container.null_value_bitvector;
+  const auto has_null_values = !null_value_bitvector.empty();
+  const auto element_count =
+      radix_container.partition_offsets.empty() ? size_t{0} : radix_container.partition_offsets.back();
+
+  const size_t num_partitions = 1ull << radix_bits;
+  const size_t mask = num_partitions - 1;
+  const auto partition_id_of = [&](const PartitionedElement<T>& element) {
+    return (hash_function(type_cast<HashedType>(element.value)) >> hash_shift) & mask;
+  };
+
+  RadixContainer<T> radix_output;
+  radix_output.elements = make_partition<T>(element_count, memory_resource);
+  radix_output.null_value_bitvector = std::make_shared<std::vector<bool>>(has_null_values ? element_count : 0);
+  radix_output.partition_offsets.resize(num_partitions);
+
+  for (auto offset = size_t{0}; offset < element_count; ++offset) {
+    ++radix_output.partition_offsets[partition_id_of(elements[offset])];
+  }
+  std::partial_sum(radix_output.partition_offsets.begin(), radix_output.partition_offsets.end(),
+                   radix_output.partition_offsets.begin());
+
+  auto output_offsets = std::vector<size_t>(num_partitions);
+  std::copy(radix_output.partition_offsets.begin(), radix_output.partition_offsets.end() - 1,
+            output_offsets.begin() + 1);
+
+  for (auto offset = size_t{0}; offset < element_count; ++offset) {
+    const auto output_offset = output_offsets[partition_id_of(elements[offset])]++;
+    (*radix_output.elements)[output_offset] = elements[offset];
+    if (has_null_values) (*radix_output.null_value_bitvector)[output_offset] = null_value_bitvector[offset];
+  }
+
+  return radix_output;
+}
+
+/*
+To bound the memory consumption of the join, partitioned elements can be spilled to a temporary file and be loaded
+again partition by partition (Grace hash join). The file is removed automatically once the last SpilledRadixContainer
+that refers to it is destroyed.
+
+The partitions are spilled in runs, so that an input can be materialized, partitioned, and spilled batch by batch
+without ever residing in memory as a whole. Each run holds all partitions, i.e., the elements of a partition are spread
+across the runs.
+*/
+struct SpilledRadixContainer {
+  std::shared_ptr<FILE> file;
+
+  // Same as in RadixContainer, accumulated over all runs
+  std::vector<size_t> partition_offsets;
+
+  // Per run, the partition offsets of the run, as in RadixContainer
+  std::vector<std::vector<size_t>> run_partition_offsets;
+
+  // Per run, the position of each partition in the file, followed by the end of the run
+  std::vector<std::vector<size_t>> partition_file_offsets;
 
-      size_t input_size = 0;
-      if (chunk_id < chunk_offsets.size() - 1) {
-        input_size = chunk_offsets[chunk_id + 1] - input_offset;
+  size_t file_size{0};
+
+  bool has_null_values{false};
+};
+
+// Creates a SpilledRadixContainer without any runs, see spill_partitions()
+inline SpilledRadixContainer create_spilled_radix_container(const size_t partition_count,
+                                                            const bool has_null_values) {
+  SpilledRadixContainer spilled_container;
+  spilled_container.file = std::shared_ptr<FILE>(std::tmpfile(), [](FILE* file) {
+    if (file) std::fclose(file);
+  });
+  Assert(spilled_container.file, "Could not create temporary file to spill partitions to");
+
+  spilled_container.partition_offsets.resize(partition_count);
+  spilled_container.has_null_values = has_null_values;
+  return spilled_container;
+}
+
+// Appends the partitions of a RadixContainer to a spilled container as a new run
+template <typename T>
+void spill_partitions(const RadixContainer<T>& radix_container, SpilledRadixContainer& spilled_container) {
+  Assert(radix_container.partition_offsets.size() == spilled_container.partition_offsets.size(),
+         "Spilled runs need to have the same number of partitions");
+
+  const auto& elements = *radix_container.elements;
+  const auto& null_value_bitvector = *radix_container.null_value_bitvector;
+  DebugAssert(spilled_container.has_null_values || null_value_bitvector.empty(),
+              "Spilled container does not store any NULL value information");
+
+  // Each element is stored as its RowID, its NULL flag (only if NULL values are retained), and its value. Strings are
+  // prefixed with their length.
+  auto buffer = std::vector<char>{};
+  const auto append = [&](const void* data, const size_t size) {
+    const auto* const bytes = static_cast<const char*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + size);
+  };
+
+  spilled_container.run_partition_offsets.emplace_back(radix_container.partition_offsets);
+  auto& run_file_offsets = spilled_container.partition_file_offsets.emplace_back();
+  run_file_offsets.reserve(radix_container.partition_offsets.size() + 1);
+
+  auto partition_begin = size_t{0};
+  for (auto partition_id = size_t{0}; partition_id < radix_container.partition_offsets.size(); ++partition_id) {
+    const auto partition_end = radix_container.partition_offsets[partition_id];
+    run_file_offsets.emplace_back(spilled_container.file_size);
+
+    buffer.clear();
+    for (auto offset = partition_begin; offset < partition_end; ++offset) {
+      const auto& element = elements[offset];
+      append(&element.row_id, sizeof(RowID));
+      if (spilled_container.has_null_values) {
+        const auto is_null = static_cast<char>(null_value_bitvector[offset]);
+        append(&is_null, sizeof(char));
+      }
+      if constexpr (std::is_same_v<T, pmr_string>) {
+        const auto size = element.value.size();
+        append(&size, sizeof(size));
+        append(element.value.data(), size);
       } else {
-        input_size = container_elements.size() - input_offset;
+        append(&element.value, sizeof(T));
       }
+    }
 
-      for (size_t chunk_offset = input_offset; chunk_offset < input_offset + input_size; ++chunk_offset) {
-        auto& element = container_elements[chunk_offset];
+    Assert(std::fwrite(buffer.data(), 1, buffer.size(), spilled_container.file.get()) == buffer.size(),
+           "Could not spill partition to temporary file");
+    spilled_container.file_size += buffer.size();
+    // As the offsets are accumulated, the offsets of the run can simply be added
+    spilled_container.partition_offsets[partition_id] += partition_end;
+    partition_begin = partition_end;
+  }
+  run_file_offsets.emplace_back(spilled_container.file_size);
+}
 
-        // In case of NULL-removing inner-joins, we ignore all NULL values.
-        // Such values can be created in several ways: join input already has non-phyiscal NULL values (non-physical
-        // means no RowID, e.g., created during an OUTER join), a physical value is NULL but is ignored for an inner
-        // join (hence, we overwrite the RowID with NULL_ROW_ID), or it is simply a remainder of the pre-sized
-        // RadixPartition which is initialized with default values (i.e., NULL_ROW_IDs).
-        if (!retain_null_values && element.row_id == NULL_ROW_ID) {
-          continue;
-        }
+template <typename T>
+SpilledRadixContainer spill_partitions(const RadixContainer<T>& radix_container) {
+  auto spilled_container = create_spilled_radix_container(radix_container.partition_offsets.size(),
+                                                          !radix_container.null_value_bitvector->empty());
+  spill_partitions(radix_container, spilled_container);
+  return spilled_container;
+}
 
-        const size_t radix = hash_function(type_cast<HashedType>(element.value)) & mask;
+// Loads the partitions [begin_partition_id, end_partition_id) of the runs [begin_run_id, end_run_id) of a spilled
+// container. The elements of each partition are gathered from these runs. Not thread-safe, as all partitions share one
+// file.
+template <typename T>
+RadixContainer<T> load_partitions(
+    const SpilledRadixContainer& spilled_container, const size_t begin_partition_id, const size_t end_partition_id,
+    const size_t begin_run_id, const size_t end_run_id,
+    boost::container::pmr::memory_resource* memory_resource = boost::container::pmr::get_default_resource()) {
+  const auto& run_partition_offsets = spilled_container.run_partition_offsets;
+  const auto& run_file_offsets = spilled_container.partition_file_offsets;
+
+  RadixContainer<T> radix_container;
+  radix_container.partition_offsets.resize(end_partition_id - begin_partition_id);
+  for (auto run_id = begin_run_id; run_id < end_run_id; ++run_id) {
+    const auto& offsets = run_partition_offsets[run_id];
+    for (auto partition_id = begin_partition_id; partition_id < end_partition_id; ++partition_id) {
+      radix_container.partition_offsets[partition_id - begin_partition_id] +=
+          offsets[partition_id] - (partition_id == 0 ? size_t{0} : offsets[partition_id - 1]);
+    }
+  }
+  std::partial_sum(radix_container.partition_offsets.begin(), radix_container.partition_offsets.end(),
+                   radix_container.partition_offsets.begin());
+
+  const auto element_count =
+      radix_container.partition_offsets.empty() ? size_t{0} : radix_container.partition_offsets.back();
+  radix_container.elements = make_partition<T>(element_count, memory_resource);
+  radix_container.null_value_bitvector =
+      std::make_shared<std::vector<bool>>(spilled_container.has_null_values ? element_count : 0);
+
+  // Read the requested partitions of each run
+  auto* const file = spilled_container.file.get();
+  auto buffers = std::vector<pmr_vector<char>>{};
+  buffers.reserve(end_run_id - begin_run_id);
+  for (auto run_id = begin_run_id; run_id < end_run_id; ++run_id) {
+    const auto& file_offsets = run_file_offsets[run_id];
+    const auto file_offset = file_offsets[begin_partition_id];
+    auto& buffer =
+        buffers.emplace_back(file_offsets[end_partition_id] - file_offset, PolymorphicAllocator<char>{memory_resource});
+    Assert(std::fseek(file, static_cast<long>(file_offset), SEEK_SET) == 0 &&  // NOLINT
+               std::fread(buffer.data(), 1, buffer.size(), file) == buffer.size(),
+           "Could not load spilled partitions from temporary file");
+  }
 
-        // In case NULL values have been materialized in materialize_input(),
-        // we need to keep them during the radix clustering phase.
-        if constexpr (retain_null_values) {
-          (*output_nulls)[output_offsets[radix]] = null_value_bitvector[chunk_offset];
+  auto offset = size_t{0};
+  for (auto partition_id = begin_partition_id; partition_id < end_partition_id; ++partition_id) {
+    for (auto run_id = begin_run_id; run_id < end_run_id; ++run_id) {
+      const auto& file_offsets = run_file_offsets[run_id];
+      const auto& buffer = buffers[run_id - begin_run_id];
+      const auto* position = buffer.data() + (file_offsets[partition_id] - file_offsets[begin_partition_id]);
+      const auto* const partition_end =
+          buffer.data() + (file_offsets[partition_id + 1] - file_offsets[begin_partition_id]);
+
+      const auto read = [&](void* data, const size_t size) {
+        std::memcpy(data, position, size);
+        position += size;
+      };
+
+      while (position < partition_end) {
+        auto& element = (*radix_container.elements)[offset];
+        read(&element.row_id, sizeof(RowID));
+        if (spilled_container.has_null_values) {
+          auto is_null = char{0};
+          read(&is_null, sizeof(char));
+          (*radix_container.null_value_bitvector)[offset] = is_null;
         }
-
-        (*output)[output_offsets[radix]] = element;
-        ++output_offsets[radix];
+        if constexpr (std::is_same_v<T, pmr_string>) {
+          auto size = size_t{0};
+          read(&size, sizeof(size));
+          element.value = pmr_string(position, size);
+          position += size;
+        } else {
+          read(&element.value, sizeof(T));
+        }
+        ++offset;
       }
-    }));
-    jobs.back()->schedule();
+    }
   }
+  DebugAssert(offset == element_count, "Number of loaded elements does not match the partition offsets");
 
-  CurrentScheduler::wait_for_tasks(jobs);
+  return radix_container;
+}
 
-  return radix_output;
+// Loads the partitions [begin_partition_id, end_partition_id) of all runs of a spilled container
+template <typename T>
+RadixContainer<T> load_partitions(
+    const SpilledRadixContainer& spilled_container, const size_t begin_partition_id, const size_t end_partition_id,
+    boost::container::pmr::memory_resource* memory_resource = boost::container::pmr::get_default_resource()) {
+  return load_partitions<T>(spilled_container, begin_partition_id, end_partition_id, 0,
+                            spilled_container.partition_file_offsets.size(), memory_resource);
+}
+
+/*
+Splits a spilled partition by the radix_bits bits of the hashes of its elements that start at bit hash_shift (see
+partition_by_hash_bits()) and spills the parts to a new container. The runs of the partition are repartitioned one
+after another, so that only a single run of the partition resides in memory at a time.
+*/
+template <typename T, typename HashedType>
+SpilledRadixContainer repartition_spilled_partition(
+    const SpilledRadixContainer& spilled_container, const size_t partition_id, const size_t hash_shift,
+    const size_t radix_bits,
+    boost::container::pmr::memory_resource* memory_resource = boost::container::pmr::get_default_resource()) {
+  auto repartitioned_container =
+      create_spilled_radix_container(1ull << radix_bits, spilled_container.has_null_values);
+
+  const auto run_count = spilled_container.partition_file_offsets.size();
+  for (auto run_id = size_t{0}; run_id < run_count; ++run_id) {
+    const auto run = load_partitions<T>(spilled_container, partition_id, partition_id + 1, run_id, run_id + 1,
+                                        memory_resource);
+    spill_partitions(partition_by_hash_bits<T, HashedType>(run, hash_shift, radix_bits, memory_resource),
+                     repartitioned_container);
+  }
+
+  return repartitioned_container;
 }
 
 /*
@@ -355,12 +771,6 @@ void probe(const RadixContainer<RightType>& radix_container,
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(radix_container.partition_offsets.size());
 
-  std::optional<MultiPredicateJoinEvaluator> multi_predicate_join_evaluator;
-
-  if (!secondary_join_predicates.empty()) {
-    multi_predicate_join_evaluator.emplace(left, right, secondary_join_predicates);
-  }
-
   /*
     NUMA notes:
     At this point both input relations are partitioned using radix partitioning.
@@ -385,6 +795,13 @@ void probe(const RadixContainer<RightType>& radix_container,
       PosList pos_list_left_local;
       PosList pos_list_right_local;
 
+      // Each job needs an evaluator of its own, as segment accessors (e.g., for LZ4 segments) are not thread-safe
+      std::optional<MultiPredicateJoinEvaluator> multi_predicate_join_evaluator;
+      if (!secondary_join_predicates.empty()) {
+        multi_predicate_join_evaluator.emplace(left, right, secondary_join_predicates);
+      }
+      auto secondary_predicate_matches = std::vector<bool>{};
+
       if constexpr (retain_null_values) {
         DebugAssert(
             radix_container.null_value_bitvector->size() == radix_container.elements->size(),
@@ -439,9 +856,12 @@ void probe(const RadixContainer<RightType>& radix_container,
               }
             } else {
               auto match_found = false;
-              for (const auto& row_id : primary_predicate_matching_rows) {
-                if (multi_predicate_join_evaluator->satisfies_all_predicates(row_id, right_row.row_id)) {
-                  pos_list_left_local.emplace_back(row_id);
+              multi_predicate_join_evaluator->satisfies_all_predicates(
+                  primary_predicate_matching_rows.data(), primary_predicate_matching_rows.size(), right_row.row_id,
+                  secondary_predicate_matches);
+              for (auto index = size_t{0}; index < primary_predicate_matching_rows.size(); ++index) {
+                if (secondary_predicate_matches[index]) {
+                  pos_list_left_local.emplace_back(primary_predicate_matching_rows[index]);
                   pos_list_right_local.emplace_back(right_row.row_id);
                   match_found = true;
                 }
@@ -506,7 +926,6 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
 
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(radix_container.partition_offsets.size());
-  MultiPredicateJoinEvaluator multi_predicate_join_evaluator(left, right, secondary_join_predicates);
 
   [[maybe_unused]] const auto* null_value_bitvector =
       radix_container.null_value_bitvector ? radix_container.null_value_bitvector.get() : nullptr;
@@ -531,6 +950,10 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
       if (hash_tables[current_partition_id]) {
         // Valid hashtable found, so there is at least one match in this partition
 
+        // Each job needs an evaluator of its own, as segment accessors (e.g., for LZ4 segments) are not thread-safe
+        MultiPredicateJoinEvaluator multi_predicate_join_evaluator(left, right, secondary_join_predicates);
+        auto secondary_predicate_matches = std::vector<bool>{};
+
         for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
           auto& row = partition[partition_offset];
 
@@ -553,11 +976,19 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
           if (it != hashtable.end()) {
             const auto& matching_rows = it->second;
 
-            for (const auto& row_id : matching_rows) {
-              if (multi_predicate_join_evaluator.satisfies_all_predicates(row_id, row.row_id)) {
-                any_row_matches = true;
-                break;
-              }
+            // A single match suffices. Thus, the candidates are evaluated in batches of growing size: The search stops
+            // early if one of the first candidates matches, while long lists of candidates still benefit from batched
+            // segment access.
+            auto batch_begin = size_t{0};
+            auto batch_size = size_t{1};
+            while (!any_row_matches && batch_begin < matching_rows.size()) {
+              const auto count = std::min(batch_size, matching_rows.size() - batch_begin);
+              multi_predicate_join_evaluator.satisfies_all_predicates(matching_rows.data() + batch_begin, count,
+                                                                      row.row_id, secondary_predicate_matches);
+              any_row_matches = std::find(secondary_predicate_matches.cbegin(), secondary_predicate_matches.cend(),
+                                          true) != secondary_predicate_matches.cend();
+              batch_begin += count;
+              batch_size *= 2;
             }
           }
 
@@ -583,6 +1014,55 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
   CurrentScheduler::wait_for_tasks(jobs);
 }
 
+/**
+ * Reorders the matches of a partition so that the RowIDs in @param build_pos_list are grouped by the chunk that they
+ * reference (see JoinHash::OutputOrder). @param probe_pos_list is reordered alongside. This is a stable counting sort,
+ * so that the probe side stays in input order within each group. NULL_ROW_IDs of outer joins are placed last.
+ */
+inline void group_matches_by_chunk(PosList& build_pos_list, PosList& probe_pos_list, const ChunkID build_chunk_count) {
+  DebugAssert(build_pos_list.size() == probe_pos_list.size(), "Expected one build side RowID per match");
+
+  const auto null_bucket = static_cast<size_t>(build_chunk_count);
+  const auto bucket = [&](const RowID& row_id) {
+    return row_id.is_null() ? null_bucket : static_cast<size_t>(row_id.chunk_id);
+  };
+
+  // bucket_offsets[b + 1] first counts the matches in bucket b and then becomes the write offset of bucket b + 1
+  auto bucket_offsets = std::vector<size_t>(null_bucket + 2);
+  for (const auto& row_id : build_pos_list) {
+    ++bucket_offsets[bucket(row_id) + 1];
+  }
+
+  // Nothing to do if all matches fall into the same bucket
+  if (std::find(bucket_offsets.cbegin(), bucket_offsets.cend(), build_pos_list.size()) != bucket_offsets.cend()) {
+    return;
+  }
+
+  std::partial_sum(bucket_offsets.cbegin(), bucket_offsets.cend(), bucket_offsets.begin());
+
+  auto grouped_build_pos_list = PosList(build_pos_list.size());
+  auto grouped_probe_pos_list = PosList(probe_pos_list.size());
+  for (auto match_id = size_t{0}; match_id < build_pos_list.size(); ++match_id) {
+    const auto grouped_match_id = bucket_offsets[bucket(build_pos_list[match_id])]++;
+    grouped_build_pos_list[grouped_match_id] = build_pos_list[match_id];
+    grouped_probe_pos_list[grouped_match_id] = probe_pos_list[match_id];
+  }
+
+  build_pos_list = std::move(grouped_build_pos_list);
+  probe_pos_list = std::move(grouped_probe_pos_list);
+}
+
+// Marks @param pos_list as referencing a single chunk if all of its RowIDs do. Cheap compared to writing the output.
+inline void guarantee_single_chunk_if_applicable(PosList& pos_list) {
+  if (pos_list.empty() || pos_list.front().is_null()) return;
+
+  const auto chunk_id = pos_list.front().chunk_id;
+  if (std::all_of(pos_list.cbegin(), pos_list.cend(),
+                  [&](const auto& row_id) { return row_id.chunk_id == chunk_id; })) {
+    pos_list.guarantee_single_chunk();
+  }
+}
+
 using PosLists = std::vector<std::shared_ptr<const PosList>>;
 using PosListsBySegment = std::vector<std::shared_ptr<PosLists>>;
 
@@ -664,6 +1144,12 @@ inline void write_output_segments(Segments& output_segments, const std::shared_p
             ++new_pos_list_iter;
           }
 
+          // Referencing a single chunk of input_table, whose PosList references a single chunk itself
+          if (pos_list->references_single_chunk() && !pos_list->empty() &&
+              (*input_table_pos_lists)[pos_list->common_chunk_id()]->references_single_chunk()) {
+            new_pos_list->guarantee_single_chunk();
+          }
+
           iter = output_pos_list_cache.emplace(input_table_pos_lists, new_pos_list).first;
         }
 
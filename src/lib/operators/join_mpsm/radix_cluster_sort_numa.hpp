@@ -12,10 +12,10 @@
 namespace opossum {
 
 /**
-* The RadixClusterOutput holds the data structures that belong to the output of the clustering stage.
+* The RadixClusterOutputNUMA holds the data structures that belong to the output of the clustering stage.
 */
 template <typename T>
-struct RadixClusterOutput {
+struct RadixClusterOutputNUMA {
   std::unique_ptr<MaterializedNUMAPartitionList<T>> clusters_left;
   std::unique_ptr<MaterializedNUMAPartitionList<T>> clusters_right;
   std::unique_ptr<PosList> null_rows_left;
@@ -332,8 +332,8 @@ class RadixClusterSortNUMA {
   /**
   * Executes the clustering and sorting.
   **/
-  RadixClusterOutput<T> execute() {
-    auto output = RadixClusterOutput<T>();
+  RadixClusterOutputNUMA<T> execute() {
+    auto output = RadixClusterOutputNUMA<T>();
 
     // Sort the chunks of the input tables in the non-equi cases
     auto left_column_materializer = ColumnMaterializerNUMA<T>(_materialize_null_left);
@@ -44,6 +44,10 @@ void __attribute__((noinline))
 join_two_typed_segments(const BinaryFunctor& func, LeftIterator left_it, LeftIterator left_end,
                         RightIterator right_begin, RightIterator right_end, const ChunkID chunk_id_left,
                         const ChunkID chunk_id_right, const JoinNestedLoop::JoinParams& params) {
+  // The right rows that satisfy the primary predicate. Their secondary predicates are evaluated in a single batch.
+  auto candidate_row_ids = std::vector<RowID>{};
+  auto secondary_predicate_matches = std::vector<bool>{};
+
   for (; left_it != left_end; ++left_it) {
     const auto left_value = *left_it;
 
@@ -58,6 +62,7 @@ join_two_typed_segments(const BinaryFunctor& func, LeftIterator left_it, LeftIte
       continue;
     }
 
+    candidate_row_ids.clear();
     for (auto right_it = right_begin; right_it != right_end; ++right_it) {
       const auto right_value = *right_it;
       if (right_value.is_null()) {
@@ -67,11 +72,16 @@ join_two_typed_segments(const BinaryFunctor& func, LeftIterator left_it, LeftIte
         continue;
       }
 
-      const auto right_row_id = RowID{chunk_id_right, right_value.chunk_offset()};
+      if (func(left_value.value(), right_value.value())) {
+        candidate_row_ids.emplace_back(chunk_id_right, right_value.chunk_offset());
+      }
+    }
 
-      if (func(left_value.value(), right_value.value()) &&
-          params.secondary_predicate_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
-        process_match(left_row_id, right_row_id, params);
+    params.secondary_predicate_evaluator.satisfies_all_predicates(
+        left_row_id, candidate_row_ids.data(), candidate_row_ids.size(), secondary_predicate_matches);
+    for (auto index = size_t{0}; index < candidate_row_ids.size(); ++index) {
+      if (secondary_predicate_matches[index]) {
+        process_match(left_row_id, candidate_row_ids[index], params);
       }
     }
   }
@@ -74,6 +74,7 @@ std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
       left_column_type, *this, _primary_predicate.column_ids.first, _primary_predicate.column_ids.second,
       _primary_predicate.predicate_condition, _mode, _secondary_predicates);
 
+  _record_join_column_accesses();
   return _impl->_on_execute();
 }
 
@@ -119,7 +120,9 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   const JoinMode _mode;
 
   const std::vector<OperatorJoinPredicate>& _secondary_join_predicates;
-  std::optional<MultiPredicateJoinEvaluator> _multi_predicate_join_evaluator;
+  // One evaluator per output cluster, as the segment accessors of an evaluator (e.g., for LZ4 segments) cache state
+  // and must not be shared by the concurrently running jobs. Each job creates its evaluator when it starts.
+  std::vector<std::optional<MultiPredicateJoinEvaluator>> _multi_predicate_join_evaluators;
   // these are used for outer joins where the primary predicate is not Equals.
   std::map<RowID, bool> _left_row_id_has_match{};
   std::map<RowID, bool> _right_row_id_has_match{};
@@ -127,6 +130,9 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   // the cluster count must be a power of two, i.e. 1, 2, 4, 8, 16, ...
   size_t _cluster_count;
 
+  // Number of heavy hitter clusters that follow the regular clusters (see RadixClusterOutput)
+  size_t _heavy_hitter_count{0};
+
   // Contains the output row ids for each cluster
   std::vector<std::shared_ptr<PosList>> _output_pos_lists_left;
   std::vector<std::shared_ptr<PosList>> _output_pos_lists_right;
@@ -171,6 +177,13 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
         }
       }
     }
+
+    // Returns the row ids of the table in this range, e.g., for the batched evaluation of secondary predicates
+    std::vector<RowID> row_ids(std::unique_ptr<MaterializedSegmentList<T>>& table) {
+      auto row_ids = std::vector<RowID>{};
+      for_every_row_id(table, [&](RowID row_id) { row_ids.emplace_back(row_id); });
+      return row_ids;
+    }
   };
 
   /**
@@ -201,57 +214,56 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   enum class CompareResult { Less, Greater, Equal };
 
   /**
-  * Performs the join for two runs of a specified cluster.
+  * Performs the join for two runs of a specified cluster and writes the matches to the pos lists of output_cluster.
   * A run is a series of rows in a cluster with the same value.
   **/
-  void _join_runs(TableRange left_run, TableRange right_run, CompareResult compare_result) {
-    size_t cluster_number = left_run.start.cluster;
+  void _join_runs(TableRange left_run, TableRange right_run, CompareResult compare_result, size_t output_cluster) {
     switch (_primary_predicate_condition) {
       case PredicateCondition::Equals:
         if (compare_result == CompareResult::Equal) {
-          _emit_qualified_combinations(cluster_number, left_run, right_run);
+          _emit_qualified_combinations(output_cluster, left_run, right_run);
         } else if (compare_result == CompareResult::Less) {
           if (_mode == JoinMode::Left || _mode == JoinMode::FullOuter) {
-            _emit_right_primary_null_combinations(cluster_number, left_run);
+            _emit_right_primary_null_combinations(output_cluster, left_run);
           }
         } else if (compare_result == CompareResult::Greater) {
           if (_mode == JoinMode::Right || _mode == JoinMode::FullOuter) {
-            _emit_left_primary_null_combinations(cluster_number, right_run);
+            _emit_left_primary_null_combinations(output_cluster, right_run);
           }
         }
         break;
       case PredicateCondition::NotEquals:
         if (compare_result == CompareResult::Greater) {
-          _emit_qualified_combinations(cluster_number, left_run.start.to(_end_of_left_table), right_run);
+          _emit_qualified_combinations(output_cluster, left_run.start.to(_end_of_left_table), right_run);
         } else if (compare_result == CompareResult::Equal) {
-          _emit_qualified_combinations(cluster_number, left_run.end.to(_end_of_left_table), right_run);
-          _emit_qualified_combinations(cluster_number, left_run, right_run.end.to(_end_of_right_table));
+          _emit_qualified_combinations(output_cluster, left_run.end.to(_end_of_left_table), right_run);
+          _emit_qualified_combinations(output_cluster, left_run, right_run.end.to(_end_of_right_table));
         } else if (compare_result == CompareResult::Less) {
-          _emit_qualified_combinations(cluster_number, left_run, right_run.start.to(_end_of_right_table));
+          _emit_qualified_combinations(output_cluster, left_run, right_run.start.to(_end_of_right_table));
         }
         break;
       case PredicateCondition::GreaterThan:
         if (compare_result == CompareResult::Greater) {
-          _emit_qualified_combinations(cluster_number, left_run.start.to(_end_of_left_table), right_run);
+          _emit_qualified_combinations(output_cluster, left_run.start.to(_end_of_left_table), right_run);
         } else if (compare_result == CompareResult::Equal) {
-          _emit_qualified_combinations(cluster_number, left_run.end.to(_end_of_left_table), right_run);
+          _emit_qualified_combinations(output_cluster, left_run.end.to(_end_of_left_table), right_run);
         }
         break;
       case PredicateCondition::GreaterThanEquals:
         if (compare_result == CompareResult::Greater || compare_result == CompareResult::Equal) {
-          _emit_qualified_combinations(cluster_number, left_run.start.to(_end_of_left_table), right_run);
+          _emit_qualified_combinations(output_cluster, left_run.start.to(_end_of_left_table), right_run);
         }
         break;
       case PredicateCondition::LessThan:
         if (compare_result == CompareResult::Less) {
-          _emit_qualified_combinations(cluster_number, left_run, right_run.start.to(_end_of_right_table));
+          _emit_qualified_combinations(output_cluster, left_run, right_run.start.to(_end_of_right_table));
         } else if (compare_result == CompareResult::Equal) {
-          _emit_qualified_combinations(cluster_number, left_run, right_run.end.to(_end_of_right_table));
+          _emit_qualified_combinations(output_cluster, left_run, right_run.end.to(_end_of_right_table));
         }
         break;
       case PredicateCondition::LessThanEquals:
         if (compare_result == CompareResult::Less || compare_result == CompareResult::Equal) {
-          _emit_qualified_combinations(cluster_number, left_run, right_run.start.to(_end_of_right_table));
+          _emit_qualified_combinations(output_cluster, left_run, right_run.start.to(_end_of_right_table));
         }
         break;
       default:
@@ -272,7 +284,7 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     * where also the secondary predicates are satisfied.
     **/
   void _emit_qualified_combinations(size_t output_cluster, TableRange left_range, TableRange right_range) {
-    if (_multi_predicate_join_evaluator) {
+    if (!_secondary_join_predicates.empty()) {
       if (_mode == JoinMode::Inner) {
         _emit_combinations_multi_predicated_inner(output_cluster, left_range, right_range);
       } else if (_mode == JoinMode::Left) {
@@ -298,12 +310,17 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
    * where the secondary predicates are satisfied.
    **/
   void _emit_combinations_multi_predicated_inner(size_t output_cluster, TableRange left_range, TableRange right_range) {
+    auto& evaluator = *_multi_predicate_join_evaluators[output_cluster];
+    const auto right_row_ids = right_range.row_ids(_sorted_right_table);
+    auto matches = std::vector<bool>{};
+
     left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
-      right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-        if (_multi_predicate_join_evaluator->satisfies_all_predicates(left_row_id, right_row_id)) {
-          _emit_combination(output_cluster, left_row_id, right_row_id);
+      evaluator.satisfies_all_predicates(left_row_id, right_row_ids.data(), right_row_ids.size(), matches);
+      for (auto index = size_t{0}; index < right_row_ids.size(); ++index) {
+        if (matches[index]) {
+          _emit_combination(output_cluster, left_row_id, right_row_ids[index]);
         }
-      });
+      }
     });
   }
 
@@ -315,15 +332,20 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   **/
   void _emit_combinations_multi_predicated_left_outer(size_t output_cluster, TableRange left_range,
                                                       TableRange right_range) {
+    auto& evaluator = *_multi_predicate_join_evaluators[output_cluster];
+    const auto right_row_ids = right_range.row_ids(_sorted_right_table);
+    auto matches = std::vector<bool>{};
+
     if (_primary_predicate_condition == PredicateCondition::Equals) {
       left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
         bool left_row_id_matched = false;
-        right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-          if (_multi_predicate_join_evaluator->satisfies_all_predicates(left_row_id, right_row_id)) {
-            _emit_combination(output_cluster, left_row_id, right_row_id);
+        evaluator.satisfies_all_predicates(left_row_id, right_row_ids.data(), right_row_ids.size(), matches);
+        for (auto index = size_t{0}; index < right_row_ids.size(); ++index) {
+          if (matches[index]) {
+            _emit_combination(output_cluster, left_row_id, right_row_ids[index]);
             left_row_id_matched = true;
           }
-        });
+        }
         if (!left_row_id_matched) {
           _emit_combination(output_cluster, left_row_id, NULL_ROW_ID);
         }
@@ -332,12 +354,13 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
       // primary predicate is <, <=, >, or >=
       left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
         _left_row_id_has_match.emplace(left_row_id, false);
-        right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-          if (_multi_predicate_join_evaluator->satisfies_all_predicates(left_row_id, right_row_id)) {
-            _emit_combination(output_cluster, left_row_id, right_row_id);
+        evaluator.satisfies_all_predicates(left_row_id, right_row_ids.data(), right_row_ids.size(), matches);
+        for (auto index = size_t{0}; index < right_row_ids.size(); ++index) {
+          if (matches[index]) {
+            _emit_combination(output_cluster, left_row_id, right_row_ids[index]);
             _left_row_id_has_match[left_row_id] = true;
           }
-        });
+        }
       });
     }
   }
@@ -350,15 +373,20 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     **/
   void _emit_combinations_multi_predicated_right_outer(size_t output_cluster, TableRange left_range,
                                                        TableRange right_range) {
+    auto& evaluator = *_multi_predicate_join_evaluators[output_cluster];
+    const auto left_row_ids = left_range.row_ids(_sorted_left_table);
+    auto matches = std::vector<bool>{};
+
     if (_primary_predicate_condition == PredicateCondition::Equals) {
       right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
         bool right_row_id_matched = false;
-        left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
-          if (_multi_predicate_join_evaluator->satisfies_all_predicates(left_row_id, right_row_id)) {
-            _emit_combination(output_cluster, left_row_id, right_row_id);
+        evaluator.satisfies_all_predicates(left_row_ids.data(), left_row_ids.size(), right_row_id, matches);
+        for (auto index = size_t{0}; index < left_row_ids.size(); ++index) {
+          if (matches[index]) {
+            _emit_combination(output_cluster, left_row_ids[index], right_row_id);
             right_row_id_matched = true;
           }
-        });
+        }
         if (!right_row_id_matched) {
           _emit_combination(output_cluster, NULL_ROW_ID, right_row_id);
         }
@@ -367,12 +395,13 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
       // primary predicate is <, <=, >, or >=
       right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
         _right_row_id_has_match.emplace(right_row_id, false);
-        left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
-          if (_multi_predicate_join_evaluator->satisfies_all_predicates(left_row_id, right_row_id)) {
-            _emit_combination(output_cluster, left_row_id, right_row_id);
+        evaluator.satisfies_all_predicates(left_row_ids.data(), left_row_ids.size(), right_row_id, matches);
+        for (auto index = size_t{0}; index < left_row_ids.size(); ++index) {
+          if (matches[index]) {
+            _emit_combination(output_cluster, left_row_ids[index], right_row_id);
             _right_row_id_has_match[right_row_id] = true;
           }
-        });
+        }
       });
     }
   }
@@ -386,42 +415,48 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     **/
   void _emit_combinations_multi_predicated_full_outer(size_t output_cluster, TableRange left_range,
                                                       TableRange right_range) {
+    auto& evaluator = *_multi_predicate_join_evaluators[output_cluster];
+    const auto right_row_ids = right_range.row_ids(_sorted_right_table);
+    auto matches = std::vector<bool>{};
+
     if (_primary_predicate_condition == PredicateCondition::Equals) {
       std::set<RowID> matched_right_row_ids;
 
       left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
         bool left_row_id_matched = false;
-        right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-          if (_multi_predicate_join_evaluator->satisfies_all_predicates(left_row_id, right_row_id)) {
-            _emit_combination(output_cluster, left_row_id, right_row_id);
+        evaluator.satisfies_all_predicates(left_row_id, right_row_ids.data(), right_row_ids.size(), matches);
+        for (auto index = size_t{0}; index < right_row_ids.size(); ++index) {
+          if (matches[index]) {
+            _emit_combination(output_cluster, left_row_id, right_row_ids[index]);
             left_row_id_matched = true;
-            matched_right_row_ids.insert(right_row_id);
+            matched_right_row_ids.insert(right_row_ids[index]);
           }
-        });
+        }
         if (!left_row_id_matched) {
           _emit_combination(output_cluster, left_row_id, NULL_ROW_ID);
         }
       });
       // add null value combinations for right row ids that have no match.
-      right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
+      for (const auto& right_row_id : right_row_ids) {
         // right_row_ids_with_match has no key `right_row_id`
         if (matched_right_row_ids.count(right_row_id) == 0) {
           _emit_combination(output_cluster, NULL_ROW_ID, right_row_id);
         }
-      });
+      }
     } else {
       left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
         // If left_row_id not yet in _left_row_id_has_match, this initializes it to false
         _left_row_id_has_match[left_row_id];
-        right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
+        evaluator.satisfies_all_predicates(left_row_id, right_row_ids.data(), right_row_ids.size(), matches);
+        for (auto index = size_t{0}; index < right_row_ids.size(); ++index) {
           // If right_row_id not yet in _right_row_id_has_match, this initializes it to false
-          _right_row_id_has_match[right_row_id];
-          if (_multi_predicate_join_evaluator->satisfies_all_predicates(left_row_id, right_row_id)) {
-            _emit_combination(output_cluster, left_row_id, right_row_id);
+          _right_row_id_has_match[right_row_ids[index]];
+          if (matches[index]) {
+            _emit_combination(output_cluster, left_row_id, right_row_ids[index]);
             _left_row_id_has_match[left_row_id] = true;
-            _right_row_id_has_match[right_row_id] = true;
+            _right_row_id_has_match[right_row_ids[index]] = true;
           }
-        });
+        }
       });
     }
   }
@@ -498,7 +533,7 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
 
       TableRange left_run(cluster_number, left_run_start, left_run_end);
       TableRange right_run(cluster_number, right_run_start, right_run_end);
-      _join_runs(left_run, right_run, compare_result);
+      _join_runs(left_run, right_run, compare_result, cluster_number);
 
       // Advance to the next run on the smaller side or both if equal
       if (compare_result == CompareResult::Equal) {
@@ -522,9 +557,9 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     auto right_rest = TableRange(cluster_number, right_run_start, right_size);
     auto left_rest = TableRange(cluster_number, left_run_start, left_size);
     if (left_run_start < left_size) {
-      _join_runs(left_rest, right_rest, CompareResult::Less);
+      _join_runs(left_rest, right_rest, CompareResult::Less, cluster_number);
     } else if (right_run_start < right_size) {
-      _join_runs(left_rest, right_rest, CompareResult::Greater);
+      _join_runs(left_rest, right_rest, CompareResult::Greater, cluster_number);
     }
   }
 
@@ -702,12 +737,97 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     }
   }
 
+  /**
+  * A part of a heavy hitter cluster that is joined by a separate job. As the cluster holds a single value, all rows of
+  * left_range and right_range are join partners regarding the primary predicate (if both are non-empty).
+  **/
+  struct HeavyHitterJob {
+    TableRange left_range;
+    TableRange right_range;
+    CompareResult compare_result;
+  };
+
+  /**
+  * Splits the heavy hitter clusters into jobs of about the size of an average regular cluster. For this, one side of
+  * a cluster is partitioned and each partition is joined with the complete other side. Outer joins with secondary
+  * predicates check for each row of the outer side whether any row of the other side matches, so that the outer side
+  * is the one to partition. For full outer joins with secondary predicates, the cluster is not split.
+  **/
+  std::vector<HeavyHitterJob> _split_heavy_hitter_clusters() const {
+    auto total_row_count = size_t{0};
+    for (const auto& cluster : *_sorted_left_table) total_row_count += cluster->size();
+    for (const auto& cluster : *_sorted_right_table) total_row_count += cluster->size();
+
+    std::vector<HeavyHitterJob> jobs;
+    for (auto cluster_number = _cluster_count; cluster_number < _cluster_count + _heavy_hitter_count;
+         ++cluster_number) {
+      const auto left_size = (*_sorted_left_table)[cluster_number]->size();
+      const auto right_size = (*_sorted_right_table)[cluster_number]->size();
+
+      auto compare_result = CompareResult::Equal;
+      if (left_size == 0) {
+        compare_result = CompareResult::Greater;
+      } else if (right_size == 0) {
+        compare_result = CompareResult::Less;
+      }
+
+      // Avoid empty jobs for inner equi joins
+      if (_mode == JoinMode::Inner && compare_result != CompareResult::Equal) continue;
+
+      auto partition_left = left_size >= right_size;
+      if (_mode == JoinMode::Left) partition_left = true;
+      if (_mode == JoinMode::Right) partition_left = false;
+
+      const auto partitioned_size = partition_left ? left_size : right_size;
+      auto job_count = (left_size + right_size) * _cluster_count / total_row_count + 1;
+      job_count = std::min({job_count, partitioned_size, _cluster_count});
+      if (_mode == JoinMode::FullOuter && !_secondary_join_predicates.empty()) job_count = 1;
+      job_count = std::max(job_count, size_t{1});
+
+      for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+        const auto begin = partitioned_size * job_id / job_count;
+        const auto end = partitioned_size * (job_id + 1) / job_count;
+        if (partition_left) {
+          jobs.push_back({TableRange(cluster_number, begin, end), TableRange(cluster_number, 0, right_size),
+                          compare_result});
+        } else {
+          jobs.push_back({TableRange(cluster_number, 0, left_size), TableRange(cluster_number, begin, end),
+                          compare_result});
+        }
+      }
+    }
+
+    return jobs;
+  }
+
+  /**
+  * Creates the evaluator of the secondary predicates for the job that writes to output_cluster.
+  **/
+  void _create_multi_predicate_join_evaluator(const size_t output_cluster) {
+    if (_secondary_join_predicates.empty()) return;
+
+    _multi_predicate_join_evaluators[output_cluster].emplace(*_sort_merge_join._input_left->get_output(),
+                                                             *_sort_merge_join.input_right()->get_output(),
+                                                             _secondary_join_predicates);
+  }
+
   /**
   * Performs the join on all clusters in parallel.
   **/
   void _perform_join() {
     std::vector<std::shared_ptr<AbstractTask>> jobs;
 
+    // Each heavy hitter job writes to output position lists of its own. They follow those of the regular clusters and
+    // have to be created before any job is scheduled.
+    const auto heavy_hitter_jobs = _split_heavy_hitter_clusters();
+    _output_pos_lists_left.resize(_cluster_count + heavy_hitter_jobs.size());
+    _output_pos_lists_right.resize(_cluster_count + heavy_hitter_jobs.size());
+    _multi_predicate_join_evaluators.resize(_cluster_count + heavy_hitter_jobs.size());
+    for (auto output_cluster = _cluster_count; output_cluster < _output_pos_lists_left.size(); ++output_cluster) {
+      _output_pos_lists_left[output_cluster] = std::make_shared<PosList>();
+      _output_pos_lists_right[output_cluster] = std::make_shared<PosList>();
+    }
+
     // Parallel join for each cluster
     for (size_t cluster_number = 0; cluster_number < _cluster_count; ++cluster_number) {
       // Create output position lists
@@ -720,7 +840,20 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
           continue;
         }
       }
-      jobs.push_back(std::make_shared<JobTask>([this, cluster_number] { this->_join_cluster(cluster_number); }));
+      jobs.push_back(std::make_shared<JobTask>([this, cluster_number] {
+        this->_create_multi_predicate_join_evaluator(cluster_number);
+        this->_join_cluster(cluster_number);
+      }));
+      jobs.back()->schedule();
+    }
+
+    for (auto job_id = size_t{0}; job_id < heavy_hitter_jobs.size(); ++job_id) {
+      const auto& job = heavy_hitter_jobs[job_id];
+      const auto output_cluster = _cluster_count + job_id;
+      jobs.push_back(std::make_shared<JobTask>([this, &job, output_cluster] {
+        this->_create_multi_predicate_join_evaluator(output_cluster);
+        this->_join_runs(job.left_range, job.right_range, job.compare_result, output_cluster);
+      }));
       jobs.back()->schedule();
     }
 
@@ -837,15 +970,10 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     _sorted_right_table = std::move(sort_output.clusters_right);
     _null_rows_left = std::move(sort_output.null_rows_left);
     _null_rows_right = std::move(sort_output.null_rows_right);
+    _heavy_hitter_count = sort_output.heavy_hitters.size();
     _end_of_left_table = _end_of_table(_sorted_left_table);
     _end_of_right_table = _end_of_table(_sorted_right_table);
 
-    if (!_secondary_join_predicates.empty()) {
-      _multi_predicate_join_evaluator.emplace(*_sort_merge_join._input_left->get_output(),
-                                              *_sort_merge_join.input_right()->get_output(),
-                                              _secondary_join_predicates);
-    }
-
     _perform_join();
 
     // merge the pos lists into single pos lists
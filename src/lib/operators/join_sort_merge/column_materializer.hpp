@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -101,13 +102,21 @@ class ColumnMaterializer {
                                                                   std::shared_ptr<const Table> input,
                                                                   const ColumnID column_id, Subsample<T>& subsample) {
     return std::make_shared<JobTask>([this, &output, &null_rows_output, input, column_id, chunk_id, &subsample] {
-      auto segment = input->get_chunk(chunk_id)->get_segment(column_id);
+      const auto chunk = input->get_chunk(chunk_id);
+      auto segment = chunk->get_segment(column_id);
+
+      // Chunks that are sorted by the column do not need to be sorted again, see _materialize_generic_segment
+      auto order_by_mode = std::optional<OrderByMode>{};
+      if (const auto ordered_by = chunk->ordered_by(); ordered_by && ordered_by->first == column_id) {
+        order_by_mode = ordered_by->second;
+      }
 
       if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment)) {
         (*output)[chunk_id] =
             _materialize_dictionary_segment(*dictionary_segment, chunk_id, null_rows_output, subsample);
       } else {
-        (*output)[chunk_id] = _materialize_generic_segment(*segment, chunk_id, null_rows_output, subsample);
+        (*output)[chunk_id] =
+            _materialize_generic_segment(*segment, chunk_id, null_rows_output, subsample, order_by_mode);
       }
     });
   }
@@ -136,12 +145,12 @@ class ColumnMaterializer {
   }
 
   /**
-   * Materialization works of all types of segments
+   * Materialization works of all types of segments. If the segment is known to be sorted (order_by_mode), the values
+   * are only reversed if necessary instead of being sorted.
    */
-  std::shared_ptr<MaterializedSegment<T>> _materialize_generic_segment(const BaseSegment& segment,
-                                                                       const ChunkID chunk_id,
-                                                                       std::unique_ptr<PosList>& null_rows_output,
-                                                                       Subsample<T>& subsample) {
+  std::shared_ptr<MaterializedSegment<T>> _materialize_generic_segment(
+      const BaseSegment& segment, const ChunkID chunk_id, std::unique_ptr<PosList>& null_rows_output,
+      Subsample<T>& subsample, const std::optional<OrderByMode>& order_by_mode) {
     auto output = MaterializedSegment<T>{};
     output.reserve(segment.size());
 
@@ -157,8 +166,14 @@ class ColumnMaterializer {
     });
 
     if (_sort) {
-      std::sort(output.begin(), output.end(),
-                [](const auto& left, const auto& right) { return left.value < right.value; });
+      if (order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::AscendingNullsLast) {
+        // Already sorted, the NULLs have been removed above
+      } else if (order_by_mode) {
+        std::reverse(output.begin(), output.end());
+      } else {
+        std::sort(output.begin(), output.end(),
+                  [](const auto& left, const auto& right) { return left.value < right.value; });
+      }
     }
 
     _gather_samples_from_segment(output, subsample);
@@ -20,6 +20,11 @@ struct RadixClusterOutput {
   std::unique_ptr<MaterializedSegmentList<T>> clusters_right;
   std::unique_ptr<PosList> null_rows_left;
   std::unique_ptr<PosList> null_rows_right;
+
+  // Only used in the equi case: values that are so frequent that a single cluster could not handle them in reasonable
+  // time. The rows with heavy_hitters[i] are placed in an additional cluster (cluster_count + i) on both sides, which
+  // holds no other value and is not sorted. The join can then split these clusters across multiple jobs.
+  std::vector<T> heavy_hitters;
 };
 
 /*
@@ -35,6 +40,10 @@ struct RadixClusterOutput {
 * -> Then, either radix clustering or range clustering is performed.
 * -> At last, the resulting clusters are sorted.
 *
+* Radix clustering puts all rows with the same value into the same cluster. If a single value is very frequent, the
+* job that joins its cluster does most of the work. Thus, values that are more frequent in the samples than the
+* average cluster size are detected as heavy hitters and get clusters of their own (see RadixClusterOutput).
+*
 * Radix clustering example:
 * cluster_count = 4
 * bits for 4 clusters: 2
@@ -172,9 +181,10 @@ class RadixClusterSort {
   * -> At last, each value of each chunk is moved to the appropriate cluster.
   **/
   std::unique_ptr<MaterializedSegmentList<T>> _cluster(const std::unique_ptr<MaterializedSegmentList<T>>& input_chunks,
-                                                       std::function<size_t(const T&)> clusterer) {
-    auto output_table = std::make_unique<MaterializedSegmentList<T>>(_cluster_count);
-    TableInformation table_information(input_chunks->size(), _cluster_count);
+                                                       std::function<size_t(const T&)> clusterer,
+                                                       const size_t cluster_count) {
+    auto output_table = std::make_unique<MaterializedSegmentList<T>>(cluster_count);
+    TableInformation table_information(input_chunks->size(), cluster_count);
 
     // Count for every chunk the number of entries for each cluster in parallel
     std::vector<std::shared_ptr<AbstractTask>> histogram_jobs;
@@ -198,14 +208,14 @@ class RadixClusterSort {
 
     // Aggregate the chunks histograms to a table histogram and initialize the insert positions for each chunk
     for (auto& chunk_information : table_information.chunk_information) {
-      for (size_t cluster_id = 0; cluster_id < _cluster_count; ++cluster_id) {
+      for (size_t cluster_id = 0; cluster_id < cluster_count; ++cluster_id) {
         chunk_information.insert_position[cluster_id] = table_information.cluster_histogram[cluster_id];
         table_information.cluster_histogram[cluster_id] += chunk_information.cluster_histogram[cluster_id];
       }
     }
 
     // Reserve the appropriate output space for the clusters
-    for (size_t cluster_id = 0; cluster_id < _cluster_count; ++cluster_id) {
+    for (size_t cluster_id = 0; cluster_id < cluster_count; ++cluster_id) {
       auto cluster_size = table_information.cluster_histogram[cluster_id];
       (*output_table)[cluster_id] = std::make_shared<MaterializedSegment<T>>(cluster_size);
     }
@@ -240,10 +250,43 @@ class RadixClusterSort {
   * - manually select the clustering bits based on statistics.
   * - consolidate clusters in order to reduce skew.
   **/
-  std::unique_ptr<MaterializedSegmentList<T>> _radix_cluster(
-      std::unique_ptr<MaterializedSegmentList<T>>& input_chunks) {
+  std::unique_ptr<MaterializedSegmentList<T>> _radix_cluster(std::unique_ptr<MaterializedSegmentList<T>>& input_chunks,
+                                                             const std::vector<T>& heavy_hitters) {
     auto radix_bitmask = _cluster_count - 1;
-    return _cluster(input_chunks, [=](const T& value) { return get_radix<T>(value, radix_bitmask); });
+    if (heavy_hitters.empty()) {
+      return _cluster(
+          input_chunks, [=](const T& value) { return get_radix<T>(value, radix_bitmask); }, _cluster_count);
+    }
+
+    // The heavy hitters are sorted, and there are less of them than clusters
+    const auto clusterer = [&, radix_bitmask](const T& value) {
+      const auto heavy_hitter_it = std::lower_bound(heavy_hitters.cbegin(), heavy_hitters.cend(), value);
+      if (heavy_hitter_it != heavy_hitters.cend() && *heavy_hitter_it == value) {
+        return _cluster_count + std::distance(heavy_hitters.cbegin(), heavy_hitter_it);
+      }
+      return static_cast<size_t>(get_radix<T>(value, radix_bitmask));
+    };
+    return _cluster(input_chunks, clusterer, _cluster_count + heavy_hitters.size());
+  }
+
+  /**
+  * Picks the values that occur more often in the given sample values than an average cluster would hold (i.e., more
+  * than sample count / cluster count times). Returns them in ascending order.
+  **/
+  std::vector<T> _pick_heavy_hitters(std::vector<T> sample_values) const {
+    std::sort(sample_values.begin(), sample_values.end());
+
+    std::vector<T> heavy_hitters;
+    for (auto run_begin = sample_values.cbegin(); run_begin != sample_values.cend();) {
+      const auto run_end = std::upper_bound(run_begin, sample_values.cend(), *run_begin);
+      const auto run_length = static_cast<size_t>(std::distance(run_begin, run_end));
+      if (run_length * _cluster_count > sample_values.size()) {
+        heavy_hitters.push_back(*run_begin);
+      }
+      run_begin = run_end;
+    }
+
+    return heavy_hitters;
   }
 
   /**
@@ -305,18 +348,24 @@ class RadixClusterSort {
       return split_values.size();
     };
 
-    auto output_left = _cluster(input_left, clusterer);
-    auto output_right = _cluster(input_right, clusterer);
+    auto output_left = _cluster(input_left, clusterer, _cluster_count);
+    auto output_right = _cluster(input_right, clusterer, _cluster_count);
 
     return {std::move(output_left), std::move(output_right)};
   }
 
   /**
-  * Sorts all clusters of a materialized table.
+  * Sorts all clusters of a materialized table, except for the heavy hitter clusters, which hold a single value.
+  * Clustering keeps the order of the values, so that clusters of sorted inputs (see Chunk::ordered_by) are sorted
+  * already. This is checked first, which stops at the first value out of order for unsorted clusters.
   **/
   void _sort_clusters(std::unique_ptr<MaterializedSegmentList<T>>& clusters) {
-    for (auto cluster : *clusters) {
-      std::sort(cluster->begin(), cluster->end(), [](auto& left, auto& right) { return left.value < right.value; });
+    const auto sorted_cluster_count = std::min(clusters->size(), _cluster_count);
+    const auto compare = [](const auto& left, const auto& right) { return left.value < right.value; };
+    for (auto cluster_id = size_t{0}; cluster_id < sorted_cluster_count; ++cluster_id) {
+      auto& cluster = *(*clusters)[cluster_id];
+      if (std::is_sorted(cluster.begin(), cluster.end(), compare)) continue;
+      std::sort(cluster.begin(), cluster.end(), compare);
     }
   }
 
@@ -345,8 +394,9 @@ class RadixClusterSort {
       output.clusters_left = _concatenate_chunks(materialized_left_segments);
       output.clusters_right = _concatenate_chunks(materialized_right_segments);
     } else if (_equi_case) {
-      output.clusters_left = _radix_cluster(materialized_left_segments);
-      output.clusters_right = _radix_cluster(materialized_right_segments);
+      output.heavy_hitters = _pick_heavy_hitters(std::move(samples_left));
+      output.clusters_left = _radix_cluster(materialized_left_segments, output.heavy_hitters);
+      output.clusters_right = _radix_cluster(materialized_right_segments, output.heavy_hitters);
     } else {
       auto result = _range_cluster(materialized_left_segments, materialized_right_segments, samples_left);
       output.clusters_left = std::move(result.first);
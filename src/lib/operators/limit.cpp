@@ -80,6 +80,11 @@ std::shared_ptr<const Table> Limit::_on_execute() {
 
     i += output_chunk_row_count;
     output_table->append_chunk(output_segments);
+
+    // The output chunk is a prefix of the input chunk and thus ordered like it
+    if (const auto ordered_by = input_chunk->ordered_by()) {
+      output_table->get_chunk(ChunkID{output_table->chunk_count() - 1})->set_ordered_by(*ordered_by);
+    }
   }
 
   return output_table;
@@ -25,8 +25,8 @@ MultiPredicateJoinEvaluator::MultiPredicateJoinEvaluator(const Table& left, cons
         constexpr auto BOTH_ARE_STRING_COLUMNS = LEFT_IS_STRING_COLUMN && RIGHT_IS_STRING_COLUMN;
 
         if constexpr (NEITHER_IS_STRING_COLUMN || BOTH_ARE_STRING_COLUMNS) {
-          auto left_accessors = _create_accessors<LeftColumnDataType>(left, predicate.column_ids.first);
-          auto right_accessors = _create_accessors<RightColumnDataType>(right, predicate.column_ids.second);
+          auto left_accessor = ColumnAccessor<LeftColumnDataType>{left, predicate.column_ids.first};
+          auto right_accessor = ColumnAccessor<RightColumnDataType>{right, predicate.column_ids.second};
 
           // We need to do this assignment to work around an internal compiler error.
           // The compiler error would occur, if you tried to directly access _comparators within the following
@@ -36,7 +36,7 @@ MultiPredicateJoinEvaluator::MultiPredicateJoinEvaluator(const Table& left, cons
           with_comparator(predicate.predicate_condition, [&](auto comparator) {
             comparators.emplace_back(
                 std::make_unique<FieldComparator<decltype(comparator), LeftColumnDataType, RightColumnDataType>>(
-                    comparator, std::move(left_accessors), std::move(right_accessors)));
+                    comparator, std::move(left_accessor), std::move(right_accessor)));
           });
         } else {
           Fail("Types of columns cannot be compared.");
@@ -56,22 +56,20 @@ bool MultiPredicateJoinEvaluator::satisfies_all_predicates(const RowID& left_row
   return true;
 }
 
-template <typename T>
-std::vector<std::unique_ptr<AbstractSegmentAccessor<T>>> MultiPredicateJoinEvaluator::_create_accessors(
-    const Table& table, const ColumnID column_id) {
-  std::vector<std::unique_ptr<AbstractSegmentAccessor<T>>> accessors;
-  accessors.resize(table.chunk_count());
-  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
-    const auto& chunk = table.get_chunk(chunk_id);
-    // get_chunk might return nullptr if we iterate over chunk_count manually
-    // https://github.com/hyrise/hyrise/pull/1482#discussion_r261860186
-    if (chunk) {
-      const auto& segment = table.get_chunk(chunk_id)->get_segment(column_id);
-      accessors[chunk_id] = create_segment_accessor<T>(segment);
-    }
+void MultiPredicateJoinEvaluator::satisfies_all_predicates(const RowID& left_row_id, const RowID* right_row_ids,
+                                                           const size_t count, std::vector<bool>& matches) {
+  matches.assign(count, true);
+  for (const auto& comparator : _comparators) {
+    comparator->compare(left_row_id, right_row_ids, count, matches);
   }
+}
 
-  return accessors;
+void MultiPredicateJoinEvaluator::satisfies_all_predicates(const RowID* left_row_ids, const size_t count,
+                                                           const RowID& right_row_id, std::vector<bool>& matches) {
+  matches.assign(count, true);
+  for (const auto& comparator : _comparators) {
+    comparator->compare(left_row_ids, count, right_row_id, matches);
+  }
 }
 
 }  // namespace opossum
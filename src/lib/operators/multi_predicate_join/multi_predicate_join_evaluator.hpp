@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <optional>
 #include <vector>
 
 #include "operators/operator_join_predicate.hpp"
@@ -9,6 +11,10 @@
 
 namespace opossum {
 
+/**
+ * Evaluates the secondary predicates of a join for pairs of rows. As the segment accessors cache state (e.g., the last
+ * decompressed LZ4 block) and are created lazily, an evaluator must not be used by multiple threads concurrently.
+ */
 class MultiPredicateJoinEvaluator {
  public:
   MultiPredicateJoinEvaluator(const Table& left, const Table& right,
@@ -16,29 +22,94 @@ class MultiPredicateJoinEvaluator {
 
   bool satisfies_all_predicates(const RowID& left_row_id, const RowID& right_row_id);
 
+  /**
+   * Batched variants that evaluate the predicates for a single row of one side and @param count rows of the other
+   * side. The values of these rows are retrieved through the batched AbstractSegmentAccessor::access, which avoids a
+   * virtual call and a std::optional per comparison. Afterwards, @param matches holds for each of the @param count
+   * rows whether it satisfies all predicates.
+   */
+  void satisfies_all_predicates(const RowID& left_row_id, const RowID* right_row_ids, const size_t count,
+                                std::vector<bool>& matches);
+  void satisfies_all_predicates(const RowID* left_row_ids, const size_t count, const RowID& right_row_id,
+                                std::vector<bool>& matches);
+
  protected:
+  /**
+   * Accesses the values of a column. The segment accessors are created when a chunk is first accessed, the buffers
+   * for batched accesses are reused across batches.
+   */
+  template <typename T>
+  class ColumnAccessor {
+   public:
+    ColumnAccessor(const Table& table, const ColumnID column_id)
+        : _table{table}, _column_id{column_id}, _accessors(table.chunk_count()) {}
+
+    std::optional<T> access(const RowID& row_id) {
+      if (row_id.is_null()) return std::nullopt;
+
+      auto& accessor = _accessors[row_id.chunk_id];
+      if (!accessor) {
+        accessor = create_segment_accessor<T>(_table.get_chunk(row_id.chunk_id)->get_segment(_column_id));
+      }
+      return accessor->access(row_id.chunk_offset);
+    }
+
+    // Retrieves the values of the @param count rows into values() and null_values()
+    void access(const RowID* row_ids, const size_t count) {
+      _values.resize(count);
+      if (_null_value_capacity < count) {
+        _null_values = std::make_unique<bool[]>(count);
+        _null_value_capacity = count;
+      }
+
+      // A single row does not profit from batching, but access_row_ids() would need to allocate its offset list
+      if (count == 1) {
+        auto value = access(row_ids[0]);
+        _null_values[0] = !value;
+        if (value) _values[0] = std::move(*value);
+        return;
+      }
+
+      access_row_ids(_table, _column_id, row_ids, row_ids + count, _accessors, _values.data(), _null_values.get());
+    }
+
+    const std::vector<T>& values() const { return _values; }
+    const bool* null_values() const { return _null_values.get(); }
+
+   private:
+    const Table& _table;
+    const ColumnID _column_id;
+    std::vector<std::unique_ptr<AbstractSegmentAccessor<T>>> _accessors;
+
+    std::vector<T> _values;
+    std::unique_ptr<bool[]> _null_values;
+    size_t _null_value_capacity{0};
+  };
+
   class BaseFieldComparator : public Noncopyable {
    public:
-    virtual bool compare(const RowID& left, const RowID& right) const = 0;
+    virtual bool compare(const RowID& left, const RowID& right) = 0;
+    virtual void compare(const RowID& left, const RowID* right_row_ids, const size_t count,
+                         std::vector<bool>& matches) = 0;
+    virtual void compare(const RowID* left_row_ids, const size_t count, const RowID& right,
+                         std::vector<bool>& matches) = 0;
     virtual ~BaseFieldComparator() = default;
   };
 
   template <typename CompareFunctor, typename L, typename R>
   class FieldComparator : public BaseFieldComparator {
    public:
-    FieldComparator(CompareFunctor compare_functor,
-                    std::vector<std::unique_ptr<AbstractSegmentAccessor<L>>> left_accessors,
-                    std::vector<std::unique_ptr<AbstractSegmentAccessor<R>>> right_accessors)
+    FieldComparator(CompareFunctor compare_functor, ColumnAccessor<L> left_accessor, ColumnAccessor<R> right_accessor)
         : _compare_functor{std::move(compare_functor)},
-          _left_accessors{std::move(left_accessors)},
-          _right_accessors{std::move(right_accessors)} {}
+          _left_accessor{std::move(left_accessor)},
+          _right_accessor{std::move(right_accessor)} {}
 
     /**
      * Tests the value behind the left and right RowID for equality.
      */
-    bool compare(const RowID& left, const RowID& right) const override {
-      const auto left_value = _left_accessors[left.chunk_id]->access(left.chunk_offset);
-      const auto right_value = _right_accessors[right.chunk_id]->access(right.chunk_offset);
+    bool compare(const RowID& left, const RowID& right) override {
+      const auto left_value = _left_accessor.access(left);
+      const auto right_value = _right_accessor.access(right);
       // NULL value handling:
       // If either left or right value is NULL, the comparison will evaluate to false.
       // If both left and right are NULL, the comparison evaluates to false by definition.
@@ -49,17 +120,48 @@ class MultiPredicateJoinEvaluator {
       }
     }
 
+    // Clears the entries of matches whose rows do not satisfy the predicate
+    void compare(const RowID& left, const RowID* right_row_ids, const size_t count,
+                 std::vector<bool>& matches) override {
+      const auto left_value = _left_accessor.access(left);
+      if (!left_value) {
+        matches.assign(count, false);
+        return;
+      }
+
+      _right_accessor.access(right_row_ids, count);
+      const auto& right_values = _right_accessor.values();
+      const auto* right_null_values = _right_accessor.null_values();
+      for (auto index = size_t{0}; index < count; ++index) {
+        matches[index] =
+            matches[index] && !right_null_values[index] && _compare_functor(*left_value, right_values[index]);
+      }
+    }
+
+    void compare(const RowID* left_row_ids, const size_t count, const RowID& right,
+                 std::vector<bool>& matches) override {
+      const auto right_value = _right_accessor.access(right);
+      if (!right_value) {
+        matches.assign(count, false);
+        return;
+      }
+
+      _left_accessor.access(left_row_ids, count);
+      const auto& left_values = _left_accessor.values();
+      const auto* left_null_values = _left_accessor.null_values();
+      for (auto index = size_t{0}; index < count; ++index) {
+        matches[index] =
+            matches[index] && !left_null_values[index] && _compare_functor(left_values[index], *right_value);
+      }
+    }
+
    private:
     const CompareFunctor _compare_functor;
-    const std::vector<std::unique_ptr<AbstractSegmentAccessor<L>>> _left_accessors;
-    const std::vector<std::unique_ptr<AbstractSegmentAccessor<R>>> _right_accessors;
+    ColumnAccessor<L> _left_accessor;
+    ColumnAccessor<R> _right_accessor;
   };
 
   std::vector<std::unique_ptr<BaseFieldComparator>> _comparators;
-
-  template <typename T>
-  static std::vector<std::unique_ptr<AbstractSegmentAccessor<T>>> _create_accessors(const Table& table,
-                                                                                    const ColumnID column_id);
 };
 
 }  // namespace opossum
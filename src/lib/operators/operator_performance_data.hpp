@@ -7,13 +7,23 @@
 
 namespace opossum {
 
-// For an example on how this can be extended on a per-operator basis, see JoinIndex
+// For an example on how this can be extended on a per-operator basis, see JoinIndex or JoinHash
 
 struct OperatorPerformanceData : public Noncopyable {
   virtual ~OperatorPerformanceData() = default;
 
   std::chrono::nanoseconds walltime{0};
 
+  // Sizes of the input and output tables, set by AbstractOperator::execute(). Counting the rows of a table only
+  // requires a pass over its chunks, so these are recorded for every execution.
+  uint64_t input_row_count_left{0};
+  uint64_t input_row_count_right{0};
+  uint64_t output_row_count{0};
+  uint64_t output_chunk_count{0};
+
+  // Peak number of bytes allocated through the operator's memory resource, if it has one (see AbstractOperator)
+  uint64_t peak_memory_bytes{0};
+
   virtual std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const;
 };
 
@@ -30,6 +30,15 @@ std::optional<AllParameterVariant> resolve_all_parameter_variant(const AbstractE
   return value;
 }
 
+// NullValues do not compare equal (see null_value.hpp), but two predicates on NULL are the same predicate
+bool parameter_variants_equal(const AllParameterVariant& lhs, const AllParameterVariant& rhs) {
+  if (is_variant(lhs) && is_variant(rhs) && variant_is_null(boost::get<AllTypeVariant>(lhs)) &&
+      variant_is_null(boost::get<AllTypeVariant>(rhs))) {
+    return true;
+  }
+  return lhs == rhs;
+}
+
 }  // namespace
 
 namespace opossum {
@@ -135,4 +144,11 @@ OperatorScanPredicate::OperatorScanPredicate(const ColumnID column_id, const Pre
                                              const std::optional<AllParameterVariant>& value2)
     : column_id(column_id), predicate_condition(predicate_condition), value(value), value2(value2) {}
 
+bool operator==(const OperatorScanPredicate& lhs, const OperatorScanPredicate& rhs) {
+  if (lhs.column_id != rhs.column_id || lhs.predicate_condition != rhs.predicate_condition) return false;
+  if (!parameter_variants_equal(lhs.value, rhs.value)) return false;
+  if (static_cast<bool>(lhs.value2) != static_cast<bool>(rhs.value2)) return false;
+  return !lhs.value2 || parameter_variants_equal(*lhs.value2, *rhs.value2);
+}
+
 }  // namespace opossum
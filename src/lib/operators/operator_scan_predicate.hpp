@@ -39,4 +39,6 @@ struct OperatorScanPredicate {
   std::optional<AllParameterVariant> value2;
 };
 
+bool operator==(const OperatorScanPredicate& lhs, const OperatorScanPredicate& rhs);
+
 }  // namespace opossum
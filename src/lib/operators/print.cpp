@@ -198,6 +198,14 @@ std::string Print::_segment_type(const std::shared_ptr<BaseSegment>& segment) co
         segment_type += "LZ4";
         break;
       }
+      case EncodingType::Delta: {
+        segment_type += "Dlt";
+        break;
+      }
+      case EncodingType::DecimalScaled: {
+        segment_type += "DSc";
+        break;
+      }
     }
     if (encoded_segment->compressed_vector_type()) {
       switch (*encoded_segment->compressed_vector_type()) {
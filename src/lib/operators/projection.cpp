@@ -8,10 +8,13 @@
 #include <utility>
 #include <vector>
 
+#include "expression/evaluation/correlated_subquery_result_cache.hpp"
 #include "expression/evaluation/expression_evaluator.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -50,37 +53,59 @@ std::shared_ptr<const Table> Projection::_on_execute() {
 
   const auto uncorrelated_subquery_results =
       ExpressionEvaluator::populate_uncorrelated_subquery_results_cache(expressions);
-
-  auto column_is_nullable = std::vector<bool>(expressions.size(), false);
+  const auto correlated_subquery_result_cache = std::make_shared<CorrelatedSubqueryResultCache>();
 
   /**
-   * Perform the projection
+   * Perform the projection. Each chunk is projected by its own job. The jobs write into their own slots of
+   * output_chunk_segments, so the order of the output chunks does not depend on the order in which the jobs finish.
    */
-  auto output_chunk_segments = std::vector<Segments>(input_table_left()->chunk_count());
-
-  for (auto chunk_id = ChunkID{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
-    Segments output_segments;
-    output_segments.reserve(expressions.size());
+  const auto input_table = input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  auto output_chunk_segments = std::vector<Segments>(chunk_count);
+
+  // Nullability of the output columns per chunk, merged after all jobs are done. A shared std::vector<bool> could not
+  // be written to concurrently.
+  auto chunk_column_is_nullable = std::vector<std::vector<bool>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& output_segments = output_chunk_segments[chunk_id];
+      output_segments.reserve(expressions.size());
+
+      auto& column_is_nullable = chunk_column_is_nullable[chunk_id];
+      column_is_nullable.resize(expressions.size());
+
+      const auto input_chunk = input_table->get_chunk(chunk_id);
+
+      ExpressionEvaluator evaluator(input_table, chunk_id, uncorrelated_subquery_results,
+                                    correlated_subquery_result_cache);
+      for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+        const auto& expression = expressions[column_id];
+        // Forward input column if possible. The segment is shared with the input, not copied.
+        if (expression->type == ExpressionType::PQPColumn && forward_columns) {
+          const auto pqp_column_expression = std::static_pointer_cast<PQPColumnExpression>(expression);
+          output_segments.emplace_back(input_chunk->get_segment(pqp_column_expression->column_id));
+          column_is_nullable[column_id] = input_table->column_is_nullable(pqp_column_expression->column_id);
+        } else {
+          const auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
+          column_is_nullable[column_id] = output_segment->is_nullable();
+          output_segments.emplace_back(output_segment);
+        }
+      }
+    }));
+  }
 
-    const auto input_chunk = input_table_left()->get_chunk(chunk_id);
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
 
-    ExpressionEvaluator evaluator(input_table_left(), chunk_id, uncorrelated_subquery_results);
+  auto column_is_nullable = std::vector<bool>(expressions.size(), false);
+  for (const auto& chunk_nullability : chunk_column_is_nullable) {
     for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
-      const auto& expression = expressions[column_id];
-      // Forward input column if possible
-      if (expression->type == ExpressionType::PQPColumn && forward_columns) {
-        const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
-        output_segments.emplace_back(input_chunk->get_segment(pqp_column_expression->column_id));
-        column_is_nullable[column_id] =
-            column_is_nullable[column_id] || input_table_left()->column_is_nullable(pqp_column_expression->column_id);
-      } else {
-        const auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
-        output_segments.emplace_back(output_segment);
-        column_is_nullable[column_id] = column_is_nullable[column_id] || output_segment->is_nullable();
-      }
+      column_is_nullable[column_id] = column_is_nullable[column_id] || chunk_nullability[column_id];
     }
-
-    output_chunk_segments[chunk_id] = std::move(output_segments);
   }
 
   /**
@@ -93,11 +118,25 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   }
 
   const auto output_table =
-      std::make_shared<Table>(column_definitions, output_table_type, std::nullopt, input_table_left()->has_mvcc());
+      std::make_shared<Table>(column_definitions, output_table_type, std::nullopt, input_table->has_mvcc());
 
-  for (auto chunk_id = ChunkID{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
     output_table->append_chunk(output_chunk_segments[chunk_id]);
-    output_table->get_chunk(chunk_id)->set_mvcc_data(input_table_left()->get_chunk(chunk_id)->mvcc_data());
+    const auto input_chunk = input_table->get_chunk(chunk_id);
+    const auto output_chunk = output_table->get_chunk(chunk_id);
+    output_chunk->set_mvcc_data(input_chunk->mvcc_data());
+
+    // The projection keeps the order of the rows, so that an output column that projects the column the input chunk is
+    // sorted by is sorted as well
+    if (const auto ordered_by = input_chunk->ordered_by()) {
+      for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+        const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expressions[column_id]);
+        if (pqp_column_expression && pqp_column_expression->column_id == ordered_by->first) {
+          output_chunk->set_ordered_by({column_id, ordered_by->second});
+          break;
+        }
+      }
+    }
   }
 
   return output_table;
@@ -1,5 +1,6 @@
 #include "sort.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <string>
@@ -8,6 +9,7 @@
 #include <vector>
 
 #include "storage/reference_segment.hpp"
+#include "storage/segment_access_counter.hpp"
 #include "storage/segment_accessor.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
@@ -39,6 +41,8 @@ std::shared_ptr<const Table> Sort::_on_execute() {
   _impl = make_unique_by_data_type<AbstractReadOnlyOperatorImpl, SortImpl>(
       input_table_left()->column_data_type(_column_id), input_table_left(), _column_id, _order_by_mode,
       _output_chunk_size);
+
+  record_segment_accesses(*input_table_left(), _column_id, SegmentAccessType::Materialization);
   return _impl->_on_execute();
 }
 
@@ -82,64 +86,30 @@ class Sort::SortImplMaterializeOutput {
       resolve_data_type(column_data_type, [&](auto type) {
         using ColumnDataType = typename decltype(type)::type;
 
-        auto chunk_it = output_segments_by_chunk.begin();
-        auto chunk_offset_out = 0u;
-
-        auto value_segment_value_vector = pmr_concurrent_vector<ColumnDataType>();
-        auto value_segment_null_vector = pmr_concurrent_vector<bool>();
-
-        value_segment_value_vector.reserve(row_count_out);
-        value_segment_null_vector.reserve(row_count_out);
-
-        auto segment_ptr_and_accessor_by_chunk_id =
-            std::unordered_map<ChunkID, std::pair<std::shared_ptr<const BaseSegment>,
-                                                  std::shared_ptr<AbstractSegmentAccessor<ColumnDataType>>>>();
-        segment_ptr_and_accessor_by_chunk_id.reserve(row_count_out);
-
-        for (auto row_index = 0u; row_index < row_count_out; ++row_index) {
-          const auto [chunk_id, chunk_offset] = _row_id_value_vector->at(row_index).first;  // NOLINT
+        auto accessors =
+            std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(_table_in->chunk_count());
+        auto row_ids = std::vector<RowID>{};
 
-          auto& segment_ptr_and_typed_ptr_pair = segment_ptr_and_accessor_by_chunk_id[chunk_id];
-          auto& base_segment = segment_ptr_and_typed_ptr_pair.first;
-          auto& accessor = segment_ptr_and_typed_ptr_pair.second;
+        for (auto chunk_id_out = size_t{0}; chunk_id_out < chunk_count_out; ++chunk_id_out) {
+          const auto row_index_begin = chunk_id_out * _output_chunk_size;
+          const auto row_index_end = std::min(row_index_begin + _output_chunk_size, row_count_out);
+          const auto chunk_row_count = row_index_end - row_index_begin;
 
-          if (!base_segment) {
-            base_segment = _table_in->get_chunk(chunk_id)->get_segment(column_id);
-            accessor = create_segment_accessor<ColumnDataType>(base_segment);
+          row_ids.resize(chunk_row_count);
+          for (auto row_index = row_index_begin; row_index < row_index_end; ++row_index) {
+            row_ids[row_index - row_index_begin] = (*_row_id_value_vector)[row_index].first;
           }
 
-          // If the input segment is not a ReferenceSegment, we can take a fast(er) path
-          if (accessor) {
-            const auto typed_value = accessor->access(chunk_offset);
-            const auto is_null = !typed_value;
-            value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
-            value_segment_null_vector.push_back(is_null);
-          } else {
-            const auto value = (*base_segment)[chunk_offset];
-            const auto is_null = variant_is_null(value);
-            value_segment_value_vector.push_back(is_null ? ColumnDataType{} : type_cast_variant<ColumnDataType>(value));
-            value_segment_null_vector.push_back(is_null);
-          }
-
-          ++chunk_offset_out;
-
-          // Check if value segment is full
-          if (chunk_offset_out >= _output_chunk_size) {
-            chunk_offset_out = 0u;
-            auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                                std::move(value_segment_null_vector));
-            chunk_it->push_back(value_segment);
-            value_segment_value_vector = pmr_concurrent_vector<ColumnDataType>();
-            value_segment_null_vector = pmr_concurrent_vector<bool>();
-            ++chunk_it;
-          }
-        }
+          // Rows that were next to each other in the input mostly stay together, so that they are retrieved in batches
+          auto values = std::vector<ColumnDataType>(chunk_row_count);
+          auto null_values = std::make_unique<bool[]>(chunk_row_count);
+          access_row_ids(*_table_in, column_id, row_ids.cbegin(), row_ids.cend(), accessors, values.data(),
+                         null_values.get());
 
-        // Last segment has not been added
-        if (chunk_offset_out > 0u) {
-          auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                              std::move(value_segment_null_vector));
-          chunk_it->push_back(value_segment);
+          auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(
+              pmr_concurrent_vector<ColumnDataType>(std::move(values)),
+              pmr_concurrent_vector<bool>(null_values.get(), null_values.get() + chunk_row_count));
+          output_segments_by_chunk[chunk_id_out].push_back(value_segment);
         }
       });
     }
@@ -234,8 +204,33 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
   template <typename Comparator>
   void _sort_with_operator() {
     Comparator comparator;
-    std::stable_sort(_row_id_value_vector->begin(), _row_id_value_vector->end(),
-                     [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
+    const auto compare = [comparator](const RowIDValuePair& a, const RowIDValuePair& b) {
+      return comparator(a.second, b.second);
+    };
+
+    // If all input chunks are sorted in the requested direction (e.g., because they are the output of a previous Sort
+    // or of a table with a clustering column), the values are already in order if the chunks are. This is checked in
+    // linear time. As the NULLs were separated during the materialization, their position does not matter here.
+    auto& row_id_value_vector = *_row_id_value_vector;
+    if (_input_chunks_are_sorted() && std::is_sorted(row_id_value_vector.begin(), row_id_value_vector.end(), compare)) {
+      return;
+    }
+
+    std::stable_sort(row_id_value_vector.begin(), row_id_value_vector.end(), compare);
+  }
+
+  bool _input_chunks_are_sorted() const {
+    const auto is_ascending = [](const OrderByMode order_by_mode) {
+      return order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::AscendingNullsLast;
+    };
+
+    for (const auto& chunk : _table_in->chunks()) {
+      const auto ordered_by = chunk->ordered_by();
+      if (!ordered_by || ordered_by->first != _column_id) return false;
+      if (is_ascending(ordered_by->second) != is_ascending(_order_by_mode)) return false;
+    }
+
+    return true;
   }
 
   const std::shared_ptr<const Table> _table_in;
@@ -26,6 +26,7 @@
 #include "storage/base_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/segment_access_counter.hpp"
 #include "storage/table.hpp"
 #include "table_scan/column_between_table_scan_impl.hpp"
 #include "table_scan/column_is_null_table_scan_impl.hpp"
@@ -87,14 +88,33 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   const auto excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
 
+  // The columns the predicate is evaluated on, whose accesses are recorded for the EncodingAdvisor
+  auto predicate_column_ids = std::vector<ColumnID>{};
+  if (SegmentAccessCounter::is_enabled()) {
+    visit_expression(_predicate, [&](const auto& expression) {
+      if (const auto column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression)) {
+        predicate_column_ids.emplace_back(column_expression->column_id);
+      }
+      return ExpressionVisitation::VisitArguments;
+    });
+  }
+
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
   jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
 
   for (ChunkID chunk_id{0u}; chunk_id < in_table->chunk_count(); ++chunk_id) {
     if (excluded_chunk_set.count(chunk_id)) continue;
 
+    // The ChunkPruningRule cannot prune chunks for predicates on parameters, subqueries, or intermediate results.
+    // Now that their values are known, the chunks that cannot contain matches are skipped.
+    if (_impl->can_prune_chunk(*in_table->get_chunk(chunk_id))) continue;
+
     auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
       const auto chunk_guard = in_table->get_chunk(chunk_id);
+      for (const auto column_id : predicate_column_ids) {
+        record_segment_access(*chunk_guard, column_id, SegmentAccessType::Scan);
+      }
+
       // The actual scan happens in the sub classes of BaseTableScanImpl
       const auto matches_out = _impl->scan_chunk(chunk_id);
       if (matches_out->empty()) return;
@@ -154,8 +174,21 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
         }
       }
 
+      // A sort order of the input chunk carries over if the matches are in the order of the input rows. Scans on
+      // reference segments that reference multiple chunks group the matches by the referenced chunk (see
+      // AbstractSingleColumnTableScanImpl::_scan_reference_segment()), so that the order is lost.
+      auto matches_keep_input_order = true;
+      if (in_table->type() == TableType::References) {
+        for (const auto& segment : chunk_guard->segments()) {
+          const auto& reference_segment = static_cast<const ReferenceSegment&>(*segment);
+          matches_keep_input_order &= reference_segment.pos_list()->references_single_chunk();
+        }
+      }
+      const auto ordered_by = matches_keep_input_order ? chunk_guard->ordered_by() : std::nullopt;
+
       std::lock_guard<std::mutex> lock(output_mutex);
       output_table->append_chunk(out_segments, chunk_guard->get_allocator());
+      if (ordered_by) output_table->get_chunk(ChunkID{output_table->chunk_count() - 1})->set_ordered_by(*ordered_by);
     });
 
     jobs.push_back(job_task);
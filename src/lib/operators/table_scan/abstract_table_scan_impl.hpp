@@ -14,6 +14,8 @@
 
 namespace opossum {
 
+class Chunk;
+
 /**
  * @brief the base class of all table scan impls
  */
@@ -25,6 +27,13 @@ class AbstractTableScanImpl {
 
   virtual std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) const = 0;
 
+  /**
+   * Returns true if the statistics of the chunk show that none of its rows match, so that it does not need to be
+   * scanned. In contrast to the ChunkPruningRule, this happens at execution time, when the values of parameters and
+   * subqueries are known.
+   */
+  virtual bool can_prune_chunk(const Chunk& chunk) const { return false; }
+
  protected:
   /**
    * @defgroup The hot loop of the table scan
@@ -4,8 +4,12 @@
 #include <string>
 #include <type_traits>
 
+#include "compressed_vector_scan.hpp"
+#include "sorted_segment_search.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
@@ -26,6 +30,10 @@ ColumnBetweenTableScanImpl::ColumnBetweenTableScanImpl(const std::shared_ptr<con
 
 std::string ColumnBetweenTableScanImpl::description() const { return "ColumnBetween"; }
 
+bool ColumnBetweenTableScanImpl::can_prune_chunk(const Chunk& chunk) const {
+  return chunk_can_be_pruned(chunk, _column_id, PredicateCondition::Between, _left_value, _right_value);
+}
+
 void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
     const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
     const std::shared_ptr<const PosList>& position_filter) const {
@@ -38,6 +46,12 @@ void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
     return;
   }
 
+  const auto ordered_by = _in_table->get_chunk(chunk_id)->ordered_by();
+  if (ordered_by && ordered_by->first == _column_id) {
+    _scan_sorted_segment(segment, chunk_id, matches, position_filter, ordered_by->second);
+    return;
+  }
+
   // Select optimized or generic scanning implementation based on segment type
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
@@ -78,6 +92,12 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
   // NOLINTNEXTLINE - cpplint is drunk
   if (left_value_id == ValueID{0} && right_value_id == static_cast<ValueID>(segment.unique_values_count())) {
     // all values match
+    if (!position_filter) {
+      scan_compressed_vector_range<false>(*segment.attribute_vector(), ValueID{0}, segment.null_value_id(),
+                                          segment.null_value_id(), chunk_id, matches);
+      return;
+    }
+
     column_iterable.with_iterators(position_filter, [&](auto left_it, auto left_end) {
       static const auto always_true = [](const auto&) { return true; };
       _scan_with_iterators<true>(always_true, left_it, left_end, chunk_id, matches);
@@ -93,6 +113,13 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
 
   const auto value_id_diff = right_value_id - left_value_id;
 
+  if (!position_filter) {
+    // Evaluate the range check directly on the compressed attribute vector, see compressed_vector_scan.hpp
+    scan_compressed_vector_range<false>(*segment.attribute_vector(), left_value_id, value_id_diff,
+                                        segment.null_value_id(), chunk_id, matches);
+    return;
+  }
+
   const auto comparator = [left_value_id, value_id_diff](const auto& position) {
     // Using < here because the right value id is the upper_bound. Also, because the value ids are integers, we can do
     // a little hack here: (x >= a && x < b) === ((x - a) < (b - a)); cf. https://stackoverflow.com/a/17095534/2204581
@@ -106,4 +133,45 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
   });
 }
 
+void ColumnBetweenTableScanImpl::_scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                      PosList& matches,
+                                                      const std::shared_ptr<const PosList>& position_filter,
+                                                      const OrderByMode order_by_mode) const {
+  resolve_data_and_segment_type(segment, [&](const auto type, const auto& typed_segment) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    if constexpr (std::is_same_v<std::decay_t<decltype(typed_segment)>, ReferenceSegment>) {
+      Fail("Expected ReferenceSegments to be handled before calling this method");
+    } else {
+      auto segment_iterable = create_iterable_from_segment(typed_segment);
+      segment_iterable.with_iterators(position_filter, [&](auto segment_begin, auto segment_end) {
+        const auto typed_left_value = type_cast_variant<ColumnDataType>(_left_value);
+        const auto typed_right_value = std::optional{type_cast_variant<ColumnDataType>(_right_value)};
+        auto sorted_segment_search = SortedSegmentSearch(segment_begin, segment_end, order_by_mode,
+                                                         PredicateCondition::Between, typed_left_value,
+                                                         typed_right_value);
+
+        sorted_segment_search.scan_sorted_segment([&](auto begin, auto end) {
+          auto output_idx = matches.size();
+          matches.resize(matches.size() + std::distance(begin, end));
+
+          // Without a position filter, the matches are a range of continuous ChunkOffsets
+          if (position_filter) {
+            for (; begin != end; ++begin) {
+              matches[output_idx++] = RowID(chunk_id, begin->chunk_offset());
+            }
+          } else {
+            const auto first_offset = begin == end ? ChunkOffset{0} : begin->chunk_offset();
+            const auto distance = std::distance(begin, end);
+
+            for (auto chunk_offset = 0; chunk_offset < distance; ++chunk_offset) {
+              matches[output_idx++] = RowID(chunk_id, first_offset + chunk_offset);
+            }
+          }
+        });
+      });
+    }
+  });
+}
+
 }  // namespace opossum
@@ -28,6 +28,8 @@ class ColumnBetweenTableScanImpl : public AbstractSingleColumnTableScanImpl {
 
   std::string description() const override;
 
+  bool can_prune_chunk(const Chunk& chunk) const override;
+
  protected:
   void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                                    const std::shared_ptr<const PosList>& position_filter) const override;
@@ -39,6 +41,11 @@ class ColumnBetweenTableScanImpl : public AbstractSingleColumnTableScanImpl {
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
                                 const std::shared_ptr<const PosList>& position_filter) const;
 
+  // Binary search on segments of chunks that are ordered by the scanned column, see SortedSegmentSearch
+  void _scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+                            const std::shared_ptr<const PosList>& position_filter,
+                            const OrderByMode order_by_mode) const;
+
   const AllTypeVariant _left_value;
   const AllTypeVariant _right_value;
 };
@@ -2,6 +2,7 @@
 
 #include <memory>
 
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "storage/base_value_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
@@ -24,6 +25,10 @@ ColumnIsNullTableScanImpl::ColumnIsNullTableScanImpl(const std::shared_ptr<const
 
 std::string ColumnIsNullTableScanImpl::description() const { return "IsNullScan"; }
 
+bool ColumnIsNullTableScanImpl::can_prune_chunk(const Chunk& chunk) const {
+  return chunk_can_be_pruned(chunk, _column_id, _predicate_condition, NULL_VALUE);
+}
+
 std::shared_ptr<PosList> ColumnIsNullTableScanImpl::scan_chunk(const ChunkID chunk_id) const {
   const auto& chunk = _in_table->get_chunk(chunk_id);
   const auto& segment = chunk->get_segment(_column_id);
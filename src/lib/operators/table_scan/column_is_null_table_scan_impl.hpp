@@ -20,6 +20,8 @@ class ColumnIsNullTableScanImpl : public AbstractTableScanImpl {
 
   std::string description() const override;
 
+  bool can_prune_chunk(const Chunk& chunk) const override;
+
   // We need to override scan_chunk because we do not want ReferenceSegments to be resolved (which would remove
   // NullValues from the referencing PosList)
   std::shared_ptr<PosList> scan_chunk(const ChunkID chunk_id) const override;
@@ -4,7 +4,9 @@
 #include <utility>
 #include <vector>
 
+#include "compressed_vector_scan.hpp"
 #include "sorted_segment_search.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
@@ -24,6 +26,10 @@ ColumnVsValueTableScanImpl::ColumnVsValueTableScanImpl(const std::shared_ptr<con
 
 std::string ColumnVsValueTableScanImpl::description() const { return "ColumnVsValue"; }
 
+bool ColumnVsValueTableScanImpl::can_prune_chunk(const Chunk& chunk) const {
+  return chunk_can_be_pruned(chunk, _column_id, _predicate_condition, _value);
+}
+
 void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
     const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
     const std::shared_ptr<const PosList>& position_filter) const {
@@ -101,6 +107,13 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
   auto iterable = create_iterable_from_attribute_vector(segment);
 
   if (_value_matches_all(segment, search_value_id)) {
+    if (!position_filter) {
+      // Matches all, so include all rows except those with NULLs (i.e., value ids >= null_value_id) in the result.
+      scan_compressed_vector_range<false>(*segment.attribute_vector(), ValueID{0}, segment.null_value_id(),
+                                          segment.null_value_id(), chunk_id, matches);
+      return;
+    }
+
     iterable.with_iterators(position_filter, [&](auto it, auto end) {
       static const auto always_true = [](const auto&) { return true; };
       // Matches all, so include all rows except those with NULLs in the result.
@@ -114,6 +127,11 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
     return;
   }
 
+  if (!position_filter) {
+    _scan_attribute_vector(segment, search_value_id, chunk_id, matches);
+    return;
+  }
+
   _with_operator_for_dict_segment_scan(_predicate_condition, [&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
@@ -178,6 +196,51 @@ void ColumnVsValueTableScanImpl::_scan_sorted_segment(const BaseSegment& segment
   });
 }
 
+void ColumnVsValueTableScanImpl::_scan_attribute_vector(const BaseDictionarySegment& segment,
+                                                        const ValueID search_value_id, const ChunkID chunk_id,
+                                                        PosList& matches) const {
+  /**
+   * Without a position filter, the attribute vector is scanned sequentially. In this case, we evaluate the predicate
+   * directly on the compressed value ids (see compressed_vector_scan.hpp). For this, each predicate is translated
+   * into a range of value ids. The null value id is always the largest value id and thus excluded by the ranges.
+   *
+   * Operator          |  Matching value ids
+   * column == _value  |  [search_vid, search_vid + 1)
+   * column != _value  |  not in [search_vid, search_vid + 1) and not null
+   * column <  _value  |  [0, search_vid)
+   * column <= _value  |  [0, search_vid)
+   * column >  _value  |  [search_vid, null_value_id)
+   * column >= _value  |  [search_vid, null_value_id)
+   */
+  const auto& attribute_vector = *segment.attribute_vector();
+  const auto null_value_id = segment.null_value_id();
+
+  switch (_predicate_condition) {
+    case PredicateCondition::Equals:
+      scan_compressed_vector_range<false>(attribute_vector, search_value_id, 1u, null_value_id, chunk_id, matches);
+      return;
+
+    case PredicateCondition::NotEquals:
+      scan_compressed_vector_range<true>(attribute_vector, search_value_id, 1u, null_value_id, chunk_id, matches);
+      return;
+
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+      scan_compressed_vector_range<false>(attribute_vector, ValueID{0}, search_value_id, null_value_id, chunk_id,
+                                          matches);
+      return;
+
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      scan_compressed_vector_range<false>(attribute_vector, search_value_id, null_value_id - search_value_id,
+                                          null_value_id, chunk_id, matches);
+      return;
+
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+}
+
 ValueID ColumnVsValueTableScanImpl::_get_search_value_id(const BaseDictionarySegment& segment) const {
   switch (_predicate_condition) {
     case PredicateCondition::Equals:
@@ -20,7 +20,8 @@ namespace opossum {
  * - Value segments are scanned sequentially
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
- *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ *   enables us to detect if all or none of the values in the segment satisfy the expression. If the entire
+ *   segment is scanned, the predicate is evaluated on the compressed attribute vector using SIMD.
  */
 class ColumnVsValueTableScanImpl : public AbstractSingleColumnTableScanImpl {
  public:
@@ -29,6 +30,8 @@ class ColumnVsValueTableScanImpl : public AbstractSingleColumnTableScanImpl {
 
   std::string description() const override;
 
+  bool can_prune_chunk(const Chunk& chunk) const override;
+
  protected:
   void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                                    const std::shared_ptr<const PosList>& position_filter) const override;
@@ -49,6 +52,10 @@ class ColumnVsValueTableScanImpl : public AbstractSingleColumnTableScanImpl {
 
   ValueID _get_search_value_id(const BaseDictionarySegment& segment) const;
 
+  // Scans the entire attribute vector without decoding each value id individually
+  void _scan_attribute_vector(const BaseDictionarySegment& segment, const ValueID search_value_id,
+                              const ChunkID chunk_id, PosList& matches) const;
+
   bool _value_matches_all(const BaseDictionarySegment& segment, const ValueID search_value_id) const;
 
   bool _value_matches_none(const BaseDictionarySegment& segment, const ValueID search_value_id) const;
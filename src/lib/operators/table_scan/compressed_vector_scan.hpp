@@ -0,0 +1,251 @@
+#pragma once
+
+#if defined(__AVX512F__) || defined(__AVX512BW__)
+#include <x86intrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include "storage/pos_list.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Scan kernels that evaluate value id predicates directly on the codes of a compressed vector
+ *
+ * Every predicate on the attribute vector of a dictionary segment (=, !=, <, <=, >, >=, BETWEEN) can be expressed as
+ * a range check on the value ids: A value id `code` lies within [lower, lower + range_size) iff
+ * `static_cast<uint32_t>(code - lower) < range_size`, which is a single unsigned comparison. For NotEquals, the range
+ * check is inverted and NULLs (i.e., the null value id) are excluded.
+ *
+ * Instead of decoding the vector one value id at a time through the AttributeVectorIterable, the kernels operate on
+ * blocks of 64 codes. For each block, they compute a 64-bit match mask using SIMD comparisons on the packed 8/16/32-bit
+ * codes and only then convert the set bits into RowIDs. SIMD-BP128 vectors are unpacked block-wise (128 codes at a
+ * time) into a small buffer that is then handed to the same kernel.
+ *
+ * With AVX-512, the comparisons are done using explicit mask-producing intrinsics. Without AVX-512, the loop is written
+ * so that the compiler can auto-vectorize it (e.g., using AVX2 with -march=native).
+ *
+ * The kernels only apply to unfiltered scans, i.e., if no position_filter is given. Otherwise, the codes are not
+ * accessed sequentially and the regular iterators are used.
+ */
+namespace compressed_vector_scan {
+
+// Number of codes that are evaluated together and whose results form one match mask
+constexpr auto MASK_BLOCK_SIZE = size_t{64};
+
+// Evaluates the range predicate for `count` (<= MASK_BLOCK_SIZE) codes and returns the result as a bit mask
+template <bool Invert, typename UnsignedIntType>
+uint64_t match_mask(const UnsignedIntType* codes, const size_t count, const uint32_t lower, const uint32_t range_size,
+                    const uint32_t null_value_id) {
+  auto mask = uint64_t{0};
+
+  // NOLINTNEXTLINE
+  ;  // clang-format off
+  #pragma omp simd reduction(|:mask)
+  // clang-format on
+  for (auto index = size_t{0}; index < count; ++index) {
+    const auto code = static_cast<uint32_t>(codes[index]);
+    const auto in_range = static_cast<uint32_t>(code - lower) < range_size;
+
+    if constexpr (Invert) {
+      mask |= static_cast<uint64_t>(!in_range & (code != null_value_id)) << index;
+    } else {
+      mask |= static_cast<uint64_t>(in_range) << index;
+    }
+  }
+
+  return mask;
+}
+
+#ifdef __AVX512F__
+// Specialization for a full block of 32-bit codes. Four 16-lane unsigned comparisons produce the 64-bit mask directly.
+template <bool Invert>
+uint64_t full_block_match_mask(const uint32_t* codes, const uint32_t lower, const uint32_t range_size,
+                               const uint32_t null_value_id) {
+  const auto lower_vector = _mm512_set1_epi32(static_cast<int>(lower));
+  const auto range_size_vector = _mm512_set1_epi32(static_cast<int>(range_size));
+  [[maybe_unused]] const auto null_value_id_vector = _mm512_set1_epi32(static_cast<int>(null_value_id));
+
+  auto mask = uint64_t{0};
+  for (auto lane_group = size_t{0}; lane_group < 4; ++lane_group) {
+    const auto code_vector = _mm512_loadu_si512(codes + lane_group * 16);
+    const auto relative_vector = _mm512_sub_epi32(code_vector, lower_vector);
+
+    auto lane_mask = __mmask16{0};
+    if constexpr (Invert) {
+      lane_mask = _mm512_mask_cmpneq_epu32_mask(_mm512_cmpge_epu32_mask(relative_vector, range_size_vector),
+                                                code_vector, null_value_id_vector);
+    } else {
+      lane_mask = _mm512_cmplt_epu32_mask(relative_vector, range_size_vector);
+    }
+
+    mask |= static_cast<uint64_t>(lane_mask) << (lane_group * 16);
+  }
+  return mask;
+}
+#endif
+
+#ifdef __AVX512BW__
+// Specializations for full blocks of 8-bit and 16-bit codes. As the range is given in 32 bit, we have to make sure
+// that the bounds fit into the narrower code type. Otherwise, we fall back to the generic implementation.
+template <bool Invert>
+uint64_t full_block_match_mask(const uint8_t* codes, const uint32_t lower, const uint32_t range_size,
+                               const uint32_t null_value_id) {
+  if (lower > 0xFFu || range_size > 0xFFu || null_value_id > 0xFFu) {
+    return match_mask<Invert>(codes, MASK_BLOCK_SIZE, lower, range_size, null_value_id);
+  }
+
+  const auto code_vector = _mm512_loadu_si512(codes);
+  const auto relative_vector = _mm512_sub_epi8(code_vector, _mm512_set1_epi8(static_cast<char>(lower)));
+  const auto range_size_vector = _mm512_set1_epi8(static_cast<char>(range_size));
+
+  if constexpr (Invert) {
+    return _mm512_mask_cmpneq_epu8_mask(_mm512_cmpge_epu8_mask(relative_vector, range_size_vector), code_vector,
+                                        _mm512_set1_epi8(static_cast<char>(null_value_id)));
+  } else {
+    return _mm512_cmplt_epu8_mask(relative_vector, range_size_vector);
+  }
+}
+
+template <bool Invert>
+uint64_t full_block_match_mask(const uint16_t* codes, const uint32_t lower, const uint32_t range_size,
+                               const uint32_t null_value_id) {
+  if (lower > 0xFFFFu || range_size > 0xFFFFu || null_value_id > 0xFFFFu) {
+    return match_mask<Invert>(codes, MASK_BLOCK_SIZE, lower, range_size, null_value_id);
+  }
+
+  const auto lower_vector = _mm512_set1_epi16(static_cast<int16_t>(lower));
+  const auto range_size_vector = _mm512_set1_epi16(static_cast<int16_t>(range_size));
+  [[maybe_unused]] const auto null_value_id_vector = _mm512_set1_epi16(static_cast<int16_t>(null_value_id));
+
+  auto mask = uint64_t{0};
+  for (auto lane_group = size_t{0}; lane_group < 2; ++lane_group) {
+    const auto code_vector = _mm512_loadu_si512(codes + lane_group * 32);
+    const auto relative_vector = _mm512_sub_epi16(code_vector, lower_vector);
+
+    auto lane_mask = __mmask32{0};
+    if constexpr (Invert) {
+      lane_mask = _mm512_mask_cmpneq_epu16_mask(_mm512_cmpge_epu16_mask(relative_vector, range_size_vector),
+                                                code_vector, null_value_id_vector);
+    } else {
+      lane_mask = _mm512_cmplt_epu16_mask(relative_vector, range_size_vector);
+    }
+
+    mask |= static_cast<uint64_t>(lane_mask) << (lane_group * 32);
+  }
+  return mask;
+}
+#endif
+
+// Generic version for full blocks, used for all code widths that have no dedicated intrinsics on this machine
+template <bool Invert, typename UnsignedIntType>
+uint64_t full_block_match_mask(const UnsignedIntType* codes, const uint32_t lower, const uint32_t range_size,
+                               const uint32_t null_value_id) {
+  return match_mask<Invert>(codes, MASK_BLOCK_SIZE, lower, range_size, null_value_id);
+}
+
+// Converts the set bits of `mask` into RowIDs. `first_chunk_offset` is the offset of the code represented by bit 0.
+inline void append_matches_from_mask(uint64_t mask, const ChunkID chunk_id, const ChunkOffset first_chunk_offset,
+                                     PosList& matches_out) {
+  if (!mask) return;
+
+  auto matches_out_index = matches_out.size();
+  matches_out.resize(matches_out_index + __builtin_popcountll(mask));
+
+  // Fast path for blocks in which all rows match
+  if (mask == ~uint64_t{0}) {
+    for (auto index = ChunkOffset{0}; index < MASK_BLOCK_SIZE; ++index) {
+      matches_out[matches_out_index++] = RowID{chunk_id, first_chunk_offset + index};
+    }
+    return;
+  }
+
+  while (mask) {
+    const auto index = static_cast<ChunkOffset>(__builtin_ctzll(mask));
+    matches_out[matches_out_index++] = RowID{chunk_id, first_chunk_offset + index};
+    mask &= mask - 1;  // clear the lowest set bit
+  }
+}
+
+// Scans `size` consecutive codes starting at `codes`, the first of which has the offset `first_chunk_offset`
+template <bool Invert, typename UnsignedIntType>
+void scan_codes(const UnsignedIntType* codes, const size_t size, const ChunkOffset first_chunk_offset,
+                const uint32_t lower, const uint32_t range_size, const uint32_t null_value_id, const ChunkID chunk_id,
+                PosList& matches_out) {
+  auto index = size_t{0};
+  for (; index + MASK_BLOCK_SIZE <= size; index += MASK_BLOCK_SIZE) {
+    const auto mask = full_block_match_mask<Invert>(codes + index, lower, range_size, null_value_id);
+    append_matches_from_mask(mask, chunk_id, static_cast<ChunkOffset>(first_chunk_offset + index), matches_out);
+  }
+
+  if (index < size) {
+    const auto mask = match_mask<Invert>(codes + index, size - index, lower, range_size, null_value_id);
+    append_matches_from_mask(mask, chunk_id, static_cast<ChunkOffset>(first_chunk_offset + index), matches_out);
+  }
+}
+
+template <bool Invert>
+void scan_vector(const SimdBp128Vector& vector, const uint32_t lower, const uint32_t range_size,
+                 const uint32_t null_value_id, const ChunkID chunk_id, PosList& matches_out) {
+  using Packing = SimdBp128Packing;
+
+  const auto& data = vector.data();
+  const auto size = vector.size();
+
+  alignas(64) auto block = std::array<uint32_t, Packing::block_size>{};
+  alignas(16) auto meta_info = std::array<uint8_t, Packing::blocks_in_meta_block>{};
+
+  auto data_index = size_t{0};
+  auto absolute_index = size_t{0};
+
+  while (absolute_index < size) {
+    Packing::read_meta_info(data.data() + data_index++, meta_info.data());
+
+    for (auto block_index = size_t{0}; block_index < Packing::blocks_in_meta_block && absolute_index < size;
+         ++block_index) {
+      const auto bit_size = meta_info[block_index];
+      Packing::unpack_block(data.data() + data_index, block.data(), bit_size);
+      data_index += bit_size;
+
+      const auto block_value_count = std::min(size_t{Packing::block_size}, size - absolute_index);
+      scan_codes<Invert>(block.data(), block_value_count, static_cast<ChunkOffset>(absolute_index), lower, range_size,
+                         null_value_id, chunk_id, matches_out);
+      absolute_index += block_value_count;
+    }
+  }
+}
+
+template <bool Invert, typename UnsignedIntType>
+void scan_vector(const FixedSizeByteAlignedVector<UnsignedIntType>& vector, const uint32_t lower,
+                 const uint32_t range_size, const uint32_t null_value_id, const ChunkID chunk_id,
+                 PosList& matches_out) {
+  const auto& data = vector.data();
+  scan_codes<Invert>(data.data(), data.size(), ChunkOffset{0}, lower, range_size, null_value_id, chunk_id,
+                     matches_out);
+}
+
+}  // namespace compressed_vector_scan
+
+/**
+ * Appends the RowIDs of all codes in `attribute_vector` that lie within [lower, lower + range_size) to `matches_out`.
+ * If `Invert` is set, the RowIDs of all codes outside of that range are appended instead, except for those that are
+ * equal to `null_value_id`.
+ */
+template <bool Invert>
+void scan_compressed_vector_range(const BaseCompressedVector& attribute_vector, const ValueID lower,
+                                  const ValueID::base_type range_size, const ValueID null_value_id,
+                                  const ChunkID chunk_id, PosList& matches_out) {
+  resolve_compressed_vector_type(attribute_vector, [&](const auto& vector) {
+    compressed_vector_scan::scan_vector<Invert>(vector, static_cast<uint32_t>(lower), static_cast<uint32_t>(range_size),
+                                                static_cast<uint32_t>(null_value_id), chunk_id, matches_out);
+  });
+}
+
+}  // namespace opossum
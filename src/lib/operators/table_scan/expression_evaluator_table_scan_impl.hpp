@@ -2,6 +2,7 @@
 
 #include "abstract_table_scan_impl.hpp"
 #include "expression/abstract_expression.hpp"
+#include "expression/evaluation/correlated_subquery_result_cache.hpp"
 #include "expression/evaluation/expression_evaluator.hpp"
 
 namespace opossum {
@@ -25,6 +26,7 @@ class ExpressionEvaluatorTableScanImpl : public AbstractTableScanImpl {
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<AbstractExpression> _expression;
   std::shared_ptr<ExpressionEvaluator::UncorrelatedSubqueryResults> _uncorrelated_subquery_results;
+  std::shared_ptr<CorrelatedSubqueryResultCache> _correlated_subquery_result_cache;
 };
 
 }  // namespace opossum
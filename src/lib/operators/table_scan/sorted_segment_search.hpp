@@ -2,24 +2,28 @@
 
 #include <boost/range.hpp>
 #include <boost/range/join.hpp>
+#include <optional>
 #include <type_traits>
 
 #include "all_type_variant.hpp"
 #include "constant_mappings.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
-// Generic class which handles the actual scanning of a sorted segment
+// Generic class which handles the actual scanning of a sorted segment. For Between, search_value2 is the upper bound.
 template <typename IteratorType, typename SearchValueType>
 class SortedSegmentSearch {
  public:
   SortedSegmentSearch(IteratorType begin, IteratorType end, const OrderByMode& order_by,
-                      const PredicateCondition& predicate_condition, const SearchValueType& search_value)
+                      const PredicateCondition& predicate_condition, const SearchValueType& search_value,
+                      const std::optional<SearchValueType>& search_value2 = std::nullopt)
       : _begin{begin},
         _end{end},
         _predicate_condition{predicate_condition},
         _search_value{search_value},
+        _search_value2{search_value2},
         _is_ascending{order_by == OrderByMode::Ascending || order_by == OrderByMode::AscendingNullsLast},
         _is_nulls_first{order_by == OrderByMode::Ascending || order_by == OrderByMode::Descending} {}
 
@@ -33,25 +37,25 @@ class SortedSegmentSearch {
    * first offset will always point to an entry matching the search value, whereas last offset points to the entry
    * behind the last matching one.
    */
-  IteratorType _get_first_bound() const {
+  IteratorType _get_first_bound(const SearchValueType& search_value) const {
     if (_is_ascending) {
-      return std::lower_bound(_begin, _end, _search_value, [](const auto& segment_position, const auto& search_value) {
+      return std::lower_bound(_begin, _end, search_value, [](const auto& segment_position, const auto& search_value) {
         return segment_position.value() < search_value;
       });
     } else {
-      return std::lower_bound(_begin, _end, _search_value, [](const auto& segment_position, const auto& search_value) {
+      return std::lower_bound(_begin, _end, search_value, [](const auto& segment_position, const auto& search_value) {
         return segment_position.value() > search_value;
       });
     }
   }
 
-  IteratorType _get_last_bound() const {
+  IteratorType _get_last_bound(const SearchValueType& search_value) const {
     if (_is_ascending) {
-      return std::upper_bound(_begin, _end, _search_value, [](const auto& search_value, const auto& segment_position) {
+      return std::upper_bound(_begin, _end, search_value, [](const auto& search_value, const auto& segment_position) {
         return segment_position.value() > search_value;
       });
     } else {
-      return std::upper_bound(_begin, _end, _search_value, [](const auto& search_value, const auto& segment_position) {
+      return std::upper_bound(_begin, _end, search_value, [](const auto& search_value, const auto& segment_position) {
         return segment_position.value() < search_value;
       });
     }
@@ -60,26 +64,41 @@ class SortedSegmentSearch {
   // This function sets the offset(s) which delimit the result set based on the predicate condition and the sort order
   void _set_begin_and_end() {
     if (_predicate_condition == PredicateCondition::Equals) {
-      _begin = _get_first_bound();
-      _end = _get_last_bound();
+      _begin = _get_first_bound(_search_value);
+      _end = _get_last_bound(_search_value);
+      return;
+    }
+
+    if (_predicate_condition == PredicateCondition::Between) {
+      DebugAssert(_search_value2, "Between needs a second search value");
+      // If the lower bound exceeds the upper bound, no value matches. Searching anyway could yield an _end that
+      // precedes _begin.
+      if (_search_value > *_search_value2) {
+        _end = _begin;
+        return;
+      }
+
+      // In descending order, the values close to the upper bound come first
+      _begin = _get_first_bound(_is_ascending ? _search_value : *_search_value2);
+      _end = _get_last_bound(_is_ascending ? *_search_value2 : _search_value);
       return;
     }
 
     // clang-format off
     if (_is_ascending) {
       switch (_predicate_condition) {
-        case PredicateCondition::GreaterThanEquals: _begin = _get_first_bound(); return;
-        case PredicateCondition::GreaterThan: _begin = _get_last_bound(); return;
-        case PredicateCondition::LessThanEquals: _end = _get_last_bound(); return;
-        case PredicateCondition::LessThan: _end = _get_first_bound(); return;
+        case PredicateCondition::GreaterThanEquals: _begin = _get_first_bound(_search_value); return;
+        case PredicateCondition::GreaterThan: _begin = _get_last_bound(_search_value); return;
+        case PredicateCondition::LessThanEquals: _end = _get_last_bound(_search_value); return;
+        case PredicateCondition::LessThan: _end = _get_first_bound(_search_value); return;
         default: Fail("Unsupported predicate condition encountered");
       }
     } else {
       switch (_predicate_condition) {
-        case PredicateCondition::LessThanEquals: _begin = _get_first_bound(); return;
-        case PredicateCondition::LessThan: _begin = _get_last_bound(); return;
-        case PredicateCondition::GreaterThanEquals: _end = _get_last_bound(); return;
-        case PredicateCondition::GreaterThan: _end = _get_first_bound(); return;
+        case PredicateCondition::LessThanEquals: _begin = _get_first_bound(_search_value); return;
+        case PredicateCondition::LessThan: _begin = _get_last_bound(_search_value); return;
+        case PredicateCondition::GreaterThanEquals: _end = _get_last_bound(_search_value); return;
+        case PredicateCondition::GreaterThan: _end = _get_first_bound(_search_value); return;
         default: Fail("Unsupported predicate condition encountered");
       }
     }
@@ -95,7 +114,7 @@ class SortedSegmentSearch {
    */
   template <typename ResultConsumer>
   void _handle_not_equals(const ResultConsumer& result_consumer) {
-    const auto first_bound = _get_first_bound();
+    const auto first_bound = _get_first_bound(_search_value);
     if (first_bound == _end) {
       // Neither the _search_value nor anything greater than it are found. Call the result_consumer on the whole range
       // and skip the call to _get_last_bound().
@@ -112,7 +131,7 @@ class SortedSegmentSearch {
 
     // At this point, first_bound points to the first occurrence of _search_value.
 
-    const auto last_bound = _get_last_bound();
+    const auto last_bound = _get_last_bound(_search_value);
     if (last_bound == _end) {
       // If no value > _search_value is found, call the result_consumer from start to first occurrence and skip the
       // need for boost::join().
@@ -159,6 +178,7 @@ class SortedSegmentSearch {
   IteratorType _end;
   const PredicateCondition _predicate_condition;
   const SearchValueType _search_value;
+  const std::optional<SearchValueType> _search_value2;
   const bool _is_ascending;
   const bool _is_nulls_first;
 };
@@ -10,6 +10,7 @@
 
 #include "storage/chunk.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/selection_bitmap.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -47,6 +48,13 @@
  *      _column_cluster_offsets = {0, 2, 3}
  *
  *
+ * ### Bitmap-based union for a single ColumnCluster
+ * If the inputs consist of a single ColumnCluster (e.g., both are the results of scans on the same stored table, which
+ * is the common case for disjunctive predicates), the ReferenceMatrices are not built and nothing is sorted. Instead,
+ * a SelectionBitmap is created for each referenced chunk and the RowIDs of both inputs set their bits. Reading the
+ * bitmaps chunk by chunk yields the unique, sorted RowIDs. Each output chunk references exactly one input chunk.
+ *
+ *
  * ### TODO(anybody) for potential performance improvements
  * Instead of using a ReferenceMatrix, consider using a linked list of RowIDs for each row. Since most of the sorting
  *      will depend on the leftmost column, this way most of the time no remote memory would need to be accessed
@@ -75,6 +83,10 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
     return early_result;
   }
 
+  if (_column_cluster_offsets.size() == 1) {
+    return _union_single_column_cluster_using_bitmaps();
+  }
+
   /**
    * For each input, create a ReferenceMatrix
    */
@@ -308,6 +320,65 @@ std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
   return nullptr;
 }
 
+std::shared_ptr<const Table> UnionPositions::_union_single_column_cluster_using_bitmaps() const {
+  const auto& referenced_table = _referenced_tables.front();
+
+  // Bitmaps are only allocated for the chunks that are actually referenced by one of the inputs
+  auto bitmaps = std::vector<SelectionBitmap>(referenced_table->chunk_count());
+  auto contains_null_row_id = false;
+
+  const auto add_input = [&](const auto& input_table) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      // All columns share the same PosList, so looking at the first one is sufficient
+      const auto segment = input_table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+      const auto& pos_list = *std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+
+      for (const auto& row_id : pos_list) {
+        if (row_id.is_null()) {
+          contains_null_row_id = true;
+          continue;
+        }
+
+        auto& bitmap = bitmaps[row_id.chunk_id];
+        if (bitmap.size() == 0) {
+          bitmap.resize(static_cast<ChunkOffset>(referenced_table->get_chunk(row_id.chunk_id)->size()));
+        }
+        bitmap.set(row_id.chunk_offset);
+      }
+    }
+  };
+  add_input(input_table_left());
+  add_input(input_table_right());
+
+  auto out_table = std::make_shared<Table>(input_table_left()->column_definitions(), TableType::References);
+
+  const auto emit_chunk = [&](const std::shared_ptr<PosList>& pos_list) {
+    auto output_segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < input_table_left()->column_count(); ++column_id) {
+      output_segments.push_back(
+          std::make_shared<ReferenceSegment>(referenced_table, _referenced_column_ids[column_id], pos_list));
+    }
+    out_table->append_chunk(output_segments);
+  };
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < bitmaps.size(); ++chunk_id) {
+    const auto& bitmap = bitmaps[chunk_id];
+    if (bitmap.size() == 0) continue;
+
+    auto pos_list = std::make_shared<PosList>();
+    bitmap.append_to_pos_list(chunk_id, *pos_list);
+    pos_list->guarantee_single_chunk();
+    emit_chunk(pos_list);
+  }
+
+  // NULL_ROW_ID is the largest RowID, so it comes last - just as in the sort-based implementation
+  if (contains_null_row_id) {
+    emit_chunk(std::make_shared<PosList>(PosList{NULL_ROW_ID}));
+  }
+
+  return out_table;
+}
+
 UnionPositions::ReferenceMatrix UnionPositions::_build_reference_matrix(
     const std::shared_ptr<const Table>& input_table) const {
   ReferenceMatrix reference_matrix;
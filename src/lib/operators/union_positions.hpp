@@ -107,6 +107,9 @@ class UnionPositions : public AbstractReadOnlyOperator {
    */
   std::shared_ptr<const Table> _prepare_operator();
 
+  // Fast path if both inputs consist of a single ColumnCluster. See the docs in the cpp.
+  std::shared_ptr<const Table> _union_single_column_cluster_using_bitmaps() const;
+
   UnionPositions::ReferenceMatrix _build_reference_matrix(const std::shared_ptr<const Table>& input_table) const;
   bool _compare_reference_matrix_rows(const ReferenceMatrix& left_matrix, size_t left_row_idx,
                                       const ReferenceMatrix& right_matrix, size_t right_row_idx) const;
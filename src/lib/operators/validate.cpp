@@ -140,6 +140,11 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
 
     if (!pos_list_out->empty() > 0) {
       output->append_chunk(output_segments);
+
+      // Only invisible rows are removed, so that the output chunk keeps the order of the input chunk
+      if (const auto ordered_by = chunk_in->ordered_by()) {
+        output->get_chunk(ChunkID{output->chunk_count() - 1})->set_ordered_by(*ordered_by);
+      }
     }
   }
   return output;
@@ -19,6 +19,7 @@
 #include "strategy/predicate_placement_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
 #include "strategy/predicate_split_up_rule.hpp"
+#include "strategy/scalar_subquery_unnesting_rule.hpp"
 #include "utils/performance_warning.hpp"
 
 /**
@@ -95,6 +96,9 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<ExistsReformulationRule>());
 
+  // Unnest correlated scalar subqueries before the JoinOrderingRule runs, so that the resulting joins get ordered
+  optimizer->add_rule(std::make_unique<ScalarSubqueryUnnestingRule>());
+
   optimizer->add_rule(std::make_unique<InsertLimitInExistsRule>());
 
   optimizer->add_rule(std::make_unique<ChunkPruningRule>());
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <map>
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
@@ -57,8 +58,18 @@ void ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) co
    */
   auto table = StorageManager::get().get_table(stored_table->table_name);
   std::vector<std::shared_ptr<ChunkStatistics>> statistics;
+  std::map<ChunkID, uint64_t> mutable_chunk_statistics_versions;
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-    statistics.push_back(table->get_chunk(chunk_id)->statistics());
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) {
+      statistics.emplace_back();
+      continue;
+    }
+
+    // The zone maps of mutable chunks are widened by concurrent Inserts. Read the version before the statistics, so
+    // that GetTable detects if the chunk was widened after (or while) the pruning decision was made.
+    if (chunk->is_mutable()) mutable_chunk_statistics_versions.emplace(chunk_id, chunk->statistics_version());
+    statistics.push_back(chunk->statistics());
   }
   std::set<ChunkID> excluded_chunk_ids;
   for (auto& predicate : predicate_nodes) {
@@ -76,6 +87,47 @@ void ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) co
   } else {
     stored_table->set_excluded_chunk_ids(std::vector<ChunkID>(excluded_chunk_ids.begin(), excluded_chunk_ids.end()));
   }
+
+  // Remember the statistics versions of the excluded mutable chunks. If a previous run of this rule already recorded
+  // a version for a chunk, keep that one as it is the older one.
+  const auto& previous_statistics_versions = stored_table->excluded_chunk_statistics_versions();
+  auto excluded_chunk_statistics_versions = std::map<ChunkID, uint64_t>{};
+  for (const auto& chunk_id : stored_table->excluded_chunk_ids()) {
+    const auto previous_version_iter = previous_statistics_versions.find(chunk_id);
+    if (previous_version_iter != previous_statistics_versions.end()) {
+      excluded_chunk_statistics_versions.emplace(*previous_version_iter);
+      continue;
+    }
+
+    const auto version_iter = mutable_chunk_statistics_versions.find(chunk_id);
+    if (version_iter != mutable_chunk_statistics_versions.end()) {
+      excluded_chunk_statistics_versions.emplace(*version_iter);
+    }
+  }
+  stored_table->set_excluded_chunk_statistics_versions(excluded_chunk_statistics_versions);
+
+  auto parameter_predicates = std::vector<OperatorScanPredicate>{};
+  for (const auto& predicate_node : predicate_nodes) {
+    const auto new_parameter_predicates = _compute_parameter_predicates(*predicate_node->predicate(), *stored_table);
+    parameter_predicates.insert(parameter_predicates.end(), new_parameter_predicates.begin(),
+                                new_parameter_predicates.end());
+  }
+
+  // Same as for the excluded chunks, only keep the predicates that apply to all chains ending in the stored table node.
+  // If a previous chain had no parameter predicates, the stored (empty) list must not be replaced.
+  const auto& already_stored_parameter_predicates = stored_table->parameter_pruning_predicates();
+  if (already_stored_parameter_predicates) {
+    auto intersection = std::vector<OperatorScanPredicate>{};
+    for (const auto& parameter_predicate : parameter_predicates) {
+      if (std::find(already_stored_parameter_predicates->begin(), already_stored_parameter_predicates->end(),
+                    parameter_predicate) != already_stored_parameter_predicates->end()) {
+        intersection.emplace_back(parameter_predicate);
+      }
+    }
+    stored_table->set_parameter_pruning_predicates(intersection);
+  } else {
+    stored_table->set_parameter_pruning_predicates(parameter_predicates);
+  }
 }
 
 std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(
@@ -87,7 +139,8 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(
   std::set<ChunkID> result;
 
   for (const auto& operator_predicate : *operator_predicates) {
-    if (!is_variant(operator_predicate.value)) {
+    if (!is_variant(operator_predicate.value) ||
+        (operator_predicate.value2 && !is_variant(*operator_predicate.value2))) {
       return std::set<ChunkID>();
     }
     const auto& value = boost::get<AllTypeVariant>(operator_predicate.value);
@@ -105,6 +158,27 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(
   return result;
 }
 
+std::vector<OperatorScanPredicate> ChunkPruningRule::_compute_parameter_predicates(
+    const AbstractExpression& predicate, const StoredTableNode& stored_table_node) const {
+  const auto operator_predicates = OperatorScanPredicate::from_expression(predicate, stored_table_node);
+  if (!operator_predicates) return {};
+
+  // OperatorScanPredicates form a conjunction, so each of them can be used for pruning on its own
+  auto result = std::vector<OperatorScanPredicate>{};
+  for (const auto& operator_predicate : *operator_predicates) {
+    if (is_column_id(operator_predicate.value) ||
+        (operator_predicate.value2 && is_column_id(*operator_predicate.value2))) {
+      continue;
+    }
+
+    if (is_parameter_id(operator_predicate.value) ||
+        (operator_predicate.value2 && is_parameter_id(*operator_predicate.value2))) {
+      result.emplace_back(operator_predicate);
+    }
+  }
+  return result;
+}
+
 bool ChunkPruningRule::_is_non_filtering_node(const AbstractLQPNode& node) const {
   return node.type == LQPNodeType::Alias || node.type == LQPNodeType::Projection || node.type == LQPNodeType::Sort;
 }
@@ -15,11 +15,16 @@ class AbstractLQPNode;
 class ChunkStatistics;
 class AbstractExpression;
 class StoredTableNode;
+struct OperatorScanPredicate;
 
 /**
  * This rule determines which chunks can be excluded from table scans based on
  * the predicates present in the LQP and stores that information in the stored
  * table nodes.
+ *
+ * Predicates on parameters (e.g., placeholders of prepared statements or correlated parameters) cannot be evaluated
+ * during optimization. They are stored in the stored table nodes as well, so that GetTable can prune chunks once the
+ * parameter values are known.
  */
 class ChunkPruningRule : public AbstractRule {
  public:
@@ -31,6 +36,9 @@ class ChunkPruningRule : public AbstractRule {
                                           const AbstractExpression& predicate,
                                           const StoredTableNode& stored_table_node) const;
 
+  std::vector<OperatorScanPredicate> _compute_parameter_predicates(const AbstractExpression& predicate,
+                                                                   const StoredTableNode& stored_table_node) const;
+
   bool _is_non_filtering_node(const AbstractLQPNode& node) const;
 };
 
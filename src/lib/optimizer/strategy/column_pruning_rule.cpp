@@ -67,6 +67,7 @@ ExpressionUnorderedSet ColumnPruningRule::_collect_actually_used_columns(const s
       case LQPNodeType::DummyTable:
       case LQPNodeType::Join:
       case LQPNodeType::Limit:
+      case LQPNodeType::MetaTable:
       case LQPNodeType::Predicate:
       case LQPNodeType::Root:
       case LQPNodeType::ShowColumns:
@@ -64,8 +64,10 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
 
   const auto& operator_predicate = (*operator_predicates)[0];
 
-  // Currently, we do not support two-column predicates
-  if (is_column_id(operator_predicate.value)) return false;
+  // Currently, we do not support two-column predicates. IndexScans also need the values when the plan is translated,
+  // so predicates on parameters (e.g., in cached, parameterized plans) are not supported either.
+  if (!is_variant(operator_predicate.value)) return false;
+  if (operator_predicate.value2 && !is_variant(*operator_predicate.value2)) return false;
 
   if (index_info.column_ids[0] != operator_predicate.column_id) return false;
 
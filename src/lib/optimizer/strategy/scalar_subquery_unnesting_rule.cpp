@@ -0,0 +1,261 @@
+#include "scalar_subquery_unnesting_rule.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "expression/aggregate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "expression/lqp_subquery_expression.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// A predicate `inner_column = parameter` in the subquery that becomes a join predicate
+struct CorrelationPredicate {
+  std::shared_ptr<PredicateNode> predicate_node;
+  std::shared_ptr<AbstractExpression> inner_column;
+  ParameterID parameter_id;
+};
+
+// Returns whether @param expression is NULL if all aggregates in it are NULL. This holds for arithmetics over literals
+// and at least one aggregate.
+bool is_null_if_aggregates_are_null(const std::shared_ptr<AbstractExpression>& expression) {
+  auto contains_aggregate = false;
+  auto only_arithmetics = true;
+
+  visit_expression(expression, [&](const auto& sub_expression) {
+    switch (sub_expression->type) {
+      case ExpressionType::Aggregate:
+        contains_aggregate = true;
+        return ExpressionVisitation::DoNotVisitArguments;
+      case ExpressionType::Arithmetic:
+        return ExpressionVisitation::VisitArguments;
+      case ExpressionType::Value:
+        return ExpressionVisitation::DoNotVisitArguments;
+      default:
+        only_arithmetics = false;
+        return ExpressionVisitation::DoNotVisitArguments;
+    }
+  });
+
+  return contains_aggregate && only_arithmetics;
+}
+
+std::optional<CorrelationPredicate> extract_correlation_predicate(const std::shared_ptr<PredicateNode>& predicate_node,
+                                                                  const std::vector<ParameterID>& parameter_ids) {
+  const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate_node->predicate());
+  if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) return std::nullopt;
+
+  auto column_idx = size_t{0};
+  if (binary_predicate->arguments[0]->type == ExpressionType::CorrelatedParameter) {
+    column_idx = 1;
+  } else if (binary_predicate->arguments[1]->type != ExpressionType::CorrelatedParameter) {
+    return std::nullopt;
+  }
+
+  const auto& inner_column = binary_predicate->arguments[column_idx];
+  if (inner_column->type != ExpressionType::LQPColumn) return std::nullopt;
+
+  const auto parameter_id =
+      std::static_pointer_cast<CorrelatedParameterExpression>(binary_predicate->arguments[1 - column_idx])
+          ->parameter_id;
+  if (std::find(parameter_ids.begin(), parameter_ids.end(), parameter_id) == parameter_ids.end()) return std::nullopt;
+
+  return CorrelationPredicate{predicate_node, inner_column, parameter_id};
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string ScalarSubqueryUnnestingRule::name() const { return "Correlated Scalar Subquery Unnesting Rule"; }
+
+void ScalarSubqueryUnnestingRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  // Find a PredicateNode comparing something to a correlated subquery
+  const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
+  const auto binary_predicate =
+      predicate_node ? std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate_node->predicate()) : nullptr;
+  if (!binary_predicate) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  auto subquery_idx = size_t{0};
+  auto subquery_expression = std::dynamic_pointer_cast<LQPSubqueryExpression>(binary_predicate->arguments[0]);
+  if (!subquery_expression) {
+    subquery_idx = 1;
+    subquery_expression = std::dynamic_pointer_cast<LQPSubqueryExpression>(binary_predicate->arguments[1]);
+  }
+
+  if (!subquery_expression || !subquery_expression->is_correlated()) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  // The subquery LQP might be shared with other expressions, so we rewrite a copy of it. If we bail out later, the
+  // copy is simply discarded.
+  const auto subquery_lqp = subquery_expression->lqp->deep_copy();
+  if (subquery_lqp->column_expressions().size() != 1) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  const auto subquery_value = subquery_lqp->column_expressions().front();
+
+  // Check the shape of the subquery above the correlated predicates: [Projection ->] Aggregate
+  const auto projection_node = std::dynamic_pointer_cast<ProjectionNode>(subquery_lqp);
+  const auto aggregate_node =
+      std::dynamic_pointer_cast<AggregateNode>(projection_node ? projection_node->left_input() : subquery_lqp);
+  if (!aggregate_node || aggregate_node->aggregate_expressions_begin_idx != 0 ||
+      !is_null_if_aggregates_are_null(subquery_value)) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  const auto& aggregate_expressions = aggregate_node->node_expressions;
+  const auto all_aggregates_null_on_empty_input =
+      std::all_of(aggregate_expressions.begin(), aggregate_expressions.end(), [](const auto& expression) {
+        const auto aggregate_function = std::static_pointer_cast<AggregateExpression>(expression)->aggregate_function;
+        return aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct;
+      });
+  if (!all_aggregates_null_on_empty_input) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  // Each parameter has to be used exactly once, so that it can be replaced by a join predicate
+  auto parameter_usage_counts = std::unordered_map<ParameterID, size_t>{};
+  visit_lqp(subquery_lqp, [&](const auto& subquery_node) {
+    for (const auto& expression : subquery_node->node_expressions) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        const auto parameter_expression = std::dynamic_pointer_cast<CorrelatedParameterExpression>(sub_expression);
+        if (parameter_expression) ++parameter_usage_counts[parameter_expression->parameter_id];
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  // Find the correlated predicates below the AggregateNode. Only descend into nodes that a predicate can be pulled up
+  // through without changing the result.
+  auto correlation_predicates = std::vector<CorrelationPredicate>{};
+  visit_lqp(aggregate_node->left_input(), [&](const auto& subquery_node) {
+    switch (subquery_node->type) {
+      case LQPNodeType::Predicate: {
+        const auto correlation_predicate = extract_correlation_predicate(
+            std::static_pointer_cast<PredicateNode>(subquery_node), subquery_expression->parameter_ids);
+        if (correlation_predicate) correlation_predicates.emplace_back(*correlation_predicate);
+        return LQPVisitation::VisitInputs;
+      }
+
+      case LQPNodeType::Join: {
+        const auto join_mode = std::static_pointer_cast<JoinNode>(subquery_node)->join_mode;
+        return join_mode == JoinMode::Inner || join_mode == JoinMode::Cross ? LQPVisitation::VisitInputs
+                                                                            : LQPVisitation::DoNotVisitInputs;
+      }
+
+      case LQPNodeType::Projection:
+      case LQPNodeType::Sort:
+      case LQPNodeType::Validate:
+        return LQPVisitation::VisitInputs;
+
+      default:
+        return LQPVisitation::DoNotVisitInputs;
+    }
+  });
+
+  const auto parameter_count = subquery_expression->parameter_count();
+  const auto all_parameters_replaceable =
+      correlation_predicates.size() == parameter_count &&
+      std::all_of(correlation_predicates.begin(), correlation_predicates.end(), [&](const auto& correlation_predicate) {
+        return parameter_usage_counts[correlation_predicate.parameter_id] == 1;
+      });
+  if (!all_parameters_replaceable) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  // The outer expressions of the join predicates must be available below the original PredicateNode
+  const auto outer_input = predicate_node->left_input();
+  auto join_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& correlation_predicate : correlation_predicates) {
+    const auto parameter_idx = static_cast<size_t>(
+        std::find(subquery_expression->parameter_ids.begin(), subquery_expression->parameter_ids.end(),
+                  correlation_predicate.parameter_id) -
+        subquery_expression->parameter_ids.begin());
+    const auto outer_expression = subquery_expression->parameter_expression(parameter_idx);
+    if (!outer_input->find_column_id(*outer_expression)) {
+      _apply_to_inputs(node);
+      return;
+    }
+    join_predicates.emplace_back(equals_(outer_expression, correlation_predicate.inner_column));
+  }
+
+  // Remove the correlated predicates from the subquery. The inner columns must still reach the AggregateNode, i.e.,
+  // they must not have been pruned by a ProjectionNode in between.
+  for (const auto& correlation_predicate : correlation_predicates) {
+    lqp_remove_node(correlation_predicate.predicate_node);
+  }
+
+  const auto aggregate_input = aggregate_node->left_input();
+  auto group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& correlation_predicate : correlation_predicates) {
+    if (!aggregate_input->find_column_id(*correlation_predicate.inner_column)) {
+      _apply_to_inputs(node);
+      return;
+    }
+    const auto already_grouped =
+        std::any_of(group_by_expressions.begin(), group_by_expressions.end(),
+                    [&](const auto& expression) { return *expression == *correlation_predicate.inner_column; });
+    if (!already_grouped) group_by_expressions.emplace_back(correlation_predicate.inner_column);
+  }
+
+  // Build the derived table, which is the subquery grouped by the correlated columns
+  aggregate_node->set_left_input(nullptr);
+  auto derived_table = std::shared_ptr<AbstractLQPNode>{
+      AggregateNode::make(group_by_expressions, aggregate_expressions, aggregate_input)};
+  if (projection_node) {
+    auto projection_expressions = group_by_expressions;
+    projection_expressions.insert(projection_expressions.end(), projection_node->node_expressions.begin(),
+                                  projection_node->node_expressions.end());
+    derived_table = ProjectionNode::make(projection_expressions, derived_table);
+  }
+
+  // Replace the PredicateNode with
+  //   Projection (to restore the original columns) -> Predicate (comparing to the subquery value) -> Join
+  auto outer_column_expressions = outer_input->column_expressions();
+  auto comparison_arguments = binary_predicate->arguments;
+  comparison_arguments[subquery_idx] = subquery_value;
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, join_predicates, outer_input, derived_table);
+  const auto comparison_node = PredicateNode::make(
+      std::make_shared<BinaryPredicateExpression>(binary_predicate->predicate_condition, comparison_arguments[0],
+                                                  comparison_arguments[1]),
+      join_node);
+  const auto restoring_projection_node = ProjectionNode::make(outer_column_expressions, comparison_node);
+
+  const auto outputs = predicate_node->outputs();
+  const auto input_sides = predicate_node->get_input_sides();
+  for (auto output_idx = size_t{0}; output_idx < outputs.size(); ++output_idx) {
+    outputs[output_idx]->set_input(input_sides[output_idx], restoring_projection_node);
+  }
+  predicate_node->set_left_input(nullptr);
+
+  _apply_to_inputs(join_node);
+}
+
+}  // namespace opossum
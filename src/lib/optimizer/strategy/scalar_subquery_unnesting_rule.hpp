@@ -0,0 +1,34 @@
+#pragma once
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+// Rewrites predicates comparing a value to a correlated scalar subquery, such as
+//   `SELECT * FROM t1 WHERE t1.b > (SELECT AVG(t2.b) FROM t2 WHERE t2.a = t1.a)`
+// into an inner join with a derived table that is pre-aggregated per correlation key:
+//   `SELECT t1.* FROM t1 JOIN (SELECT t2.a, AVG(t2.b) AS avg_b FROM t2 GROUP BY t2.a) d ON t1.a = d.a
+//    WHERE t1.b > d.avg_b`
+// Instead of executing the subquery once per outer row, it is executed once overall.
+//
+// The rewrite is correct because the subquery result is NULL for outer rows without a matching group, so the original
+// predicate could never have been true for them, which is exactly what the inner join discards.
+//
+// Covers subqueries consisting of
+//   - an optional ProjectionNode that computes arithmetics on the aggregates
+//   - an AggregateNode without GROUP BY and without COUNT (COUNT returns 0, not NULL, for empty input)
+//   - below that, one PredicateNode `inner_column = parameter` per correlated parameter. The parameter must not be
+//     used anywhere else. Between the AggregateNode and these PredicateNodes, there may be Predicate-, Validate-,
+//     Sort-, Projection- and inner/cross JoinNodes.
+// Does not cover - subqueries outside of PredicateNodes (e.g., in the SELECT list)
+//                - predicates in which the subquery is nested in other expressions (e.g., in an OR)
+//                - correlated predicates other than `=` (because the derived table is joined on them)
+class ScalarSubqueryUnnestingRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,104 @@
+#include "admission_controller.hpp"
+
+#include <future>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AdmissionController::Admission::Admission(const size_t projected_bytes, const std::optional<size_t>& memory_budget)
+    : _projected_bytes(projected_bytes), _memory_budget(memory_budget) {}
+
+AdmissionController::Admission::~Admission() { AdmissionController::get()._release(_projected_bytes); }
+
+size_t AdmissionController::Admission::projected_bytes() const { return _projected_bytes; }
+
+const std::optional<size_t>& AdmissionController::Admission::memory_budget() const { return _memory_budget; }
+
+void AdmissionController::set_memory_limit(const std::optional<size_t>& memory_limit) {
+  std::unique_lock<std::mutex> lock(_mutex);
+  _memory_limit = memory_limit;
+
+  // A higher limit might allow queued queries to be admitted
+  _admit_queued_queries(lock);
+}
+
+std::optional<size_t> AdmissionController::memory_limit() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _memory_limit;
+}
+
+void AdmissionController::admit_async(const size_t projected_bytes, AdmissionCallback on_admission) {
+  std::unique_lock<std::mutex> lock(_mutex);
+  _queued_queries.push_back({projected_bytes, std::move(on_admission)});
+  _admit_queued_queries(lock);
+}
+
+std::unique_ptr<AdmissionController::Admission> AdmissionController::admit(const size_t projected_bytes) {
+  // The promise is shared with the callback, as the callback might still be running when this thread wakes up
+  const auto promise = std::make_shared<std::promise<std::unique_ptr<Admission>>>();
+  auto future = promise->get_future();
+  admit_async(projected_bytes,
+              [promise](std::unique_ptr<Admission> admission) { promise->set_value(std::move(admission)); });
+  return future.get();
+}
+
+size_t AdmissionController::reserved_bytes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _reserved_bytes;
+}
+
+size_t AdmissionController::admitted_query_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _admitted_query_count;
+}
+
+size_t AdmissionController::queued_query_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _queued_queries.size();
+}
+
+void AdmissionController::_release(const size_t projected_bytes) {
+  std::unique_lock<std::mutex> lock(_mutex);
+  DebugAssert(_admitted_query_count > 0 && _reserved_bytes >= projected_bytes, "Released more than was admitted");
+  _reserved_bytes -= projected_bytes;
+  --_admitted_query_count;
+
+  _admit_queued_queries(lock);
+}
+
+void AdmissionController::_admit_queued_queries(std::unique_lock<std::mutex>& lock) {
+  // Queries are admitted in the order of their requests, so the first query that does not fit blocks the others
+  auto admitted_queries = std::vector<std::pair<AdmissionCallback, std::unique_ptr<Admission>>>{};
+  while (!_queued_queries.empty()) {
+    auto& queued_query = _queued_queries.front();
+    if (_memory_limit && _admitted_query_count > 0 &&
+        _reserved_bytes + queued_query.projected_bytes > *_memory_limit) {
+      break;
+    }
+
+    auto memory_budget = std::optional<size_t>{};
+    if (_memory_limit) {
+      memory_budget = _reserved_bytes < *_memory_limit ? *_memory_limit - _reserved_bytes : size_t{0};
+    }
+
+    _reserved_bytes += queued_query.projected_bytes;
+    ++_admitted_query_count;
+
+    // The constructor of Admission is private, so std::make_unique cannot be used
+    auto admission = std::unique_ptr<Admission>(new Admission(queued_query.projected_bytes, memory_budget));
+    admitted_queries.emplace_back(std::move(queued_query.on_admission), std::move(admission));
+    _queued_queries.pop_front();
+  }
+  lock.unlock();
+
+  // The callbacks might release admissions themselves, which requires the mutex
+  for (auto& [on_admission, admission] : admitted_queries) {
+    on_admission(std::move(admission));
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * The AdmissionController limits the memory used by concurrently executed queries. Before a query is executed, the
+ * SQLPipelineStatement requests its admission with the projected memory usage of its PQP. If the projected memory
+ * usage of all admitted queries would then exceed the configured limit, the query is queued until enough admitted
+ * queries have finished. Queries are admitted in the order of their requests, so that large queries are not starved by
+ * a stream of small ones. A query whose projection alone exceeds the limit is admitted once no other query is running.
+ *
+ * As projections are rough, an admitted query receives the memory that is not reserved for other queries as its
+ * budget. Operators that adapt to their budget (e.g., JoinHash, which spills to disk) use it to stay within the limit.
+ *
+ * Waiting for the admission must not block a scheduler worker, as the queries that are waited for might need the
+ * worker to finish. Thus, queries executed through the scheduler use admit_async(). admit() blocks the calling thread
+ * and is meant for threads that are not workers.
+ *
+ * Without a memory limit (the default), all queries are admitted immediately. The AdmissionController is thread-safe.
+ */
+class AdmissionController : public Singleton<AdmissionController> {
+ public:
+  // Reserves the projected memory of an admitted query until it is destroyed
+  class Admission : public Noncopyable {
+   public:
+    ~Admission();
+
+    size_t projected_bytes() const;
+
+    // Memory that was not reserved for other queries when the query was admitted (std::nullopt if there is no limit)
+    const std::optional<size_t>& memory_budget() const;
+
+   private:
+    friend class AdmissionController;
+    Admission(const size_t projected_bytes, const std::optional<size_t>& memory_budget);
+
+    const size_t _projected_bytes;
+    const std::optional<size_t> _memory_budget;
+  };
+
+  void set_memory_limit(const std::optional<size_t>& memory_limit);
+  std::optional<size_t> memory_limit() const;
+
+  using AdmissionCallback = std::function<void(std::unique_ptr<Admission>)>;
+
+  // Requests the admission of a query with the given projected memory usage without blocking. Once the query is
+  // admitted, on_admission is called with the admission, either right away or by the thread that releases the memory
+  // that the query waited for. Thus, on_admission should do little more than scheduling the query. The admission has
+  // to be destroyed when the query has finished.
+  void admit_async(const size_t projected_bytes, AdmissionCallback on_admission);
+
+  // Blocks until a query with the given projected memory usage can be admitted
+  std::unique_ptr<Admission> admit(const size_t projected_bytes);
+
+  size_t reserved_bytes() const;
+  size_t admitted_query_count() const;
+  size_t queued_query_count() const;
+
+ private:
+  AdmissionController() = default;
+
+  friend class Singleton;
+
+  void _release(const size_t projected_bytes);
+
+  // Admits the queued queries in order as long as they fit and calls their callbacks once the mutex is unlocked
+  void _admit_queued_queries(std::unique_lock<std::mutex>& lock);
+
+  struct QueuedQuery {
+    size_t projected_bytes;
+    AdmissionCallback on_admission;
+  };
+
+  mutable std::mutex _mutex;
+
+  std::optional<size_t> _memory_limit;
+  size_t _reserved_bytes{0};
+  size_t _admitted_query_count{0};
+
+  std::deque<QueuedQuery> _queued_queries;
+};
+
+}  // namespace opossum
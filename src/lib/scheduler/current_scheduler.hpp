@@ -32,8 +32,12 @@ class CurrentScheduler {
   template <typename TaskType>
   static void wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
 
+  /**
+   * Schedules all @param tasks, preferably on the node @param preferred_node_id
+   */
   template <typename TaskType>
-  static void schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
+  static void schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks,
+                             NodeID preferred_node_id = CURRENT_NODE_ID);
 
   template <typename TaskType>
   static void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
@@ -67,11 +71,12 @@ void CurrentScheduler::wait_for_tasks(const std::vector<std::shared_ptr<TaskType
 }
 
 template <typename TaskType>
-void CurrentScheduler::schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
+void CurrentScheduler::schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks,
+                                      const NodeID preferred_node_id) {
   DTRACE_PROBE1(HYRISE, SCHEDULE_TASKS, tasks.size());
   for (auto& task : tasks) {
     DTRACE_PROBE2(HYRISE, TASKS, reinterpret_cast<uintptr_t>(&tasks), reinterpret_cast<uintptr_t>(task.get()));
-    task->schedule();
+    task->schedule(preferred_node_id);
   }
 }
 
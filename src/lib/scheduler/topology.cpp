@@ -4,6 +4,8 @@
 #include <numa.h>
 #endif
 
+#include <unistd.h>
+
 #include <algorithm>
 #include <iomanip>
 #include <memory>
@@ -22,7 +24,10 @@ const int Topology::_number_of_hardware_nodes = numa_num_configured_nodes();  //
 const int Topology::_number_of_hardware_nodes = 1;  // NOLINT
 #endif
 
-Topology::Topology() { _init_default_topology(); }
+Topology::Topology() {
+  _init_default_topology();
+  _init_cache_sizes();
+}
 
 void TopologyNode::print(std::ostream& stream, size_t indent) const {
   for (size_t i = 0; i < indent; ++i) stream << " ";
@@ -157,6 +162,10 @@ const std::vector<TopologyNode>& Topology::nodes() { return _nodes; }
 
 size_t Topology::num_cpus() const { return _num_cpus; }
 
+size_t Topology::l2_cache_size() const { return _l2_cache_size; }
+
+size_t Topology::tlb_entry_count() const { return _tlb_entry_count; }
+
 boost::container::pmr::memory_resource* Topology::get_memory_resource(int node_id) {
   DebugAssert(node_id >= 0 && node_id < static_cast<int>(_nodes.size()), "node_id is out of bounds");
   return &_memory_resources[static_cast<size_t>(node_id)];
@@ -165,6 +174,8 @@ boost::container::pmr::memory_resource* Topology::get_memory_resource(int node_i
 void Topology::print(std::ostream& stream, size_t indent) const {
   for (size_t i = 0; i < indent; ++i) stream << " ";
   stream << "Number of CPUs: " << _num_cpus << std::endl;
+  for (size_t i = 0; i < indent; ++i) stream << " ";
+  stream << "L2 cache size: " << _l2_cache_size << " bytes, TLB entries: " << _tlb_entry_count << std::endl;
   for (size_t node_idx = 0; node_idx < _nodes.size(); ++node_idx) {
     for (size_t i = 0; i < indent; ++i) stream << " ";
     stream << "Node #" << node_idx << " - ";
@@ -173,6 +184,17 @@ void Topology::print(std::ostream& stream, size_t indent) const {
   }
 }
 
+void Topology::_init_cache_sizes() {
+  // sysconf() does not support querying the cache sizes on all platforms (e.g., on macOS). Even where it does, it
+  // might return 0 if the size is unknown (e.g., in some virtual machines).
+#ifdef _SC_LEVEL2_CACHE_SIZE
+  const auto l2_cache_size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+  if (l2_cache_size > 0) {
+    _l2_cache_size = static_cast<size_t>(l2_cache_size);
+  }
+#endif
+}
+
 void Topology::_clear() {
   _nodes.clear();
   _memory_resources.clear();
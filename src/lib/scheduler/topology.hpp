@@ -83,6 +83,13 @@ class Topology final : public Singleton<Topology> {
 
   size_t num_cpus() const;
 
+  // Size of the (per-core) L2 cache in bytes. Falls back to 256 KB if it cannot be determined.
+  size_t l2_cache_size() const;
+
+  // Number of entries of the first-level data TLB. As there is no portable way to determine it, we assume 64 entries
+  // (for 4 KB pages), which is what most current x86 and ARM cores have.
+  size_t tlb_entry_count() const;
+
   boost::container::pmr::memory_resource* get_memory_resource(int node_id);
 
   void print(std::ostream& stream = std::cout, size_t indent = 0) const;
@@ -97,6 +104,8 @@ class Topology final : public Singleton<Topology> {
   void _init_non_numa_topology(uint32_t max_num_cores = 0);
   void _init_fake_numa_topology(uint32_t max_num_workers = 0, uint32_t workers_per_node = 1);
 
+  void _init_cache_sizes();
+
   void _clear();
   void _create_memory_resources();
 
@@ -104,6 +113,10 @@ class Topology final : public Singleton<Topology> {
   uint32_t _num_cpus{0};
   bool _fake_numa_topology{false};
 
+  // Unlike the nodes, the cache sizes are not affected by re-initializing the topology
+  size_t _l2_cache_size{256 * 1024};
+  size_t _tlb_entry_count{64};
+
   static const int _number_of_hardware_nodes;
 
   std::vector<NUMAMemoryResource> _memory_resources;
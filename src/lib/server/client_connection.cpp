@@ -168,48 +168,15 @@ boost::future<void> ClientConnection::send_row_description(const std::vector<Col
     PostgresWireHandler::write_value(*output_packet,
                                      htons(static_cast<uint16_t>(column_description.type_width)));  // regular int
     PostgresWireHandler::write_value(*output_packet, htonl(-1));                                    // no modifier
-    PostgresWireHandler::write_value(*output_packet, htons(0u));                                    // text format
+    PostgresWireHandler::write_value(*output_packet,
+                                     htons(static_cast<uint16_t>(column_description.format_code)));  // text or binary
   }
 
   return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
-boost::future<void> ClientConnection::send_data_row(const std::vector<std::string>& row_strings) {
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::DataRow);
-
-  /*
-  DataRow (B)
-  Byte1('D')
-  Identifies the message as a data row.
-
-  Int32
-  Length of message contents in bytes, including self.
-
-  Int16
-  The number of column values that follow (possibly zero).
-
-  Next, the following pair of fields appear for each column:
-
-  Int32
-  The length of the column value, in bytes (this count does not include itself). Can be zero. As a special case,
-  -1 indicates a NULL column value. No value bytes follow in the NULL case.
-
-  Byte n
-  The value of the column, in the format indicated by the associated format code. n is the above length.
-  */
-
-  // Number of columns in row
-  PostgresWireHandler::write_value(*output_packet, htons(static_cast<uint16_t>(row_strings.size())));
-
-  for (const auto& value_string : row_strings) {
-    // Size of string representation of value, NOT of value type's size
-    PostgresWireHandler::write_value(*output_packet, htonl(static_cast<uint32_t>(value_string.length())));
-
-    // Text mode means that all values are sent as non-terminated strings
-    PostgresWireHandler::write_string(*output_packet, value_string, false);
-  }
-
-  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+boost::future<void> ClientConnection::send_data_rows(const std::shared_ptr<OutputPacket>& data_rows) {
+  return _send_serialized_bytes_async(data_rows) >> then >> ignore_sent_bytes;
 }
 
 boost::future<void> ClientConnection::send_command_complete(const std::string& message) {
@@ -263,6 +230,30 @@ boost::future<uint64_t> ClientConnection::_send_bytes_async(const std::shared_pt
   }
 }
 
+boost::future<uint64_t> ClientConnection::_send_serialized_bytes_async(const std::shared_ptr<OutputPacket>& packet) {
+  const auto packet_size = packet->data.size();
+
+  if (_response_buffer.size() + packet_size <= _max_response_size) {
+    _response_buffer.insert(_response_buffer.end(), packet->data.begin(), packet->data.end());
+    return boost::make_ready_future<uint64_t>(packet_size);
+  }
+
+  // Larger batches are written directly from the packet instead of being copied into the response buffer. Whatever
+  // is still buffered has to be sent first so that the order of the messages is preserved.
+  auto self = shared_from_this();
+  auto write_packet = [this, self, packet, packet_size]() {
+    return boost::asio::async_write(_socket, boost::asio::buffer(packet->data), boost::asio::use_boost_future) >>
+           then >> [packet_size](uint64_t sent_bytes) {
+             // If this fails, the connection may be closed but the server will keep running.
+             Assert(sent_bytes == packet_size, "Could not send all data");
+             return static_cast<uint64_t>(sent_bytes);
+           };
+  };
+
+  if (_response_buffer.empty()) return write_packet();
+  return _flush_async() >> then >> [write_packet](uint64_t) { return write_packet(); };
+}
+
 boost::future<uint64_t> ClientConnection::_flush_async() {
   return _socket.async_send(boost::asio::buffer(_response_buffer), boost::asio::use_boost_future) >> then >>
          [=](uint64_t sent_bytes) {
@@ -14,11 +14,13 @@ struct RequestHeader;
 struct ParsePacket;
 struct BindPacket;
 enum class NetworkMessageType : unsigned char;
+enum class FormatCode : int16_t;
 
 struct ColumnDescription {
   std::string column_name;
   uint64_t object_id;
   int64_t type_width;
+  FormatCode format_code{0};
 };
 
 // This class provides a wrapper over the TCP socket and (de)serializes
@@ -48,13 +50,16 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
   boost::future<void> send_notice(const std::string& notice);
   boost::future<void> send_status_message(const NetworkMessageType& type);
   boost::future<void> send_row_description(const std::vector<ColumnDescription>& row_description);
-  boost::future<void> send_data_row(const std::vector<std::string>& row_strings);
+  // Sends a batch of DataRow messages that have been fully serialized (including their sizes) by the
+  // QueryResponseBuilder
+  boost::future<void> send_data_rows(const std::shared_ptr<OutputPacket>& data_rows);
   boost::future<void> send_command_complete(const std::string& message);
 
  protected:
   boost::future<InputPacket> _receive_bytes_async(size_t size);
 
   boost::future<uint64_t> _send_bytes_async(const std::shared_ptr<OutputPacket>& packet, bool flush = false);
+  boost::future<uint64_t> _send_serialized_bytes_async(const std::shared_ptr<OutputPacket>& packet);
   boost::future<uint64_t> _flush_async();
 
   boost::asio::ip::tcp::socket _socket;
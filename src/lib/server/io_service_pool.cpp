@@ -0,0 +1,76 @@
+#include "io_service_pool.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <iostream>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+IoServicePool::IoServicePool(size_t io_service_count) {
+  const auto& nodes = Topology::get().nodes();
+  Assert(!nodes.empty(), "Topology has no nodes");
+
+  if (io_service_count == 0) io_service_count = nodes.size();
+
+  _entries.resize(io_service_count);
+  for (auto entry_idx = size_t{0}; entry_idx < io_service_count; ++entry_idx) {
+    // Fill the nodes round-robin, so that two io_services only share a node if there are more io_services than nodes
+    const auto node_id = NodeID{static_cast<NodeID::base_type>(entry_idx % nodes.size())};
+    const auto& cpus = nodes[node_id].cpus;
+    const auto cpu_id = cpus.empty() ? INVALID_CPU_ID : cpus[(entry_idx / nodes.size()) % cpus.size()].cpu_id;
+
+    auto& entry = _entries[entry_idx];
+    entry.io_service = std::make_unique<boost::asio::io_service>(1);
+    entry.work = std::make_unique<boost::asio::io_service::work>(*entry.io_service);
+    entry.node_id = node_id;
+    entry.cpu_id = cpu_id;
+  }
+
+  // Only start the threads once all entries exist, as _entries must not be reallocated while they are running
+  for (auto& entry : _entries) {
+    entry.thread = std::thread([&io_service = *entry.io_service, cpu_id = entry.cpu_id]() {
+      _set_affinity(cpu_id);
+      io_service.run();
+    });
+  }
+}
+
+IoServicePool::~IoServicePool() { stop(); }
+
+IoServicePool::Slot IoServicePool::next() {
+  auto& entry = _entries[_next_entry_idx++ % _entries.size()];
+  return {*entry.io_service, entry.node_id};
+}
+
+size_t IoServicePool::size() const { return _entries.size(); }
+
+void IoServicePool::stop() {
+  for (auto& entry : _entries) {
+    entry.work.reset();
+    entry.io_service->stop();
+  }
+
+  for (auto& entry : _entries) {
+    if (entry.thread.joinable()) entry.thread.join();
+  }
+}
+
+void IoServicePool::_set_affinity(const CpuID cpu_id) {
+#if HYRISE_NUMA_SUPPORT
+  if (cpu_id == INVALID_CPU_ID) return;
+
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  CPU_SET(cpu_id, &cpuset);
+  auto rc = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+  if (rc != 0) {
+    // As for the scheduler's workers, not being able to pin the thread is not fatal, but probably slower
+    std::cerr << "Error calling pthread_setaffinity_np: " << rc << std::endl;
+  }
+#endif
+}
+
+}  // namespace opossum
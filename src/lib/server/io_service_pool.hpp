@@ -0,0 +1,57 @@
+#pragma once
+
+#include <boost/asio/io_service.hpp>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "scheduler/topology.hpp"
+
+namespace opossum {
+
+// A pool of io_services, each of which is run by a single thread. The threads are distributed round-robin over the
+// nodes of the Topology and pinned to one of the node's CPUs. The Server assigns every accepted connection to one of
+// the io_services, so that all network IO of a session happens on the same thread and the queries of that session are
+// scheduled on the node that thread is running on. This avoids handing every completion handler of every connection
+// through a single io_service.
+class IoServicePool {
+ public:
+  // If io_service_count is 0, one io_service per node of the Topology is used
+  explicit IoServicePool(size_t io_service_count = 0);
+  ~IoServicePool();
+
+  IoServicePool(const IoServicePool&) = delete;
+  IoServicePool& operator=(const IoServicePool&) = delete;
+
+  struct Slot {
+    boost::asio::io_service& io_service;
+    NodeID node_id;
+  };
+
+  // Returns the next io_service (in round-robin order) along with the node it is pinned to
+  Slot next();
+
+  size_t size() const;
+
+  // Stops all io_services and joins their threads. Called by the destructor.
+  void stop();
+
+ protected:
+  struct Entry {
+    std::unique_ptr<boost::asio::io_service> io_service;
+    // Keeps io_service.run() from returning while there are no connections
+    std::unique_ptr<boost::asio::io_service::work> work;
+    NodeID node_id;
+    CpuID cpu_id;
+    std::thread thread;
+  };
+
+  static void _set_affinity(CpuID cpu_id);
+
+  std::vector<Entry> _entries;
+  std::atomic<size_t> _next_entry_idx{0};
+};
+
+}  // namespace opossum
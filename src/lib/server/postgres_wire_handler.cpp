@@ -83,9 +83,17 @@ BindPacket PostgresWireHandler::handle_bind_packet(const InputPacket& packet) {
   }
 
   auto num_result_column_format_codes = ntohs(read_value<int16_t>(packet));
-  auto result_column_format_codes = read_values<int16_t>(packet, num_result_column_format_codes);
+  auto network_result_column_format_codes = read_values<int16_t>(packet, num_result_column_format_codes);
+
+  std::vector<FormatCode> result_column_format_codes;
+  result_column_format_codes.reserve(num_result_column_format_codes);
+  for (const auto network_format_code : network_result_column_format_codes) {
+    const auto format_code = static_cast<int16_t>(ntohs(network_format_code));
+    Assert(format_code == 0 || format_code == 1, "Unknown result column format code.");
+    result_column_format_codes.emplace_back(static_cast<FormatCode>(format_code));
+  }
 
-  return BindPacket{statement_name, portal, std::move(parameter_values)};
+  return BindPacket{statement_name, portal, std::move(parameter_values), std::move(result_column_format_codes)};
 }
 
 std::string PostgresWireHandler::handle_execute_packet(const InputPacket& packet) {
@@ -123,18 +131,20 @@ std::shared_ptr<OutputPacket> PostgresWireHandler::new_output_packet(NetworkMess
   return output_packet;
 }
 
-void PostgresWireHandler::write_output_packet_size(OutputPacket& packet) {
+void PostgresWireHandler::write_output_packet_size(OutputPacket& packet) { write_message_size(packet, 0); }
+
+void PostgresWireHandler::write_message_size(OutputPacket& packet, const size_t message_offset) {
   auto& data = packet.data;
   Assert(
-      data.size() >= 5,
+      data.size() >= message_offset + 5,
       "Cannot update the packet size of a packet which is less than NetworkIMessageType + dummy size (i.e. 5 bytes)");
 
   // - 1 because the message type byte does not contribute to the total size
-  auto total_bytes = htonl(static_cast<uint32_t>(data.size() - 1));
+  auto total_bytes = htonl(static_cast<uint32_t>(data.size() - message_offset - 1));
   auto size_chars = reinterpret_cast<char*>(&total_bytes);
 
-  // The size starts at byte position 1
-  const auto size_offset = 1u;
+  // The size starts at byte position 1 of the message
+  const auto size_offset = message_offset + 1u;
   for (auto byte_offset = 0u; byte_offset < sizeof(total_bytes); ++byte_offset) {
     data[size_offset + byte_offset] = size_chars[byte_offset];
   }
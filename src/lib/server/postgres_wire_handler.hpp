@@ -43,12 +43,17 @@ struct BindPacket {
   std::string statement_name;
   std::string destination_portal;
   std::vector<AllTypeVariant> params;
+  // Either empty (all columns are sent as text), a single code for all columns, or one code per column
+  std::vector<FormatCode> result_column_format_codes;
 };
 
 class PostgresWireHandler {
  public:
   static std::shared_ptr<OutputPacket> new_output_packet(NetworkMessageType type);
   static void write_output_packet_size(OutputPacket& packet);
+  // Same as above, but for a message that starts at `message_offset`, e.g., when multiple DataRow messages are
+  // written into the same packet
+  static void write_message_size(OutputPacket& packet, size_t message_offset);
 
   static uint32_t handle_startup_package(const InputPacket& packet);
   static void handle_startup_package_content(const InputPacket& packet);
@@ -1,7 +1,14 @@
 #include "query_response_builder.hpp"
 
+#include <array>
+#include <charconv>
+#include <cstring>
+
+#include "boost/endian/conversion.hpp"
+
 #include "server/postgres_wire_handler.hpp"
 #include "sql/sql_pipeline.hpp"
+#include "storage/segment_iterate.hpp"
 
 #include "SQLParserResult.h"
 
@@ -11,7 +18,58 @@ namespace opossum {
 
 using opossum::then_operator::then;
 
-std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(const std::shared_ptr<const Table>& table) {
+namespace {
+
+template <typename UnsignedIntType>
+void append_bytes(const UnsignedIntType value, ByteBuffer& buffer) {
+  const auto value_chars = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), value_chars, value_chars + sizeof(UnsignedIntType));
+}
+
+// Appends the representation of a single (non-NULL) value in the requested format to `buffer`
+template <typename ColumnDataType>
+void append_value(const ColumnDataType& value, const FormatCode format_code, ByteBuffer& buffer) {
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    // The binary representation of text is the text itself
+    buffer.insert(buffer.end(), value.cbegin(), value.cend());
+  } else {
+    if (format_code == FormatCode::Binary) {
+      // Binary values are sent in network byte order. Floating point values are sent as their IEEE 754 bit pattern.
+      if constexpr (sizeof(ColumnDataType) == 4) {
+        auto bits = uint32_t{};
+        std::memcpy(&bits, &value, sizeof(bits));
+        append_bytes(boost::endian::native_to_big(bits), buffer);
+      } else {
+        static_assert(sizeof(ColumnDataType) == 8, "Unexpected size of numeric type");
+        auto bits = uint64_t{};
+        std::memcpy(&bits, &value, sizeof(bits));
+        append_bytes(boost::endian::native_to_big(bits), buffer);
+      }
+    } else if constexpr (std::is_integral_v<ColumnDataType>) {
+      auto chars = std::array<char, 24>{};
+      const auto result = std::to_chars(chars.data(), chars.data() + chars.size(), value);
+      buffer.insert(buffer.end(), chars.data(), result.ptr);
+    } else {
+      const auto string = std::to_string(value);
+      buffer.insert(buffer.end(), string.cbegin(), string.cend());
+    }
+  }
+}
+
+}  // namespace
+
+std::vector<FormatCode> QueryResponseBuilder::build_result_formats(const std::vector<FormatCode>& format_codes,
+                                                                   const size_t column_count) {
+  if (format_codes.empty()) return std::vector<FormatCode>(column_count, FormatCode::Text);
+  if (format_codes.size() == 1) return std::vector<FormatCode>(column_count, format_codes.front());
+
+  // Not using Assert() since it includes file:line info that we don't want to hard code in tests
+  if (format_codes.size() != column_count) Fail("Number of result column format codes does not match the result.");
+  return format_codes;
+}
+
+std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(
+    const std::shared_ptr<const Table>& table, const std::vector<FormatCode>& result_formats) {
   std::vector<ColumnDescription> result;
 
   const auto& column_names = table->column_names();
@@ -46,7 +104,7 @@ std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(const
         Fail("Bad DataType");
     }
 
-    result.emplace_back(ColumnDescription{column_names[column_id], object_id, type_id});
+    result.emplace_back(ColumnDescription{column_names[column_id], object_id, type_id, result_formats[column_id]});
   }
 
   return result;
@@ -76,38 +134,113 @@ std::string QueryResponseBuilder::build_execution_info_message(const std::shared
   return sql_pipeline->metrics().to_string();
 }
 
-boost::future<uint64_t> QueryResponseBuilder::send_query_response(const send_row_t& send_row, const Table& table) {
-  // Essentially we're iterating over every row in every chunk in the table, generating and sending
-  // its string representation. However, because of the asynchronous send_row call, we have to
-  // use this two-level recursion instead of two nested for-loops
+void QueryResponseBuilder::build_data_rows(const Chunk& chunk, const std::vector<FormatCode>& result_formats,
+                                           OutputPacket& output_packet) {
+  const auto column_count = chunk.column_count();
+  const auto row_count = chunk.size();
+  DebugAssert(result_formats.size() == column_count, "Expected one format code per column");
+
+  // DataRow messages are row-oriented, but resolving the segment for every value would be expensive. Thus, we first
+  // serialize the chunk column by column, storing the values of a column back to back. `offsets` has one entry more
+  // than there are rows, so that the length of each value can be derived from the next offset.
+  struct SerializedColumn {
+    ByteBuffer values;
+    std::vector<uint32_t> offsets;
+    std::vector<bool> nulls;
+  };
+
+  auto serialized_columns = std::vector<SerializedColumn>(column_count);
+  auto serialized_size = size_t{0};
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    auto& serialized_column = serialized_columns[column_id];
+    serialized_column.offsets.reserve(row_count + 1);
+    serialized_column.nulls.reserve(row_count);
+
+    const auto format_code = result_formats[column_id];
+    segment_iterate(*chunk.get_segment(column_id), [&](const auto& position) {
+      serialized_column.offsets.emplace_back(static_cast<uint32_t>(serialized_column.values.size()));
+      serialized_column.nulls.emplace_back(position.is_null());
+      if (position.is_null()) return;
+
+      append_value(position.value(), format_code, serialized_column.values);
+    });
+    serialized_column.offsets.emplace_back(static_cast<uint32_t>(serialized_column.values.size()));
+
+    serialized_size += serialized_column.values.size();
+  }
 
-  return _send_query_response_chunks(send_row, table, ChunkID{0}) >> then >> [&]() { return table.row_count(); };
-}
+  /*
+  DataRow (B)
+  Byte1('D')
+  Identifies the message as a data row.
 
-boost::future<void> QueryResponseBuilder::_send_query_response_chunks(const send_row_t& send_row, const Table& table,
-                                                                      ChunkID current_chunk_id) {
-  if (current_chunk_id == table.chunk_count()) return boost::make_ready_future();
+  Int32
+  Length of message contents in bytes, including self.
 
-  const auto& chunk = table.get_chunk(current_chunk_id);
+  Int16
+  The number of column values that follow (possibly zero).
 
-  return _send_query_response_rows(send_row, *chunk, ChunkOffset{0}) >> then >>
-         std::bind(QueryResponseBuilder::_send_query_response_chunks, send_row, std::ref(table),
-                   ChunkID{current_chunk_id + 1});
-}
+  Next, the following pair of fields appear for each column:
+
+  Int32
+  The length of the column value, in bytes (this count does not include itself). Can be zero. As a special case,
+  -1 indicates a NULL column value. No value bytes follow in the NULL case.
+
+  Byte n
+  The value of the column, in the format indicated by the associated format code. n is the above length.
+  */
+  auto& data = output_packet.data;
+  const auto row_header_size = sizeof(NetworkMessageType) + sizeof(uint32_t) + sizeof(uint16_t);
+  data.reserve(data.size() + row_count * (row_header_size + column_count * sizeof(uint32_t)) + serialized_size);
 
-boost::future<void> QueryResponseBuilder::_send_query_response_rows(const send_row_t& send_row, const Chunk& chunk,
-                                                                    ChunkOffset current_chunk_offset) {
-  if (current_chunk_offset == chunk.size()) return boost::make_ready_future();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    const auto message_offset = data.size();
 
-  std::vector<std::string> row_strings(chunk.column_count());
+    PostgresWireHandler::write_value(output_packet, NetworkMessageType::DataRow);
+    PostgresWireHandler::write_value(output_packet, htonl(0u));
+    PostgresWireHandler::write_value(output_packet, htons(static_cast<uint16_t>(column_count)));
 
-  for (ColumnID column_id{0}; column_id < ColumnID{chunk.column_count()}; ++column_id) {
-    const auto& segment = chunk.get_segment(column_id);
-    row_strings[column_id] = type_cast_variant<pmr_string>((*segment)[current_chunk_offset]);
+    for (const auto& serialized_column : serialized_columns) {
+      if (serialized_column.nulls[chunk_offset]) {
+        PostgresWireHandler::write_value(output_packet, htonl(static_cast<uint32_t>(-1)));
+        continue;
+      }
+
+      const auto begin = serialized_column.offsets[chunk_offset];
+      const auto end = serialized_column.offsets[chunk_offset + 1];
+      PostgresWireHandler::write_value(output_packet, htonl(end - begin));
+      data.insert(data.end(), serialized_column.values.cbegin() + begin, serialized_column.values.cbegin() + end);
+    }
+
+    PostgresWireHandler::write_message_size(output_packet, message_offset);
   }
+}
 
-  return send_row(row_strings) >> then >> std::bind(QueryResponseBuilder::_send_query_response_rows, send_row,
-                                                    std::ref(chunk), ChunkOffset{current_chunk_offset + 1});
+boost::future<uint64_t> QueryResponseBuilder::send_query_response(const send_data_rows_t& send_data_rows,
+                                                                  const std::shared_ptr<const Table>& table,
+                                                                  const std::vector<FormatCode>& result_formats) {
+  // Each chunk is serialized and handed to the connection as soon as it is ready, so that the first rows are on the
+  // wire while the remaining chunks are still being serialized. Because of the asynchronous send call, we have to use
+  // recursion instead of a for-loop.
+  return _send_query_response_chunks(send_data_rows, table, result_formats, ChunkID{0}) >> then >>
+         [table]() { return table->row_count(); };
+}
+
+boost::future<void> QueryResponseBuilder::_send_query_response_chunks(const send_data_rows_t& send_data_rows,
+                                                                      const std::shared_ptr<const Table>& table,
+                                                                      const std::vector<FormatCode>& result_formats,
+                                                                      ChunkID current_chunk_id) {
+  if (current_chunk_id == table->chunk_count()) return boost::make_ready_future();
+
+  const auto& chunk = table->get_chunk(current_chunk_id);
+
+  auto data_rows = std::make_shared<OutputPacket>();
+  build_data_rows(*chunk, result_formats, *data_rows);
+
+  return send_data_rows(data_rows) >> then >>
+         std::bind(QueryResponseBuilder::_send_query_response_chunks, send_data_rows, table, result_formats,
+                   ChunkID{current_chunk_id + 1});
 }
 
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include "sql/SQLStatement.h"
 
 #include "server/client_connection.hpp"
+#include "server/postgres_wire_handler.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -12,19 +13,33 @@ class SQLPipeline;
 
 class QueryResponseBuilder {
  public:
-  static std::vector<ColumnDescription> build_row_description(const std::shared_ptr<const Table>& table);
+  // Resolves the result column format codes of a Bind message to one format code per column. No format code means
+  // that all columns are sent as text, a single format code applies to all columns.
+  static std::vector<FormatCode> build_result_formats(const std::vector<FormatCode>& format_codes,
+                                                      size_t column_count);
+
+  static std::vector<ColumnDescription> build_row_description(const std::shared_ptr<const Table>& table,
+                                                              const std::vector<FormatCode>& result_formats);
   static std::string build_command_complete_message(const AbstractOperator& root_op, uint64_t row_count);
   static std::string build_execution_info_message(const std::shared_ptr<SQLPipeline>& sql_pipeline);
 
-  using send_row_t = std::function<boost::future<void>(const std::vector<std::string>&)>;
+  // Serializes all rows of the chunk as consecutive DataRow messages into `output_packet`. Numeric columns with the
+  // binary format code are sent in PostgreSQL's binary representation (i.e., big-endian), all other columns as text.
+  static void build_data_rows(const Chunk& chunk, const std::vector<FormatCode>& result_formats,
+                              OutputPacket& output_packet);
+
+  using send_data_rows_t = std::function<boost::future<void>(const std::shared_ptr<OutputPacket>&)>;
 
-  static boost::future<uint64_t> send_query_response(const send_row_t& send_row, const Table& table);
+  // Sends the table chunk by chunk, i.e., there is one send call for all DataRow messages of a chunk
+  static boost::future<uint64_t> send_query_response(const send_data_rows_t& send_data_rows,
+                                                     const std::shared_ptr<const Table>& table,
+                                                     const std::vector<FormatCode>& result_formats);
 
  protected:
-  static boost::future<void> _send_query_response_chunks(const send_row_t& send_row, const Table& table,
+  static boost::future<void> _send_query_response_chunks(const send_data_rows_t& send_data_rows,
+                                                         const std::shared_ptr<const Table>& table,
+                                                         const std::vector<FormatCode>& result_formats,
                                                          ChunkID current_chunk_id);
-  static boost::future<void> _send_query_response_rows(const send_row_t& send_row, const Chunk& chunk,
-                                                       ChunkOffset current_chunk_offset);
 };
 
 }  // namespace opossum
@@ -1,8 +1,5 @@
 #include "server.hpp"
 
-#include <boost/asio/placeholders.hpp>
-#include <boost/bind.hpp>
-
 #include "client_connection.hpp"
 #include "server_session.hpp"
 #include "task_runner.hpp"
@@ -12,24 +9,44 @@ namespace opossum {
 
 using opossum::then_operator::then;
 
-Server::Server(boost::asio::io_service& io_service, uint16_t port)
+Server::Server(boost::asio::io_service& io_service, uint16_t port,
+               const std::shared_ptr<IoServicePool>& io_service_pool,
+               const ParameterizeLiterals parameterize_literals)
     : _io_service(io_service),
-      _acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)),
-      _socket(io_service) {
+      _io_service_pool(io_service_pool),
+      _parameterize_literals(parameterize_literals),
+      _acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)) {
   _accept_next_connection();
 }
 
 void Server::_accept_next_connection() {
-  _acceptor.async_accept(_socket, boost::bind(&Server::_start_session, this, boost::asio::placeholders::error));
+  auto* session_io_service = &_io_service;
+  auto node_id = CURRENT_NODE_ID;
+  if (_io_service_pool) {
+    const auto slot = _io_service_pool->next();
+    session_io_service = &slot.io_service;
+    node_id = slot.node_id;
+  }
+
+  // The socket is bound to the io_service of the session so that all of its completion handlers run there
+  auto socket = std::make_shared<boost::asio::ip::tcp::socket>(*session_io_service);
+  _acceptor.async_accept(*socket, [this, socket, session_io_service, node_id](boost::system::error_code error) {
+    _start_session(socket, *session_io_service, node_id, error);
+  });
 }
 
-void Server::_start_session(boost::system::error_code error) {
+void Server::_start_session(const std::shared_ptr<boost::asio::ip::tcp::socket>& socket,
+                            boost::asio::io_service& session_io_service, const NodeID node_id,
+                            boost::system::error_code error) {
   if (!error) {
-    auto connection = std::make_shared<ClientConnection>(std::move(_socket));
-    auto task_runner = std::make_shared<TaskRunner>(_io_service);
-    auto session = std::make_shared<ServerSession>(connection, task_runner);
-    // Start the session and release it once it has terminated
-    session->start() >> then >> [=]() mutable { session.reset(); };
+    // Start the session on its own io_service, as the acceptor's completion handler runs on the accepting thread
+    session_io_service.post([socket, &session_io_service, node_id, parameterize_literals = _parameterize_literals]() {
+      auto connection = std::make_shared<ClientConnection>(std::move(*socket));
+      auto task_runner = std::make_shared<TaskRunner>(session_io_service, node_id);
+      auto session = std::make_shared<ServerSession>(connection, task_runner, parameterize_literals);
+      // Start the session and release it once it has terminated
+      session->start() >> then >> [=]() mutable { session.reset(); };
+    });
   }
 
   _accept_next_connection();
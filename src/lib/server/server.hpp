@@ -3,23 +3,33 @@
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
+#include <memory>
+
+#include "io_service_pool.hpp"
 #include "server_session.hpp"
 
 namespace opossum {
 
 class Server {
  public:
-  Server(boost::asio::io_service& io_service, uint16_t port);
+  // Connections are accepted on the given io_service. If an IoServicePool is given, each connection is then handled by
+  // one of the pool's io_services (round-robin). Otherwise, all connections are handled by the given io_service.
+  // Literals of simple queries are only parameterized if requested, see SQLPipelineBuilder::with_parameterized_literals
+  Server(boost::asio::io_service& io_service, uint16_t port,
+         const std::shared_ptr<IoServicePool>& io_service_pool = nullptr,
+         ParameterizeLiterals parameterize_literals = ParameterizeLiterals::No);
 
   uint16_t get_port_number();
 
  protected:
   void _accept_next_connection();
-  void _start_session(boost::system::error_code error);
+  void _start_session(const std::shared_ptr<boost::asio::ip::tcp::socket>& socket,
+                      boost::asio::io_service& session_io_service, NodeID node_id, boost::system::error_code error);
 
   boost::asio::io_service& _io_service;
+  std::shared_ptr<IoServicePool> _io_service_pool;
+  const ParameterizeLiterals _parameterize_literals;
   boost::asio::ip::tcp::acceptor _acceptor;
-  boost::asio::ip::tcp::socket _socket;
 };
 
 }  // namespace opossum
@@ -153,11 +153,14 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
     // If there is no result table, e.g. after an INSERT command, we cannot send row data
     if (!result_table) return boost::make_ready_future<uint64_t>(0);
 
-    auto row_description = QueryResponseBuilder::build_row_description(sql_pipeline->get_result_table());
+    // The simple query protocol always uses the text format
+    const auto result_formats = QueryResponseBuilder::build_result_formats({}, result_table->column_count());
+    auto row_description = QueryResponseBuilder::build_row_description(result_table, result_formats);
 
     return _connection->send_row_description(row_description) >> then >> [=]() {
       return QueryResponseBuilder::send_query_response(
-          [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
+          [=](const std::shared_ptr<OutputPacket>& data_rows) { return _connection->send_data_rows(data_rows); },
+          result_table, result_formats);
     };
   };
 
@@ -176,7 +179,7 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_query_command(const std::string& sql) {
   auto create_sql_pipeline = [=]() {
-    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true));
+    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true, _parameterize_literals));
   };
 
   auto load_table_file = [=](std::string& file_name, std::string& table_name) {
@@ -250,7 +253,9 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_co
 
   auto task = std::make_shared<BindServerPreparedStatementTask>(prepared_plan, packet.params);
   return _task_runner->dispatch_server_task(task) >> then >>
-         [=](std::shared_ptr<AbstractOperator> physical_plan) { _portals.emplace(portal_name, physical_plan); } >>
+         [=](std::shared_ptr<AbstractOperator> physical_plan) {
+           _portals.emplace(portal_name, Portal{physical_plan, packet.result_column_format_codes});
+         } >>
          then >> [=]() { return _connection->send_status_message(NetworkMessageType::BindComplete); };
 }
 
@@ -283,7 +288,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
   auto portal_it = _portals.find(portal_name);
   Assert(portal_it != _portals.end(), "The specified portal does not exist.");
 
-  const auto physical_plan = portal_it->second;
+  const auto physical_plan = portal_it->second.physical_plan;
+  const auto result_column_format_codes = portal_it->second.result_column_format_codes;
 
   if (portal_name.empty()) _portals.erase(portal_it);
 
@@ -300,10 +306,13 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
                     []() { return uint64_t(0); };
            }
 
-           const auto row_description = QueryResponseBuilder::build_row_description(result_table);
+           const auto result_formats =
+               QueryResponseBuilder::build_result_formats(result_column_format_codes, result_table->column_count());
+           const auto row_description = QueryResponseBuilder::build_row_description(result_table, result_formats);
            return _connection->send_row_description(row_description) >> then >> [=]() {
              return QueryResponseBuilder::send_query_response(
-                 [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
+                 [=](const std::shared_ptr<OutputPacket>& data_rows) { return _connection->send_data_rows(data_rows); },
+                 result_table, result_formats);
            };
          } >>
          then >> [=](uint64_t row_count) {
@@ -17,8 +17,9 @@ namespace opossum {
 template <typename TConnection, typename TTaskRunner>
 class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<TConnection, TTaskRunner>> {
  public:
-  explicit ServerSessionImpl(std::shared_ptr<TConnection> connection, std::shared_ptr<TTaskRunner> task_runner)
-      : _connection(connection), _task_runner(task_runner) {}
+  explicit ServerSessionImpl(std::shared_ptr<TConnection> connection, std::shared_ptr<TTaskRunner> task_runner,
+                             ParameterizeLiterals parameterize_literals = ParameterizeLiterals::No)
+      : _connection(connection), _task_runner(task_runner), _parameterize_literals(parameterize_literals) {}
 
   boost::future<void> start();
 
@@ -39,9 +40,17 @@ class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<
   std::shared_ptr<TConnection> _connection;
   std::shared_ptr<TTaskRunner> _task_runner;
 
+  // Whether the literals of simple queries are parameterized, see SQLPipelineBuilder::with_parameterized_literals()
+  const ParameterizeLiterals _parameterize_literals;
+
   std::shared_ptr<TransactionContext> _transaction;
 
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  struct Portal {
+    std::shared_ptr<AbstractOperator> physical_plan;
+    std::vector<FormatCode> result_column_format_codes;
+  };
+
+  std::unordered_map<std::string, Portal> _portals;
 };
 
 // The corresponding template instantiation takes place in the .cpp
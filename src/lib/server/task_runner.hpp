@@ -14,15 +14,18 @@ namespace opossum {
 
 // This class encapsulates the io_service and thus allows the ServerSession
 // to be easily tested with a mocked version of this class.
+// Tasks are scheduled on the given node, i.e., the node that the thread running the io_service is pinned to.
 class TaskRunner {
  public:
-  explicit TaskRunner(boost::asio::io_service& io_service) : _io_service(io_service) {}
+  explicit TaskRunner(boost::asio::io_service& io_service, const NodeID node_id = CURRENT_NODE_ID)
+      : _io_service(io_service), _node_id(node_id) {}
 
   template <typename TResult>
   auto dispatch_server_task(std::shared_ptr<TResult> task) -> decltype(task->get_future());
 
  protected:
   boost::asio::io_service& _io_service;
+  const NodeID _node_id;
 };
 
 template <typename TResult>
@@ -30,7 +33,7 @@ auto TaskRunner::dispatch_server_task(std::shared_ptr<TResult> task) -> decltype
   using opossum::then_operator::then;
   using TaskList = std::vector<std::shared_ptr<AbstractTask>>;
 
-  CurrentScheduler::schedule_tasks(TaskList({task}));
+  CurrentScheduler::schedule_tasks(TaskList({task}), _node_id);
 
   return task->get_future()
       .then(boost::launch::sync,
@@ -0,0 +1,96 @@
+#include "explain_analyze.hpp"
+
+#include <memory>
+#include <optional>
+#include <regex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "operators/abstract_operator.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+std::optional<std::string> remove_explain_analyze_prefix(const std::string& sql) {
+  static const auto explain_analyze_regex = std::regex{R"(^\s*EXPLAIN\s+ANALYZE\s+)", std::regex_constants::icase};
+
+  auto match = std::smatch{};
+  if (!std::regex_search(sql, match, explain_analyze_regex)) return std::nullopt;
+  return match.suffix().str();
+}
+
+std::shared_ptr<Table> explain_analyze(const std::shared_ptr<const AbstractOperator>& pqp) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("operator_id", DataType::Int);
+  column_definitions.emplace_back("left_input_id", DataType::Int, true);
+  column_definitions.emplace_back("right_input_id", DataType::Int, true);
+  column_definitions.emplace_back("operator", DataType::String);
+  column_definitions.emplace_back("input_rows_left", DataType::Long, true);
+  column_definitions.emplace_back("input_rows_right", DataType::Long, true);
+  column_definitions.emplace_back("estimated_rows", DataType::Float, true);
+  column_definitions.emplace_back("output_rows", DataType::Long);
+  column_definitions.emplace_back("output_chunks", DataType::Long);
+  column_definitions.emplace_back("output_bytes", DataType::Long, true);
+  column_definitions.emplace_back("walltime_ns", DataType::Long);
+  column_definitions.emplace_back("peak_memory_bytes", DataType::Long, true);
+  column_definitions.emplace_back("details", DataType::String);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  // Operators are numbered in pre-order. Operators that are used by multiple consumers (diamonds) are listed once.
+  auto operators = std::vector<std::shared_ptr<const AbstractOperator>>{};
+  auto operator_ids = std::unordered_map<std::shared_ptr<const AbstractOperator>, int32_t>{};
+
+  auto collect_operators = [&](const auto& self, const std::shared_ptr<const AbstractOperator>& op) -> void {
+    if (!op || operator_ids.count(op)) return;
+    operator_ids.emplace(op, static_cast<int32_t>(operators.size()));
+    operators.emplace_back(op);
+    self(self, op->input_left());
+    self(self, op->input_right());
+  };
+  collect_operators(collect_operators, pqp);
+
+  auto has_statistics_by_node = std::unordered_map<std::shared_ptr<AbstractLQPNode>, bool>{};
+
+  for (const auto& op : operators) {
+    const auto& performance_data = op->performance_data();
+
+    auto estimated_rows = AllTypeVariant{NULL_VALUE};
+    if (op->lqp_node && lqp_has_statistics(op->lqp_node, has_statistics_by_node)) {
+      estimated_rows = op->lqp_node->get_statistics()->row_count();
+    }
+
+    // Only available if temporaries were not cleaned up
+    const auto output = op->get_output();
+    const auto output_bytes =
+        output ? AllTypeVariant{static_cast<int64_t>(output->estimate_memory_usage())} : AllTypeVariant{NULL_VALUE};
+
+    // Only available if the operator was executed with a memory resource (as done by the SQLPipelineStatement)
+    const auto peak_memory_bytes = op->memory_resource()
+                                       ? AllTypeVariant{static_cast<int64_t>(performance_data.peak_memory_bytes)}
+                                       : AllTypeVariant{NULL_VALUE};
+
+    const auto input_id = [&](const auto& input) {
+      return input ? AllTypeVariant{operator_ids.at(input)} : AllTypeVariant{NULL_VALUE};
+    };
+    const auto input_row_count = [&](const auto& input, const auto row_count) {
+      return input ? AllTypeVariant{static_cast<int64_t>(row_count)} : AllTypeVariant{NULL_VALUE};
+    };
+
+    table->append({operator_ids.at(op), input_id(op->input_left()), input_id(op->input_right()),
+                   pmr_string{op->description(DescriptionMode::SingleLine)},
+                   input_row_count(op->input_left(), performance_data.input_row_count_left),
+                   input_row_count(op->input_right(), performance_data.input_row_count_right), estimated_rows,
+                   static_cast<int64_t>(performance_data.output_row_count),
+                   static_cast<int64_t>(performance_data.output_chunk_count), output_bytes,
+                   static_cast<int64_t>(performance_data.walltime.count()), peak_memory_bytes,
+                   pmr_string{performance_data.to_string(DescriptionMode::SingleLine)}});
+  }
+
+  return table;
+}
+
+}  // namespace opossum
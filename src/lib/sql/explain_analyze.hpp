@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+/**
+ * Support for `EXPLAIN ANALYZE <statement>`: The statement is executed as usual, but instead of its result, a table
+ * describing the executed PQP is returned. It has one row per operator (in pre-order, inputs referenced by their
+ * operator_id) with the sizes of its inputs and its output, its runtime, the peak memory allocated through its memory
+ * resource, and the details of its OperatorPerformanceData (e.g., the runtimes of the individual steps of a JoinHash).
+ * If the operator was translated from an LQP node for which statistics are available, the estimated row count is
+ * listed as well, so that misestimations can be spotted.
+ *
+ * The performance data is recorded for every execution, so EXPLAIN ANALYZE only adds the cost of building the table.
+ * The output size in bytes is estimated from the output table, so temporaries must not be cleaned up during execution.
+ */
+
+// Returns @param sql without a leading "EXPLAIN ANALYZE" (case-insensitive), or std::nullopt if there is none. The
+// SQL parser does not know this statement, so the prefix is removed before parsing.
+std::optional<std::string> remove_explain_analyze_prefix(const std::string& sql);
+
+// Describes the executed @param pqp as explained above
+std::shared_ptr<Table> explain_analyze(const std::shared_ptr<const AbstractOperator>& pqp);
+
+}  // namespace opossum
@@ -0,0 +1,179 @@
+#include "parameterized_plan_cache.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include "expression/between_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "resolve_type.hpp"
+#include "storage/prepared_plan.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool expression_contains_parameters_or_subqueries(const std::shared_ptr<AbstractExpression>& expression) {
+  auto found = false;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    switch (sub_expression->type) {
+      case ExpressionType::CorrelatedParameter:
+      case ExpressionType::Placeholder:
+      case ExpressionType::LQPSubquery:
+      case ExpressionType::PQPSubquery:
+        found = true;
+        return ExpressionVisitation::DoNotVisitArguments;
+      default:
+        return ExpressionVisitation::VisitArguments;
+    }
+  });
+  return found;
+}
+
+// Replaces @param expression by a parameter if it is a non-NULL literal
+void parameterize_literal(std::shared_ptr<AbstractExpression>& expression, ParameterizedLQP& parameterized_lqp) {
+  const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(expression);
+  if (!value_expression || variant_is_null(value_expression->value)) return;
+
+  const auto parameter_id = static_cast<ParameterID>(parameterized_lqp.parameters.size());
+  const auto data_type = data_type_from_all_type_variant(value_expression->value);
+  parameterized_lqp.parameters.emplace(parameter_id, value_expression->value);
+  expression = std::make_shared<CorrelatedParameterExpression>(
+      parameter_id, CorrelatedParameterExpression::ReferencedExpressionInfo{data_type, "?"});
+}
+
+void parameterize_predicate(std::shared_ptr<AbstractExpression>& predicate, ParameterizedLQP& parameterized_lqp) {
+  if (std::dynamic_pointer_cast<LogicalExpression>(predicate)) {
+    for (auto& argument : predicate->arguments) {
+      parameterize_predicate(argument, parameterized_lqp);
+    }
+    return;
+  }
+
+  if (std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate)) {
+    auto& left_operand = predicate->arguments[0];
+    auto& right_operand = predicate->arguments[1];
+
+    // Predicate pattern: <column> <condition> <literal> or <literal> <condition> <column>
+    if (left_operand->type == ExpressionType::LQPColumn) {
+      parameterize_literal(right_operand, parameterized_lqp);
+    } else if (right_operand->type == ExpressionType::LQPColumn) {
+      parameterize_literal(left_operand, parameterized_lqp);
+    }
+    return;
+  }
+
+  if (std::dynamic_pointer_cast<BetweenExpression>(predicate)) {
+    // Predicate pattern: <column> BETWEEN <literal> AND <literal>. Both bounds need to be literals of the same type,
+    // otherwise the TableScan falls back to the ExpressionEvaluator.
+    const auto lower_bound = std::dynamic_pointer_cast<ValueExpression>(predicate->arguments[1]);
+    const auto upper_bound = std::dynamic_pointer_cast<ValueExpression>(predicate->arguments[2]);
+    if (predicate->arguments[0]->type != ExpressionType::LQPColumn || !lower_bound || !upper_bound ||
+        lower_bound->value.type() != upper_bound->value.type()) {
+      return;
+    }
+
+    parameterize_literal(predicate->arguments[1], parameterized_lqp);
+    parameterize_literal(predicate->arguments[2], parameterized_lqp);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::optional<ParameterizedLQP> parameterize_lqp(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto parameterizable = true;
+  visit_lqp(lqp, [&](const auto& node) {
+    switch (node->type) {
+      case LQPNodeType::CreatePreparedPlan:
+      case LQPNodeType::CreateView:
+        parameterizable = false;
+        return LQPVisitation::DoNotVisitInputs;
+      default:
+        break;
+    }
+
+    for (const auto& expression : node->node_expressions) {
+      if (expression_contains_parameters_or_subqueries(expression)) {
+        parameterizable = false;
+        return LQPVisitation::DoNotVisitInputs;
+      }
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+  if (!parameterizable) return std::nullopt;
+
+  auto parameterized_lqp = ParameterizedLQP{lqp->deep_copy(), {}};
+
+  visit_lqp(parameterized_lqp.lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Predicate) {
+      parameterize_predicate(node->node_expressions[0], parameterized_lqp);
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  if (parameterized_lqp.parameters.empty()) return std::nullopt;
+
+  return parameterized_lqp;
+}
+
+std::optional<ParameterizedLQP> parameterize_prepared_plan(const PreparedPlan& prepared_plan,
+                                                           const std::vector<AllTypeVariant>& values) {
+  Assert(values.size() == prepared_plan.parameter_ids.size(), "Prepared statement parameter count mismatch");
+
+  for (const auto& value : values) {
+    if (variant_is_null(value)) return std::nullopt;
+  }
+
+  auto parameterizable = true;
+  visit_lqp(prepared_plan.lqp, [&](const auto& node) {
+    for (const auto& expression : node->node_expressions) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        if (sub_expression->type == ExpressionType::LQPSubquery ||
+            (sub_expression->type == ExpressionType::Placeholder && node->type != LQPNodeType::Predicate &&
+             node->type != LQPNodeType::Projection)) {
+          parameterizable = false;
+        }
+        return parameterizable ? ExpressionVisitation::VisitArguments : ExpressionVisitation::DoNotVisitArguments;
+      });
+    }
+    return parameterizable ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+  });
+  if (!parameterizable) return std::nullopt;
+
+  // The placeholders already have ParameterIDs that are unique within the prepared plan, so we reuse them
+  auto parameterized_lqp = ParameterizedLQP{};
+  auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{values.size()};
+  for (auto value_idx = size_t{0}; value_idx < values.size(); ++value_idx) {
+    const auto parameter_id = prepared_plan.parameter_ids[value_idx];
+    const auto data_type = data_type_from_all_type_variant(values[value_idx]);
+    parameter_expressions[value_idx] = std::make_shared<CorrelatedParameterExpression>(
+        parameter_id, CorrelatedParameterExpression::ReferencedExpressionInfo{data_type, "?"});
+    parameterized_lqp.parameters.emplace(parameter_id, values[value_idx]);
+  }
+
+  parameterized_lqp.lqp = prepared_plan.instantiate(parameter_expressions);
+  return parameterized_lqp;
+}
+
+ParameterizedPlanCacheKey::ParameterizedPlanCacheKey(const std::shared_ptr<AbstractLQPNode>& init_lqp)
+    : lqp(init_lqp) {
+  visit_lqp(lqp, [&](const auto& node) {
+    boost::hash_combine(hash, static_cast<std::underlying_type_t<LQPNodeType>>(node->type));
+    boost::hash_combine(hash, node->description());
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+bool ParameterizedPlanCacheKey::operator==(const ParameterizedPlanCacheKey& rhs) const {
+  return hash == rhs.hash && *lqp == *rhs.lqp;
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "cache/cache.hpp"
+#include "cache/sharded_cache.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AbstractOperator;
+class PreparedPlan;
+
+/**
+ * An LQP in which literals (or the placeholders of a prepared statement) have been replaced by
+ * CorrelatedParameterExpressions, along with the values that were replaced. The LQP is optimized and translated only
+ * once. The resulting "generic" PQP is reused for all statements that only differ in these values by deep_copy()ing it
+ * and calling set_parameters(parameters) on the copy.
+ */
+struct ParameterizedLQP {
+  std::shared_ptr<AbstractLQPNode> lqp;
+  std::unordered_map<ParameterID, AllTypeVariant> parameters;
+};
+
+/**
+ * Replaces the non-NULL literals in the simple predicates (`<column> <condition> <literal>` and
+ * `<column> BETWEEN <literal> AND <literal>`, possibly combined with AND/OR) of the PredicateNodes in a copy of @param
+ * lqp by parameters. For these predicates, the TableScan uses the same implementations for parameters as for literals.
+ *
+ * Returns std::nullopt if there is nothing to parameterize or if the LQP cannot be parameterized. This is the case if
+ * it contains subqueries, placeholders, or parameters, and if it defines a view or a prepared statement, which need to
+ * keep their literals.
+ */
+std::optional<ParameterizedLQP> parameterize_lqp(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+/**
+ * Replaces the placeholders of a copy of @param prepared_plan by parameters with the data types of the given @param
+ * values. Different from PreparedPlan::instantiate(), the resulting LQP does not depend on the values.
+ *
+ * Returns std::nullopt if the prepared plan contains subqueries, if it uses placeholders in nodes other than
+ * PredicateNodes and ProjectionNodes, or if one of the values is NULL.
+ */
+std::optional<ParameterizedLQP> parameterize_prepared_plan(const PreparedPlan& prepared_plan,
+                                                           const std::vector<AllTypeVariant>& values);
+
+// Key of the SQLParameterizedPlanCache. LQPs are compared structurally; the hash is computed once from the node
+// descriptions.
+struct ParameterizedPlanCacheKey {
+  ParameterizedPlanCacheKey() = default;
+  explicit ParameterizedPlanCacheKey(const std::shared_ptr<AbstractLQPNode>& init_lqp);
+
+  bool operator==(const ParameterizedPlanCacheKey& rhs) const;
+
+  std::shared_ptr<AbstractLQPNode> lqp;
+  size_t hash{0};
+};
+
+// Maps parameterized, unoptimized LQPs to the PQPs created for them. The PQPs have no transaction context and their
+// parameters are not set, so they must be deep_copy()ed before being used.
+using SQLParameterizedPlanCache = Cache<std::shared_ptr<AbstractOperator>, ParameterizedPlanCacheKey, ShardedCache>;
+
+}  // namespace opossum
+
+namespace std {
+
+template <>
+struct hash<opossum::ParameterizedPlanCacheKey> {
+  size_t operator()(const opossum::ParameterizedPlanCacheKey& key) const { return key.hash; }
+};
+
+}  // namespace std
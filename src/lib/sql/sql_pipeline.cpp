@@ -8,6 +8,7 @@
 #include "SQLParser.h"
 #include "create_sql_parser_error_message.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/tracing/probes.hpp"
 
@@ -15,7 +16,8 @@ namespace opossum {
 
 SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context,
                          const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
-                         const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries)
+                         const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries,
+                         const ParameterizeLiterals parameterize_literals, const ExplainAnalyze explain_analyze)
     : _sql(sql), _transaction_context(transaction_context), _optimizer(optimizer) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context cannot have been committed already.");
@@ -73,9 +75,9 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
     const auto statement_string = boost::trim_copy(sql.substr(sql_string_offset, statement_string_length));
     sql_string_offset += statement_string_length;
 
-    auto pipeline_statement =
-        std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement), use_mvcc,
-                                               transaction_context, lqp_translator, optimizer, cleanup_temporaries);
+    auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
+        statement_string, std::move(parsed_statement), use_mvcc, transaction_context, lqp_translator, optimizer,
+        cleanup_temporaries, parameterize_literals, explain_analyze);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -240,6 +242,8 @@ std::string SQLPipelineMetrics::to_string() const {
   auto total_optimize_nanos = std::chrono::nanoseconds::zero();
   auto total_lqp_translate_nanos = std::chrono::nanoseconds::zero();
   auto total_execute_nanos = std::chrono::nanoseconds::zero();
+  auto total_admission_wait_nanos = std::chrono::nanoseconds::zero();
+  auto max_peak_memory_bytes = size_t{0};
   std::vector<bool> query_plan_cache_hits;
 
   for (const auto& statement_metric : statement_metrics) {
@@ -247,6 +251,8 @@ std::string SQLPipelineMetrics::to_string() const {
     total_optimize_nanos += statement_metric->optimization_duration;
     total_lqp_translate_nanos += statement_metric->lqp_translation_duration;
     total_execute_nanos += statement_metric->plan_execution_duration;
+    total_admission_wait_nanos += statement_metric->admission_wait_duration;
+    max_peak_memory_bytes = std::max(max_peak_memory_bytes, statement_metric->peak_memory_bytes);
 
     query_plan_cache_hits.push_back(statement_metric->query_plan_cache_hit);
   }
@@ -259,7 +265,9 @@ std::string SQLPipelineMetrics::to_string() const {
   info_string << "SQL TRANSLATE: " << format_duration(total_sql_translate_nanos) << ", ";
   info_string << "OPTIMIZE: " << format_duration(total_optimize_nanos) << ", ";
   info_string << "LQP TRANSLATE: " << format_duration(total_lqp_translate_nanos) << ", ";
+  info_string << "ADMISSION WAIT: " << format_duration(total_admission_wait_nanos) << ", ";
   info_string << "EXECUTE: " << format_duration(total_execute_nanos) << " (wall time) | ";
+  info_string << "PEAK MEMORY: " << format_bytes(max_peak_memory_bytes) << " | ";
   info_string << "QUERY PLAN CACHE HITS: " << num_cache_hits << "/" << query_plan_cache_hits.size() << " statement(s)";
   info_string << "]\n";
 
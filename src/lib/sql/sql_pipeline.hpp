@@ -35,7 +35,8 @@ class SQLPipeline : public Noncopyable {
   // Prefer using the SQLPipelineBuilder interface for constructing SQLPipelines conveniently
   SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context, const UseMvcc use_mvcc,
               const std::shared_ptr<LQPTranslator>& lqp_translator, const std::shared_ptr<Optimizer>& optimizer,
-              const CleanupTemporaries cleanup_temporaries);
+              const CleanupTemporaries cleanup_temporaries, const ParameterizeLiterals parameterize_literals,
+              const ExplainAnalyze explain_analyze);
 
   // Returns the original SQL string
   const std::string get_sql() const;
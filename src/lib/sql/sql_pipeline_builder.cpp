@@ -1,9 +1,18 @@
 #include "sql_pipeline_builder.hpp"
+#include "sql/explain_analyze.hpp"
 #include "utils/tracing/probes.hpp"
 
 namespace opossum {
 
-SQLPipelineBuilder::SQLPipelineBuilder(const std::string& sql) : _sql(sql) {}
+SQLPipelineBuilder::SQLPipelineBuilder(const std::string& sql) : _sql(sql) {
+  if (auto explained_sql = remove_explain_analyze_prefix(sql)) {
+    _sql = std::move(*explained_sql);
+    _explain_analyze = ExplainAnalyze::Yes;
+
+    // The sizes of the intermediate results are part of the explanation
+    _cleanup_temporaries = CleanupTemporaries::No;
+  }
+}
 
 SQLPipelineBuilder& SQLPipelineBuilder::with_mvcc(const UseMvcc use_mvcc) {
   _use_mvcc = use_mvcc;
@@ -35,11 +44,17 @@ SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_parameterized_literals() {
+  _parameterize_literals = ParameterizeLiterals::Yes;
+  return *this;
+}
+
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   DTRACE_PROBE1(HYRISE, CREATE_PIPELINE, reinterpret_cast<uintptr_t>(this));
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _cleanup_temporaries);
+  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _cleanup_temporaries,
+                              _parameterize_literals, _explain_analyze);
   DTRACE_PROBE3(HYRISE, PIPELINE_CREATION_DONE, pipeline.get_sql_per_statement().size(), _sql.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   return pipeline;
@@ -50,8 +65,8 @@ SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql,      std::move(parsed_sql), _use_mvcc, _transaction_context, lqp_translator,
-          optimizer, _cleanup_temporaries};
+  return {_sql,      std::move(parsed_sql), _use_mvcc,           _transaction_context, lqp_translator,
+          optimizer, _cleanup_temporaries,   _parameterize_literals, _explain_analyze};
 }
 
 }  // namespace opossum
@@ -28,6 +28,10 @@ class Optimizer;
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
  *  - No JIT operators
+ *  - Literals are not parameterized
+ *
+ * If the SQL string starts with "EXPLAIN ANALYZE", the statements are executed as usual, but their result tables
+ * describe the executed PQPs instead (see explain_analyze.hpp).
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -52,6 +56,14 @@ class SQLPipelineBuilder final {
    */
   SQLPipelineBuilder& dont_cleanup_temporaries();
 
+  /*
+   * Replace the literals of simple predicates by parameters, so that statements differing only in these literals share
+   * an optimized plan in the SQLParameterizedPlanCache. The plan is generic, i.e., it does not benefit from
+   * value-specific optimizations such as chunk pruning. Thus, this is meant for short-running (e.g., OLTP) statements,
+   * for which the optimization takes longer than the execution.
+   */
+  SQLPipelineBuilder& with_parameterized_literals();
+
   SQLPipeline create_pipeline() const;
 
   /**
@@ -61,13 +73,15 @@ class SQLPipelineBuilder final {
   SQLPipelineStatement create_pipeline_statement(std::shared_ptr<hsql::SQLParserResult> parsed_sql = nullptr) const;
 
  private:
-  const std::string _sql;
+  std::string _sql;
 
   UseMvcc _use_mvcc{UseMvcc::Yes};
   std::shared_ptr<TransactionContext> _transaction_context;
   std::shared_ptr<LQPTranslator> _lqp_translator;
   std::shared_ptr<Optimizer> _optimizer;
   CleanupTemporaries _cleanup_temporaries{true};
+  ParameterizeLiterals _parameterize_literals{false};
+  ExplainAnalyze _explain_analyze{false};
 };
 
 }  // namespace opossum
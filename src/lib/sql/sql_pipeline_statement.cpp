@@ -3,6 +3,8 @@
 #include <boost/algorithm/string.hpp>
 
 #include <iomanip>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include "SQLParser.h"
@@ -10,11 +12,17 @@
 #include "create_sql_parser_error_message.hpp"
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "memory/tracking_memory_resource.hpp"
 #include "optimizer/optimizer.hpp"
+#include "sql/explain_analyze.hpp"
+#include "scheduler/admission_controller.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sql/parameterized_plan_cache.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
+#include "statistics/table_statistics.hpp"
 #include "utils/assert.hpp"
 #include "utils/tracing/probes.hpp"
 
@@ -25,7 +33,9 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<TransactionContext>& transaction_context,
                                            const std::shared_ptr<LQPTranslator>& lqp_translator,
                                            const std::shared_ptr<Optimizer>& optimizer,
-                                           const CleanupTemporaries cleanup_temporaries)
+                                           const CleanupTemporaries cleanup_temporaries,
+                                           const ParameterizeLiterals parameterize_literals,
+                                           const ExplainAnalyze explain_analyze)
     : _sql_string(sql),
       _use_mvcc(use_mvcc),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
@@ -34,7 +44,9 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
       _optimizer(optimizer),
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()),
-      _cleanup_temporaries(cleanup_temporaries) {
+      _cleanup_temporaries(cleanup_temporaries),
+      _parameterize_literals(parameterize_literals),
+      _explain_analyze(explain_analyze) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one SQL statement");
   DebugAssert(!_sql_string.empty(), "An SQLPipelineStatement should always contain a SQL statement string for caching");
@@ -149,6 +161,34 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
     _physical_plan = (*cached_physical_plan)->deep_copy();
     _metrics->query_plan_cache_hit = true;
 
+  } else if (auto parameterized_lqp = _parameterize_literals == ParameterizeLiterals::Yes
+                                          ? parameterize_lqp(get_unoptimized_logical_plan())
+                                          : std::nullopt) {
+    // Statements that only differ in the literals of their predicates share a generic plan
+    const auto cache_key = ParameterizedPlanCacheKey{parameterized_lqp->lqp};
+    auto generic_plan = std::shared_ptr<AbstractOperator>{};
+
+    if (const auto cached_generic_plan = SQLParameterizedPlanCache::get().try_get(cache_key)) {
+      generic_plan = *cached_generic_plan;
+      _metrics->query_plan_cache_hit = true;
+
+      // Reset time to exclude previous pipeline steps
+      started = std::chrono::high_resolution_clock::now();
+    } else {
+      // The optimizer modifies the LQP it is given, but the cache key needs to stay intact
+      const auto optimization_started = std::chrono::high_resolution_clock::now();
+      const auto optimized_lqp = _optimizer->optimize(parameterized_lqp->lqp->deep_copy());
+      started = std::chrono::high_resolution_clock::now();
+      _metrics->optimization_duration =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(started - optimization_started);
+
+      generic_plan = _lqp_translator->translate_node(optimized_lqp);
+      SQLParameterizedPlanCache::get().set(cache_key, generic_plan);
+    }
+
+    _physical_plan = generic_plan->deep_copy();
+    _physical_plan->set_parameters(parameterized_lqp->parameters);
+
   } else {
     // "Normal" mode in which the query plan is created
     const auto& lqp = get_optimized_logical_plan();
@@ -162,8 +202,9 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
 
   if (_use_mvcc == UseMvcc::Yes) _physical_plan->set_transaction_context_recursively(_transaction_context);
 
-  // Cache newly created plan for the according sql statement (only if not already cached)
-  if (!_metrics->query_plan_cache_hit) {
+  // Cache newly created plan for the according sql statement (only if not already cached). Plans that are explained
+  // keep their intermediate results, so they are not cached.
+  if (!_metrics->query_plan_cache_hit && _explain_analyze == ExplainAnalyze::No) {
     SQLPhysicalPlanCache::get().set(_sql_string, _physical_plan);
   }
 
@@ -188,11 +229,58 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
 
   const auto& tasks = get_tasks();
 
-  const auto started = std::chrono::high_resolution_clock::now();
+  // The query is queued if its projected memory usage would make the admitted queries exceed the memory limit (see
+  // AdmissionController). Without a limit, the projection is not needed.
+  auto& admission_controller = AdmissionController::get();
+  _metrics->projected_memory_bytes = admission_controller.memory_limit() ? _estimate_memory_usage() : size_t{0};
+
+  const auto admission_started = std::chrono::high_resolution_clock::now();
+  auto started = admission_started;
+  auto admission = std::unique_ptr<AdmissionController::Admission>{};
+
+  // Each operator allocates its intermediates through its own memory resource, which forwards the allocations to the
+  // resource of the query. Thus, the memory consumption is tracked per operator and per query, and the budget granted
+  // by the admission applies to all operators.
+  const auto on_admission = [&]() {
+    started = std::chrono::high_resolution_clock::now();
+    _metrics->admission_wait_duration =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(started - admission_started);
+
+    _memory_resource = std::make_shared<TrackingMemoryResource>(admission->memory_budget());
+    auto operators_with_memory_resource = std::unordered_set<std::shared_ptr<AbstractOperator>>{};
+    const auto set_memory_resources = [&](const auto& self, const std::shared_ptr<AbstractOperator>& op) -> void {
+      if (!op || !operators_with_memory_resource.emplace(op).second) return;
+      op->set_memory_resource(std::make_shared<TrackingMemoryResource>(std::nullopt, _memory_resource.get()));
+      self(self, op->mutable_input_left());
+      self(self, op->mutable_input_right());
+    };
+    set_memory_resources(set_memory_resources, get_physical_plan());
+  };
 
   DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
                 reinterpret_cast<uintptr_t>(this));
-  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  if (CurrentScheduler::is_set()) {
+    // This might run on a worker, which must not be blocked while the query is queued, as the admitted queries might
+    // need it to finish. Instead, the tasks are scheduled right away but wait for a task that is only scheduled once
+    // the query has been admitted. Meanwhile, a waiting worker executes other tasks (see Worker::_wait_for_tasks()).
+    const auto admission_task = std::make_shared<JobTask>(on_admission);
+    for (const auto& task : tasks) {
+      if (task->predecessors().empty()) admission_task->set_as_predecessor_of(task);
+    }
+    CurrentScheduler::schedule_tasks(tasks);
+
+    admission_controller.admit_async(_metrics->projected_memory_bytes,
+                                     [&admission, admission_task](auto granted_admission) {
+                                       admission = std::move(granted_admission);
+                                       admission_task->schedule();
+                                     });
+    CurrentScheduler::wait_for_tasks(tasks);
+  } else {
+    // Without a scheduler, the query is executed by the calling thread anyway
+    admission = admission_controller.admit(_metrics->projected_memory_bytes);
+    on_admission();
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  }
 
   if (_auto_commit) {
     _transaction_context->commit();
@@ -200,10 +288,15 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
 
   const auto done = std::chrono::high_resolution_clock::now();
   _metrics->plan_execution_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+  _metrics->peak_memory_bytes = _memory_resource->peak_bytes();
 
   // Get output from the last task
   _result_table = tasks.back()->get_operator()->get_output();
-  if (!_result_table) _query_has_output = false;
+  if (_explain_analyze == ExplainAnalyze::Yes) {
+    _result_table = explain_analyze(get_physical_plan());
+  } else if (!_result_table) {
+    _query_has_output = false;
+  }
 
   DTRACE_PROBE8(HYRISE, SUMMARY, _sql_string.c_str(), _metrics->sql_translation_duration.count(),
                 _metrics->optimization_duration.count(), _metrics->lqp_translation_duration.count(),
@@ -217,4 +310,33 @@ const std::shared_ptr<TransactionContext>& SQLPipelineStatement::transaction_con
 }
 
 const std::shared_ptr<SQLPipelineStatementMetrics>& SQLPipelineStatement::metrics() const { return _metrics; }
+
+const std::shared_ptr<TrackingMemoryResource>& SQLPipelineStatement::memory_resource() const {
+  return _memory_resource;
+}
+
+size_t SQLPipelineStatement::_estimate_memory_usage() const {
+  // Each operator is assumed to hold one value (or RowID) per estimated output row and column. GetTables only
+  // reference the stored data, and operators without statistics (see lqp_has_statistics()) are not considered.
+  constexpr auto ESTIMATED_BYTES_PER_VALUE = 8.0f;
+
+  auto estimated_bytes = 0.0f;
+  auto has_statistics_by_node = std::unordered_map<std::shared_ptr<AbstractLQPNode>, bool>{};
+  auto visited_operators = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+  const auto visit_operator = [&](const auto& self, const std::shared_ptr<const AbstractOperator>& op) -> void {
+    if (!op || !visited_operators.emplace(op).second) return;
+
+    const auto& node = op->lqp_node;
+    if (node && node->type != LQPNodeType::StoredTable && lqp_has_statistics(node, has_statistics_by_node)) {
+      estimated_bytes += node->get_statistics()->row_count() * static_cast<float>(node->column_expressions().size()) *
+                         ESTIMATED_BYTES_PER_VALUE;
+    }
+
+    self(self, op->input_left());
+    self(self, op->input_right());
+  };
+  visit_operator(visit_operator, _physical_plan);
+
+  return static_cast<size_t>(estimated_bytes);
+}
 }  // namespace opossum
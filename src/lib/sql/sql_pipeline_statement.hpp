@@ -11,6 +11,8 @@
 
 namespace opossum {
 
+class TrackingMemoryResource;
+
 // Holds relevant information about the execution of an SQLPipelineStatement.
 struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds sql_translation_duration{};
@@ -18,7 +20,14 @@ struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds lqp_translation_duration{};
   std::chrono::nanoseconds plan_execution_duration{};
 
+  // Time spent waiting for the AdmissionController before the execution
+  std::chrono::nanoseconds admission_wait_duration{};
+
   bool query_plan_cache_hit = false;
+
+  // Memory usage as projected for the admission and peak memory allocated through the memory resource of the query
+  size_t projected_memory_bytes{0};
+  size_t peak_memory_bytes{0};
 };
 
 /**
@@ -33,6 +42,7 @@ struct SQLPipelineStatementMetrics {
  * NOTE:
  *  If a physical plan for an SQL statement is in the SQLPhysicalPlanCache, it will be used instead of translating the optimized
  *  LQP (get_optimized_logical_plans()) into a PQP. Thus, in this case, the optimized LQP and PQP could be different.
+ *  The same holds for plans from the SQLParameterizedPlanCache.
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
@@ -40,7 +50,8 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<TransactionContext>& transaction_context,
                        const std::shared_ptr<LQPTranslator>& lqp_translator,
-                       const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries);
+                       const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries,
+                       const ParameterizeLiterals parameterize_literals, const ExplainAnalyze explain_analyze);
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -56,13 +67,15 @@ class SQLPipelineStatement : public Noncopyable {
 
   // Returns the PQP for this statement.
   // The physical plan is either retrieved from the SQLPhysicalPlanCache or, if unavailable, translated from the
-  // optimized LQP.
+  // optimized LQP. If literals are parameterized, the plan for the parameterized LQP is retrieved from (or added to)
+  // the SQLParameterizedPlanCache before falling back to the optimized LQP.
   const std::shared_ptr<AbstractOperator>& get_physical_plan();
 
   // Returns all tasks that need to be executed for this query.
   const std::vector<std::shared_ptr<OperatorTask>>& get_tasks();
 
-  // Executes all tasks, waits for them to finish, and returns the resulting table.
+  // Executes all tasks, waits for them to finish, and returns the resulting table. For EXPLAIN ANALYZE, this is the
+  // table describing the executed PQP.
   const std::shared_ptr<const Table>& get_result_table();
 
   // Returns the TransactionContext that was either passed to or created by the SQLPipelineStatement.
@@ -71,7 +84,15 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<SQLPipelineStatementMetrics>& metrics() const;
 
+  // Returns the memory resource that tracks the memory allocated by the operators of this statement (see
+  // TrackingMemoryResource). Each operator has its own resource nested below this one. Set by get_result_table().
+  const std::shared_ptr<TrackingMemoryResource>& memory_resource() const;
+
  private:
+  // Projects the memory usage of the physical plan based on the estimated output sizes of its operators
+  size_t _estimate_memory_usage() const;
+
+
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
 
@@ -96,8 +117,16 @@ class SQLPipelineStatement : public Noncopyable {
 
   std::shared_ptr<SQLPipelineStatementMetrics> _metrics;
 
+  std::shared_ptr<TrackingMemoryResource> _memory_resource;
+
   // Delete temporary tables
   const CleanupTemporaries _cleanup_temporaries;
+
+  // Look up (or create) a generic plan for the parameterized LQP in the SQLParameterizedPlanCache
+  const ParameterizeLiterals _parameterize_literals;
+
+  // Return the executed PQP instead of the result (see explain_analyze.hpp)
+  const ExplainAnalyze _explain_analyze;
 };
 
 }  // namespace opossum
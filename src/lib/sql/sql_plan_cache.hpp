@@ -4,13 +4,15 @@
 #include <string>
 
 #include "cache/cache.hpp"
+#include "cache/sharded_cache.hpp"
 
 namespace opossum {
 
 class AbstractOperator;
 class AbstractLQPNode;
 
-using SQLPhysicalPlanCache = Cache<std::shared_ptr<AbstractOperator>, std::string>;
-using SQLLogicalPlanCache = Cache<std::shared_ptr<AbstractLQPNode>, std::string>;
+// The plan caches are accessed by all concurrently running queries, so they use the ShardedCache per default
+using SQLPhysicalPlanCache = Cache<std::shared_ptr<AbstractOperator>, std::string, ShardedCache>;
+using SQLLogicalPlanCache = Cache<std::shared_ptr<AbstractLQPNode>, std::string, ShardedCache>;
 
 }  // namespace opossum
@@ -42,6 +42,7 @@
 #include "logical_query_plan/insert_node.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/meta_table_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/projection_node.hpp"
 #include "logical_query_plan/show_columns_node.hpp"
@@ -54,6 +55,7 @@
 #include "storage/lqp_view.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "utils/meta_table_manager.hpp"
 
 #include "SQLParser.h"
 
@@ -457,6 +459,9 @@ SQLTranslator::TableSourceState SQLTranslator::_translate_table_origin(const hsq
       if (StorageManager::get().has_table(hsql_table_ref.name)) {
         lqp = _translate_stored_table(hsql_table_ref.name, sql_identifier_resolver);
 
+      } else if (MetaTableManager::get().has_table(hsql_table_ref.name)) {
+        lqp = _translate_meta_table(hsql_table_ref.name, sql_identifier_resolver);
+
       } else if (StorageManager::get().has_view(hsql_table_ref.name)) {
         const auto view = StorageManager::get().get_view(hsql_table_ref.name);
         lqp = view->lqp;
@@ -552,6 +557,22 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_stored_table(
   return validated_stored_table_node;
 }
 
+std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_meta_table(
+    const std::string& name, const std::shared_ptr<SQLIdentifierResolver>& sql_identifier_resolver) {
+  // Meta tables are generated for each query and contain no invalidated rows, so they are not validated
+  const auto meta_table_node = MetaTableNode::make(name);
+
+  const auto& column_definitions = MetaTableManager::get().column_definitions(name);
+  for (auto column_id = ColumnID{0}; column_id < column_definitions.size(); ++column_id) {
+    const auto column_reference = LQPColumnReference{meta_table_node, column_id};
+    const auto column_expression = std::make_shared<LQPColumnExpression>(column_reference);
+    sql_identifier_resolver->set_column_name(column_expression, column_definitions[column_id].name);
+    sql_identifier_resolver->set_table_name(column_expression, name);
+  }
+
+  return meta_table_node;
+}
+
 SQLTranslator::TableSourceState SQLTranslator::_translate_predicated_join(const hsql::JoinDefinition& join) {
   const auto join_mode = translate_join_mode(join.type);
 
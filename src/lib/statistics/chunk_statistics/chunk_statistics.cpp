@@ -1,5 +1,9 @@
 #include "chunk_statistics.hpp"
 
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -12,4 +16,40 @@ bool ChunkStatistics::can_prune(const ColumnID column_id, const PredicateConditi
   return _statistics[column_id]->can_prune(predicate_condition, variant_value, variant_value2);
 }
 
+bool chunk_can_be_pruned(const Chunk& chunk, const ColumnID column_id, const PredicateCondition predicate_condition,
+                         const AllTypeVariant& variant_value, const std::optional<AllTypeVariant>& variant_value2) {
+  const auto segment = chunk.get_segment(column_id);
+
+  // The filters cast the values to the type of the column, which might change the result of a comparison (e.g.,
+  // `a < 3.5` on an int column). Thus, only values of the column's type are used for pruning.
+  for (const auto& value : {std::optional<AllTypeVariant>{variant_value}, variant_value2}) {
+    if (value && !variant_is_null(*value) && data_type_from_all_type_variant(*value) != segment->data_type()) {
+      return false;
+    }
+  }
+
+  auto statistics = chunk.statistics();
+  auto statistics_column_id = column_id;
+
+  if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+    // Rows of outer joins that reference NULL_ROW_ID are NULL, but not covered by the statistics of the referenced
+    // chunk
+    if (predicate_condition == PredicateCondition::IsNull) return false;
+
+    const auto& pos_list = *reference_segment->pos_list();
+    if (pos_list.empty() || !pos_list.references_single_chunk()) return false;
+
+    const auto referenced_chunk_id = pos_list.common_chunk_id();
+    if (referenced_chunk_id == INVALID_CHUNK_ID) return false;
+
+    const auto referenced_chunk = reference_segment->referenced_table()->get_chunk(referenced_chunk_id);
+    if (!referenced_chunk) return false;
+
+    statistics = referenced_chunk->statistics();
+    statistics_column_id = reference_segment->referenced_column_id();
+  }
+
+  return statistics && statistics->can_prune(statistics_column_id, predicate_condition, variant_value, variant_value2);
+}
+
 }  // namespace opossum
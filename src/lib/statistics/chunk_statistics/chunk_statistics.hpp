@@ -10,6 +10,8 @@
 
 namespace opossum {
 
+class Chunk;
+
 /**
  * Container class that holds objects with statistical information about a chunk.
  */
@@ -29,4 +31,15 @@ class ChunkStatistics final : public std::enable_shared_from_this<ChunkStatistic
  protected:
   std::vector<std::shared_ptr<SegmentStatistics>> _statistics;
 };
+
+/**
+ * Returns true if the statistics show that no row of @param chunk satisfies `<column_id> <predicate_condition> <value>`
+ * (or BETWEEN value AND value2). For chunks of ReferenceSegments, the statistics of the referenced chunk are used if
+ * the segment references a single chunk. Used by operators that prune chunks at execution time, i.e., once the values
+ * of parameters or the keys of a join are known.
+ */
+bool chunk_can_be_pruned(const Chunk& chunk, const ColumnID column_id, const PredicateCondition predicate_condition,
+                         const AllTypeVariant& variant_value,
+                         const std::optional<AllTypeVariant>& variant_value2 = std::nullopt);
+
 }  // namespace opossum
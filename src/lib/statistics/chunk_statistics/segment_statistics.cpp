@@ -10,6 +10,7 @@
 #include "abstract_filter.hpp"
 #include "min_max_filter.hpp"
 #include "range_filter.hpp"
+#include "zone_map_filter.hpp"
 #include "storage/base_encoded_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
@@ -72,8 +73,28 @@ std::shared_ptr<SegmentStatistics> SegmentStatistics::build_statistics(
   return statistics;
 }
 
+std::shared_ptr<SegmentStatistics> SegmentStatistics::build_zone_map(DataType data_type) {
+  auto statistics = std::make_shared<SegmentStatistics>();
+  resolve_data_type(data_type, [&](auto type) {
+    using DataTypeT = typename decltype(type)::type;
+    statistics->add_filter(std::make_shared<ZoneMapFilter<DataTypeT>>());
+  });
+  return statistics;
+}
+
 void SegmentStatistics::add_filter(std::shared_ptr<AbstractFilter> filter) { _filters.emplace_back(filter); }
 
+bool SegmentStatistics::widen_zone_maps(const BaseSegment& segment, const ChunkOffset begin_offset,
+                                        const ChunkOffset end_offset) {
+  auto widened = false;
+  for (const auto& filter : _filters) {
+    if (const auto zone_map = std::dynamic_pointer_cast<BaseZoneMapFilter>(filter)) {
+      widened |= zone_map->widen(segment, begin_offset, end_offset);
+    }
+  }
+  return widened;
+}
+
 bool SegmentStatistics::can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
                                   const std::optional<AllTypeVariant>& variant_value2) const {
   for (const auto& filter : _filters) {
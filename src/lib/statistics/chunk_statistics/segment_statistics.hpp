@@ -21,8 +21,20 @@ class SegmentStatistics final {
   static std::shared_ptr<SegmentStatistics> build_statistics(DataType data_type,
                                                              const std::shared_ptr<const BaseSegment>& segment);
 
+  /**
+   * Creates statistics for a mutable segment that only hold an empty zone map (see ZoneMapFilter). The zone map is
+   * widened by widen_zone_maps() whenever rows are appended to the segment.
+   */
+  static std::shared_ptr<SegmentStatistics> build_zone_map(DataType data_type);
+
   void add_filter(std::shared_ptr<AbstractFilter> filter);
 
+  /**
+   * Widens all zone maps in this object by the values at the offsets [begin_offset, end_offset) of the segment.
+   * Returns true if any of them changed.
+   */
+  bool widen_zone_maps(const BaseSegment& segment, ChunkOffset begin_offset, ChunkOffset end_offset);
+
   /**
    * calls can_prune on each filter in this object
   */
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <mutex>
+#include <optional>
+
+#include "abstract_filter.hpp"
+#include "all_type_variant.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Base class of ZoneMapFilter, which allows widening the zone map without knowing the data type of the segment.
+ */
+class BaseZoneMapFilter : public AbstractFilter {
+ public:
+  /**
+   * Widens the zone map so that it covers the values at the offsets [begin_offset, end_offset) of the segment, which
+   * has to be a ValueSegment. Returns true if the zone map changed.
+   */
+  virtual bool widen(const BaseSegment& segment, ChunkOffset begin_offset, ChunkOffset end_offset) = 0;
+};
+
+/**
+ * Filter that stores the minimum, the maximum, and the number of NULLs of a mutable segment. In contrast to the
+ * MinMaxFilter, which is built once a chunk is immutable, the zone map starts out empty and is widened whenever rows
+ * are appended to the segment (see Chunk::widen_zone_maps). It is never narrowed: Deleted or rolled back rows remain
+ * covered by the zone map, so that it always describes a superset of the visible values. Thus, it is safe to prune
+ * with it.
+ *
+ * As Inserts widen the zone map while the optimizer might use it for pruning, it is guarded by a mutex.
+ */
+template <typename T>
+class ZoneMapFilter : public BaseZoneMapFilter {
+ public:
+  bool widen(const BaseSegment& segment, const ChunkOffset begin_offset, const ChunkOffset end_offset) override {
+    const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment);
+    Assert(value_segment, "Zone maps can only be widened by ValueSegments");
+
+    const auto& values = value_segment->values();
+    auto min = std::optional<T>{};
+    auto max = std::optional<T>{};
+    auto null_count = uint64_t{0};
+
+    // Compute the bounds of the new values without holding the lock
+    for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+      if (value_segment->is_nullable() && value_segment->null_values()[chunk_offset]) {
+        ++null_count;
+        continue;
+      }
+
+      const auto& value = values[chunk_offset];
+      if (!min || value < *min) min = value;
+      if (!max || value > *max) max = value;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto widened = null_count > 0;
+    _null_count += null_count;
+
+    if (min && (!_min || *min < *_min)) {
+      _min = min;
+      widened = true;
+    }
+    if (max && (!_max || *max > *_max)) {
+      _max = max;
+      widened = true;
+    }
+
+    return widened;
+  }
+
+  bool can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
+                 const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // _min and _max are either both set or both unset
+    const auto has_non_null_values = static_cast<bool>(_min);
+
+    if (predicate_type == PredicateCondition::IsNull) return _null_count == 0;
+    if (predicate_type == PredicateCondition::IsNotNull) return !has_non_null_values;
+
+    // Early exit for NULL variants.
+    if (variant_is_null(variant_value)) {
+      return false;
+    }
+
+    // A segment without non-NULL values does not match any comparison
+    if (!has_non_null_values) {
+      switch (predicate_type) {
+        case PredicateCondition::GreaterThan:
+        case PredicateCondition::GreaterThanEquals:
+        case PredicateCondition::LessThan:
+        case PredicateCondition::LessThanEquals:
+        case PredicateCondition::Equals:
+        case PredicateCondition::NotEquals:
+        case PredicateCondition::Between:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+    const auto value = type_cast_variant<T>(variant_value);
+
+    // See MinMaxFilter::can_prune
+    switch (predicate_type) {
+      case PredicateCondition::GreaterThan:
+        return value >= *_max;
+      case PredicateCondition::GreaterThanEquals:
+        return value > *_max;
+      case PredicateCondition::LessThan:
+        return value <= *_min;
+      case PredicateCondition::LessThanEquals:
+        return value < *_min;
+      case PredicateCondition::Equals:
+        return value < *_min || value > *_max;
+      case PredicateCondition::NotEquals:
+        return value == *_min && value == *_max;
+      case PredicateCondition::Between: {
+        Assert(static_cast<bool>(variant_value2), "Between operator needs two values.");
+        const auto value2 = type_cast_variant<T>(*variant_value2);
+        return value > *_max || value2 < *_min;
+      }
+      default:
+        return false;
+    }
+  }
+
+  std::optional<T> min() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _min;
+  }
+
+  std::optional<T> max() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _max;
+  }
+
+  uint64_t null_count() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _null_count;
+  }
+
+ protected:
+  mutable std::mutex _mutex;
+  std::optional<T> _min;
+  std::optional<T> _max;
+  uint64_t _null_count{0};
+};
+
+}  // namespace opossum
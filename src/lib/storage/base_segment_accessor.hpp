@@ -26,6 +26,15 @@ template <typename T>
 class AbstractSegmentAccessor : public BaseSegmentAccessor {
  public:
   virtual const std::optional<T> access(ChunkOffset offset) const = 0;
+
+  /**
+   * Retrieves the values at @param count chunk offsets at once. The values are written to @param values and whether
+   * they are NULL to @param null_values, both of which need room for @param count entries. The values at NULL
+   * positions are unspecified.
+   * Compared to calling access() for each offset, this saves a virtual call and the construction of a std::optional
+   * per value, and the accessors can decode their segment in a tight loop. Prefer it wherever multiple values are read.
+   */
+  virtual void access(const ChunkOffset* chunk_offsets, const size_t count, T* values, bool* null_values) const = 0;
 };
 
 }  // namespace opossum
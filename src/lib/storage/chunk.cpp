@@ -19,7 +19,7 @@ namespace opossum {
 
 Chunk::Chunk(const Segments& segments, const std::shared_ptr<MvccData>& mvcc_data,
              const std::optional<PolymorphicAllocator<Chunk>>& alloc)
-    : _segments(segments), _mvcc_data(mvcc_data) {
+    : _segments(segments), _mvcc_data(mvcc_data), _access_counters(segments.size()) {
 #if HYRISE_DEBUG
   const auto chunk_size = segments.empty() ? 0u : segments[0]->size();
   Assert(!_mvcc_data || _mvcc_data->size() == chunk_size, "Invalid MvccData size");
@@ -35,6 +35,8 @@ bool Chunk::is_mutable() const { return _is_mutable; }
 
 void Chunk::mark_immutable() { _is_mutable = false; }
 
+bool Chunk::try_begin_finalization() { return !_finalization_begun.exchange(true); }
+
 void Chunk::replace_segment(size_t column_id, const std::shared_ptr<BaseSegment>& segment) {
   std::atomic_store(&_segments.at(column_id), segment);
 }
@@ -57,6 +59,9 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
     DebugAssert(base_value_segment, "Can't append to segment that is not a ValueSegment");
     base_value_segment->append(*value_it);
   }
+
+  const auto chunk_offset = static_cast<ChunkOffset>(size() - 1);
+  widen_zone_maps(chunk_offset, chunk_offset + 1);
 }
 
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
@@ -113,6 +118,14 @@ std::shared_ptr<BaseIndex> Chunk::get_index(const SegmentIndexType index_type,
   return get_index(index_type, segments);
 }
 
+bool Chunk::is_indexed(const ColumnID column_id) const {
+  const auto segment = get_segment(column_id);
+  return std::any_of(_indices.cbegin(), _indices.cend(), [&](const auto& index) {
+    const auto indexed_segments = index->get_indexed_segments();
+    return std::find(indexed_segments.cbegin(), indexed_segments.cend(), segment) != indexed_segments.cend();
+  });
+}
+
 void Chunk::remove_index(const std::shared_ptr<BaseIndex>& index) {
   auto it = std::find(_indices.cbegin(), _indices.cend(), index);
   DebugAssert(it != _indices.cend(), "Trying to remove a non-existing index");
@@ -190,14 +203,42 @@ std::vector<std::shared_ptr<const BaseSegment>> Chunk::_get_segments_for_ids(
   return segments;
 }
 
-std::shared_ptr<ChunkStatistics> Chunk::statistics() const { return _statistics; }
+std::shared_ptr<ChunkStatistics> Chunk::statistics() const { return std::atomic_load(&_statistics); }
 
 void Chunk::set_statistics(const std::shared_ptr<ChunkStatistics>& chunk_statistics) {
   Assert(!is_mutable(), "Cannot set statistics on mutable chunks.");
   DebugAssert(chunk_statistics->statistics().size() == column_count(),
               "ChunkStatistics must have same number of segments as Chunk");
-  _statistics = chunk_statistics;
+  std::atomic_store(&_statistics, chunk_statistics);
+}
+
+void Chunk::create_zone_maps() {
+  Assert(is_mutable() && size() == 0, "Zone maps can only be created for empty, mutable chunks.");
+
+  auto segment_statistics = std::vector<std::shared_ptr<SegmentStatistics>>{};
+  segment_statistics.reserve(column_count());
+  for (const auto& segment : _segments) {
+    segment_statistics.emplace_back(SegmentStatistics::build_zone_map(segment->data_type()));
+  }
+  std::atomic_store(&_statistics, std::make_shared<ChunkStatistics>(segment_statistics));
 }
+
+void Chunk::widen_zone_maps(const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+  const auto chunk_statistics = statistics();
+  if (!chunk_statistics || !is_mutable()) return;
+
+  auto widened = false;
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    widened |= chunk_statistics->statistics()[column_id]->widen_zone_maps(*get_segment(column_id), begin_offset,
+                                                                          end_offset);
+  }
+
+  // Signal plans that pruned this chunk based on the previous zone maps that they need to re-check it
+  if (widened) ++_statistics_version;
+}
+
+uint64_t Chunk::statistics_version() const { return _statistics_version.load(); }
+
 void Chunk::increase_invalid_row_count(const uint64_t count) const { _invalid_row_count += count; }
 
 void Chunk::set_cleanup_commit_id(const CommitID cleanup_commit_id) {
@@ -205,8 +246,16 @@ void Chunk::set_cleanup_commit_id(const CommitID cleanup_commit_id) {
   _cleanup_commit_id = cleanup_commit_id;
 }
 
-const std::optional<std::pair<ColumnID, OrderByMode>>& Chunk::ordered_by() const { return _ordered_by; }
+std::optional<std::pair<ColumnID, OrderByMode>> Chunk::ordered_by() const {
+  const auto ordered_by = std::atomic_load(&_ordered_by);
+  if (!ordered_by) return std::nullopt;
+  return *ordered_by;
+}
+
+void Chunk::set_ordered_by(const std::pair<ColumnID, OrderByMode>& ordered_by) {
+  std::atomic_store(&_ordered_by, std::make_shared<const std::pair<ColumnID, OrderByMode>>(ordered_by));
+}
 
-void Chunk::set_ordered_by(const std::pair<ColumnID, OrderByMode>& ordered_by) { _ordered_by.emplace(ordered_by); }
+SegmentAccessCounter& Chunk::access_counter(ColumnID column_id) const { return _access_counters.at(column_id); }
 
 }  // namespace opossum
@@ -16,6 +16,7 @@
 #include "all_type_variant.hpp"
 #include "index/segment_index_type.hpp"
 #include "mvcc_data.hpp"
+#include "segment_access_counter.hpp"
 #include "table_column_definition.hpp"
 #include "types.hpp"
 #include "utils/copyable_atomic.hpp"
@@ -54,6 +55,13 @@ class Chunk : private Noncopyable {
 
   void mark_immutable();
 
+  /**
+   * Full chunks are finalized (i.e., marked immutable, encoded, and indexed) by whoever completes the last pending
+   * insert into them, see Insert. As multiple transactions might complete their inserts concurrently, this returns true
+   * only for the first caller, which is then responsible for the finalization.
+   */
+  bool try_begin_finalization();
+
   // Atomically replaces the current segment at column_id with the passed segment
   void replace_segment(size_t column_id, const std::shared_ptr<BaseSegment>& segment);
 
@@ -106,6 +114,9 @@ class Chunk : private Noncopyable {
   std::shared_ptr<BaseIndex> get_index(const SegmentIndexType index_type,
                                        const std::vector<ColumnID>& column_ids) const;
 
+  // Returns true if the segment of the given column is covered by any of the chunk's indexes
+  bool is_indexed(const ColumnID column_id) const;
+
   template <typename Index>
   std::shared_ptr<BaseIndex> create_index(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index) {
     DebugAssert(([&]() {
@@ -140,6 +151,21 @@ class Chunk : private Noncopyable {
 
   void set_statistics(const std::shared_ptr<ChunkStatistics>& chunk_statistics);
 
+  /**
+   * Immutable chunks obtain their statistics when they are encoded. To make mutable chunks prunable as well, the
+   * statistics of an empty, mutable chunk can be initialized with zone maps (see ZoneMapFilter) instead. Whoever
+   * appends rows to the chunk then has to widen the zone maps by the appended rows (Chunk::append does so itself).
+   * Once the chunk is encoded, the zone maps are replaced by the regular statistics.
+   */
+  void create_zone_maps();
+  void widen_zone_maps(ChunkOffset begin_offset, ChunkOffset end_offset);
+
+  /**
+   * Incremented whenever the zone maps are widened. A plan that pruned a mutable chunk remembers the version it saw
+   * and must not rely on the pruning anymore once the version has changed, see GetTable.
+   */
+  uint64_t statistics_version() const;
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this chunk and its segments
    */
@@ -148,9 +174,10 @@ class Chunk : private Noncopyable {
   /**
    * If a chunk is sorted in any way, the order (Ascending/Descending/AscendingNullsFirst/AscendingNullsLast) and
    * the ColumnID of the segment by which it is sorted will be returned.
-   * This is currently only taken advantage of in the ColumnVsValueScan. See #1519 for more details.
+   * For reference chunks, it describes the order of the referenced values in the order of the PosList.
+   * As the ChunkFinalizationTask sets it on chunks that are concurrently read, it is accessed atomically.
    */
-  const std::optional<std::pair<ColumnID, OrderByMode>>& ordered_by() const;
+  std::optional<std::pair<ColumnID, OrderByMode>> ordered_by() const;
   void set_ordered_by(const std::pair<ColumnID, OrderByMode>& ordered_by);
 
   /**
@@ -175,6 +202,12 @@ class Chunk : private Noncopyable {
 
   void set_cleanup_commit_id(CommitID cleanup_commit_id);
 
+  /**
+   * Returns the access counter of the segments at column_id, see SegmentAccessCounter. Like
+   * increase_invalid_row_count(), this is const so that operators can record accesses to their input chunks.
+   */
+  SegmentAccessCounter& access_counter(ColumnID column_id) const;
+
  private:
   std::vector<std::shared_ptr<const BaseSegment>> _get_segments_for_ids(const std::vector<ColumnID>& column_ids) const;
 
@@ -184,10 +217,13 @@ class Chunk : private Noncopyable {
   std::shared_ptr<MvccData> _mvcc_data;
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
   std::shared_ptr<ChunkStatistics> _statistics;
+  std::atomic_uint64_t _statistics_version{0};
   bool _is_mutable = true;
-  std::optional<std::pair<ColumnID, OrderByMode>> _ordered_by;
+  std::atomic_bool _finalization_begun{false};
+  std::shared_ptr<const std::pair<ColumnID, OrderByMode>> _ordered_by;
   mutable std::atomic_uint64_t _invalid_row_count = 0;
   std::optional<CommitID> _cleanup_commit_id;
+  mutable std::vector<SegmentAccessCounter> _access_counters;
 };
 
 }  // namespace opossum
@@ -5,6 +5,7 @@
 
 #include "base_value_segment.hpp"
 #include "chunk.hpp"
+#include "resolve_type.hpp"
 #include "table.hpp"
 #include "types.hpp"
 
@@ -12,12 +13,58 @@
 #include "statistics/chunk_statistics/segment_statistics.hpp"
 #include "storage/base_encoded_segment.hpp"
 #include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns true if the segment already has the requested encoding and thus does not need to be re-encoded
+bool segment_matches_spec(const BaseEncodedSegment& segment, const SegmentEncodingSpec& spec) {
+  if (segment.encoding_type() != spec.encoding_type) return false;
+  if (!spec.vector_compression_type || !segment.compressed_vector_type()) return true;
+
+  const auto is_simd_bp128 = *segment.compressed_vector_type() == CompressedVectorType::SimdBp128;
+  return is_simd_bp128 == (*spec.vector_compression_type == VectorCompressionType::SimdBp128);
+}
+
+// Decodes an encoded segment into a ValueSegment, from which it can be re-encoded
+std::shared_ptr<BaseValueSegment> decode_segment(const DataType data_type, const BaseSegment& segment) {
+  auto value_segment = std::shared_ptr<BaseValueSegment>{};
+
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto values = std::vector<ColumnDataType>{};
+    auto null_values = std::vector<bool>{};
+    values.reserve(segment.size());
+    null_values.reserve(segment.size());
+    auto has_null_values = false;
+
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      values.emplace_back(position.value());
+      null_values.emplace_back(position.is_null());
+      has_null_values |= position.is_null();
+    });
+
+    if (has_null_values) {
+      value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+    } else {
+      value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+    }
+  });
+
+  return value_segment;
+}
+
+}  // namespace
+
 namespace opossum {
 
 void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
-                                const ChunkEncodingSpec& chunk_encoding_spec) {
+                                const ChunkEncodingSpec& chunk_encoding_spec, const ShrinkMvccData shrink_mvcc_data) {
   Assert((column_data_types.size() == chunk->column_count()),
          "Number of column types must match the chunk’s column count.");
   Assert((chunk_encoding_spec.size() == chunk->column_count()),
@@ -29,9 +76,30 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
 
     const auto data_type = column_data_types[column_id];
     const auto base_segment = chunk->get_segment(column_id);
-    const auto value_segment = std::dynamic_pointer_cast<const BaseValueSegment>(base_segment);
 
-    Assert(value_segment, "All segments of the chunk need to be of type ValueSegment<T>");
+    // Indexes reference the segments they were built on (and mostly require dictionary segments). Replacing an indexed
+    // segment would make its indexes unfindable, so it is kept as it is.
+    if (chunk->is_indexed(column_id)) {
+      column_statistics.push_back(SegmentStatistics::build_statistics(data_type, base_segment));
+      continue;
+    }
+
+    auto value_segment = std::dynamic_pointer_cast<const BaseValueSegment>(base_segment);
+
+    if (!value_segment) {
+      // Re-encoding: Keep the segment if it is already encoded as requested, otherwise decode it first
+      const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(base_segment);
+      Assert(encoded_segment, "All segments of the chunk need to be of type ValueSegment<T> or encoded segments");
+
+      if (segment_matches_spec(*encoded_segment, spec)) {
+        column_statistics.push_back(SegmentStatistics::build_statistics(data_type, encoded_segment));
+        continue;
+      }
+
+      const auto decoded_segment = decode_segment(data_type, *encoded_segment);
+      if (spec.encoding_type == EncodingType::Unencoded) chunk->replace_segment(column_id, decoded_segment);
+      value_segment = decoded_segment;
+    }
 
     if (spec.encoding_type == EncodingType::Unencoded) {
       // No need to encode, but we still want to have statistics for the now immutable value segment
@@ -46,15 +114,16 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
   chunk->mark_immutable();
   chunk->set_statistics(std::make_shared<ChunkStatistics>(column_statistics));
 
-  if (chunk->has_mvcc_data()) {
+  if (chunk->has_mvcc_data() && shrink_mvcc_data == ShrinkMvccData::Yes) {
     chunk->get_scoped_mvcc_data_lock()->shrink();
   }
 }
 
 void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
-                                const SegmentEncodingSpec& segment_encoding_spec) {
+                                const SegmentEncodingSpec& segment_encoding_spec,
+                                const ShrinkMvccData shrink_mvcc_data) {
   const auto chunk_encoding_spec = ChunkEncodingSpec{chunk->column_count(), segment_encoding_spec};
-  encode_chunk(chunk, column_data_types, chunk_encoding_spec);
+  encode_chunk(chunk, column_data_types, chunk_encoding_spec, shrink_mvcc_data);
 }
 
 void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
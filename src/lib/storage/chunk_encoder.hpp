@@ -29,6 +29,8 @@ struct SegmentEncodingSpec {
 
 using ChunkEncodingSpec = std::vector<SegmentEncodingSpec>;
 
+enum class ShrinkMvccData : bool { Yes = true, No = false };
+
 /**
  * @brief Interface for encoding chunks
  *
@@ -41,22 +43,27 @@ class ChunkEncoder {
    * @brief Encodes a chunk
    *
    * Encodes a chunk using the passed encoding specifications.
-   * Reduces also the fragmentation of the chunk’s MVCC data.
-   * All segments of the chunk need to be of type ValueSegment<T>,
-   * i.e., recompression is not yet supported.
+   * Reduces also the fragmentation of the chunk’s MVCC data, unless ShrinkMvccData::No is passed. Shrinking
+   * reallocates the MVCC vectors and thus must not happen while other threads might access them (e.g., when chunks are
+   * finalized in the background, see ChunkFinalizationTask).
+   * Segments that are already encoded are decoded and re-encoded,
+   * unless they already have the requested encoding. Segments that are
+   * covered by an index are kept as they are, so that the index stays valid.
    *
    * Note: In some cases, it might be beneficial to
    *       leave certain segments of a chunk unencoded.
    *       Use EncodingType::Unencoded in this case.
    */
   static void encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
-                           const ChunkEncodingSpec& chunk_encoding_spec);
+                           const ChunkEncodingSpec& chunk_encoding_spec,
+                           ShrinkMvccData shrink_mvcc_data = ShrinkMvccData::Yes);
 
   /**
    * @brief Encodes a chunk using the same segment-encoding spec
    */
   static void encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
-                           const SegmentEncodingSpec& segment_encoding_spec = {});
+                           const SegmentEncodingSpec& segment_encoding_spec = {},
+                           ShrinkMvccData shrink_mvcc_data = ShrinkMvccData::Yes);
 
   /**
    * @brief Encodes the specified chunks of the passed table
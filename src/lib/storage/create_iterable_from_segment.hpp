@@ -1,5 +1,7 @@
 #pragma once
 
+#include "storage/decimal_scaled/decimal_scaled_iterable.hpp"
+#include "storage/delta/delta_iterable.hpp"
 #include "storage/dictionary_segment/dictionary_segment_iterable.hpp"
 #include "storage/frame_of_reference/frame_of_reference_iterable.hpp"
 #include "storage/lz4/lz4_iterable.hpp"
@@ -73,6 +75,24 @@ auto create_iterable_from_segment(const FrameOfReferenceSegment<T>& segment) {
   }
 }
 
+template <typename T, bool EraseSegmentType = HYRISE_DEBUG>
+auto create_iterable_from_segment(const DeltaSegment<T>& segment) {
+  if constexpr (EraseSegmentType) {
+    return create_any_segment_iterable<T>(segment);
+  } else {
+    return DeltaIterable<T>{segment};
+  }
+}
+
+template <typename T, bool EraseSegmentType = HYRISE_DEBUG>
+auto create_iterable_from_segment(const DecimalScaledSegment<T>& segment) {
+  if constexpr (EraseSegmentType) {
+    return create_any_segment_iterable<T>(segment);
+  } else {
+    return DecimalScaledIterable<T>{segment};
+  }
+}
+
 template <typename T, bool EraseSegmentType = true>
 auto create_iterable_from_segment(const LZ4Segment<T>& segment) {
   // LZ4Segment always gets erased as its decoding is so slow, the virtual function calls won't make
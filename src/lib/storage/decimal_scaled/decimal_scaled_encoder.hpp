@@ -0,0 +1,153 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storage/base_segment_encoder.hpp"
+
+#include "storage/decimal_scaled_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_segment/value_segment_iterable.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class DecimalScaledEncoder : public SegmentEncoder<DecimalScaledEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::DecimalScaled>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
+    const auto alloc = value_segment->values().get_allocator();
+
+    using SegmentType = DecimalScaledSegment<T>;
+    static constexpr auto block_size = SegmentType::block_size;
+    static constexpr auto exponent_count = SegmentType::max_exponent + 1u;
+
+    const auto size = value_segment->size();
+
+    // Ceiling of integer division
+    const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
+
+    const auto num_blocks = div_ceil(size, block_size);
+
+    auto block_minima = pmr_vector<int64_t>{alloc};
+    block_minima.reserve(num_blocks);
+
+    auto block_exponents = pmr_vector<uint8_t>{alloc};
+    block_exponents.reserve(num_blocks);
+
+    // holds the uncompressed offsets of the scaled values from the block's minimum
+    auto offset_values = pmr_vector<uint32_t>{alloc};
+    offset_values.reserve(size);
+
+    // holds whether a segment value is null
+    auto null_values = pmr_vector<bool>{alloc};
+    null_values.reserve(size);
+
+    auto exception_offsets = pmr_vector<ChunkOffset>{alloc};
+    auto exception_values = pmr_vector<T>{alloc};
+
+    // used as optional input for the compression of the offset values
+    auto max_offset = uint32_t{0u};
+
+    auto iterable = ValueSegmentIterable<T>{*value_segment};
+    iterable.with_iterators([&](auto segment_it, auto segment_end) {
+      // temporary storage to hold the values of one block and their scaled values for the chosen exponent
+      auto current_value_block = std::vector<std::optional<T>>{};
+      current_value_block.reserve(block_size);
+      auto scaled_value_block = std::vector<std::optional<int64_t>>(block_size);
+
+      auto block_begin = ChunkOffset{0};
+      while (segment_it != segment_end) {
+        current_value_block.clear();
+        for (; current_value_block.size() < block_size && segment_it != segment_end; ++segment_it) {
+          const auto segment_value = *segment_it;
+          null_values.push_back(segment_value.is_null());
+          current_value_block.emplace_back(segment_value.is_null() ? std::nullopt
+                                                                   : std::optional<T>{segment_value.value()});
+        }
+
+        // Count, for each exponent, how many of the block's values can be restored exactly
+        auto encodable_counts = std::array<size_t, exponent_count>{};
+        for (const auto& value : current_value_block) {
+          if (!value) continue;
+          for (auto exponent = uint8_t{0}; exponent < exponent_count; ++exponent) {
+            if (SegmentType::encode(*value, exponent)) ++encodable_counts[exponent];
+          }
+        }
+
+        // Prefer exponents that encode more values, and smaller exponents (i.e., smaller integers) among those. Since
+        // the offsets have to fit into uint32_t, an exponent might not be usable at all. In that case, all values
+        // become exceptions.
+        auto exponents = std::array<uint8_t, exponent_count>{};
+        for (auto exponent = uint8_t{0}; exponent < exponent_count; ++exponent) exponents[exponent] = exponent;
+        std::stable_sort(exponents.begin(), exponents.end(), [&](const auto lhs, const auto rhs) {
+          return encodable_counts[lhs] > encodable_counts[rhs];
+        });
+
+        auto chosen_exponent = std::optional<uint8_t>{};
+        auto minimum = int64_t{0};
+        for (const auto exponent : exponents) {
+          if (encodable_counts[exponent] == 0) break;
+
+          auto block_minimum = std::numeric_limits<int64_t>::max();
+          auto block_maximum = std::numeric_limits<int64_t>::min();
+          for (auto index = size_t{0}; index < current_value_block.size(); ++index) {
+            const auto& value = current_value_block[index];
+            scaled_value_block[index] = value ? SegmentType::encode(*value, exponent) : std::nullopt;
+            if (!scaled_value_block[index]) continue;
+
+            block_minimum = std::min(block_minimum, *scaled_value_block[index]);
+            block_maximum = std::max(block_maximum, *scaled_value_block[index]);
+          }
+
+          if (static_cast<uint64_t>(block_maximum - block_minimum) <= std::numeric_limits<uint32_t>::max()) {
+            chosen_exponent = exponent;
+            minimum = block_minimum;
+            break;
+          }
+        }
+
+        block_exponents.push_back(chosen_exponent.value_or(0));
+        block_minima.push_back(minimum);
+
+        for (auto index = size_t{0}; index < current_value_block.size(); ++index) {
+          const auto& value = current_value_block[index];
+          const auto& scaled_value = scaled_value_block[index];
+
+          if (value && (!chosen_exponent || !scaled_value)) {
+            exception_offsets.push_back(static_cast<ChunkOffset>(block_begin + index));
+            exception_values.push_back(*value);
+          }
+
+          if (!chosen_exponent || !scaled_value) {
+            offset_values.push_back(0u);
+            continue;
+          }
+
+          const auto offset = static_cast<uint32_t>(*scaled_value - minimum);
+          offset_values.push_back(offset);
+          max_offset = std::max(max_offset, offset);
+        }
+
+        block_begin += static_cast<ChunkOffset>(current_value_block.size());
+      }
+    });
+
+    auto compressed_offset_values = compress_vector(offset_values, vector_compression_type(), alloc, {max_offset});
+
+    return std::allocate_shared<DecimalScaledSegment<T>>(
+        alloc, std::move(block_minima), std::move(block_exponents), std::move(null_values),
+        std::move(compressed_offset_values), std::move(exception_offsets), std::move(exception_values));
+  }
+};
+
+}  // namespace opossum
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+
+#include "storage/segment_iterables.hpp"
+
+#include "storage/decimal_scaled_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace opossum {
+
+template <typename T>
+class DecimalScaledIterable : public PointAccessibleSegmentIterable<DecimalScaledIterable<T>> {
+ public:
+  using ValueType = T;
+
+  explicit DecimalScaledIterable(const DecimalScaledSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& offset_values) {
+      using OffsetValueIteratorT = decltype(offset_values.cbegin());
+
+      auto begin = Iterator<OffsetValueIteratorT>{&_segment, offset_values.cbegin(), _segment.null_values().cbegin()};
+
+      auto end = Iterator<OffsetValueIteratorT>{offset_values.cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
+    resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& vector) {
+      auto decompressor = vector.create_decompressor();
+      using OffsetValueDecompressorT = std::decay_t<decltype(*decompressor)>;
+
+      auto begin = PointAccessIterator<OffsetValueDecompressorT>{&_segment, std::move(decompressor),
+                                                                 position_filter->cbegin(), position_filter->cbegin()};
+
+      auto end = PointAccessIterator<OffsetValueDecompressorT>{position_filter->cbegin(), position_filter->cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const DecimalScaledSegment<T>& _segment;
+
+ private:
+  template <typename OffsetValueIteratorT>
+  class Iterator : public BaseSegmentIterator<Iterator<OffsetValueIteratorT>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = DecimalScaledIterable<T>;
+    using NullValueIterator = typename pmr_vector<bool>::const_iterator;
+    using ExceptionOffsetIterator = typename pmr_vector<ChunkOffset>::const_iterator;
+
+   public:
+    // Begin Iterator
+    explicit Iterator(const DecimalScaledSegment<T>* segment, OffsetValueIteratorT offset_value_it,
+                      NullValueIterator null_value_it)
+        : _segment{segment},
+          _offset_value_it{offset_value_it},
+          _null_value_it{null_value_it},
+          _chunk_offset{0u} {
+      if (_segment) _exception_offset_it = _segment->exception_offsets().cbegin();
+    }
+
+    // End iterator
+    explicit Iterator(OffsetValueIteratorT offset_value_it) : Iterator{nullptr, offset_value_it, {}} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_offset_value_it;
+      ++_null_value_it;
+      ++_chunk_offset;
+
+      // Keep _exception_offset_it at the first exception that is not before the current position
+      if (_exception_offset_it != _segment->exception_offsets().cend() && *_exception_offset_it < _chunk_offset) {
+        ++_exception_offset_it;
+      }
+    }
+
+    void decrement() {
+      --_offset_value_it;
+      --_null_value_it;
+      --_chunk_offset;
+
+      if (_exception_offset_it != _segment->exception_offsets().cbegin() &&
+          *std::prev(_exception_offset_it) >= _chunk_offset) {
+        --_exception_offset_it;
+      }
+    }
+
+    void advance(std::ptrdiff_t n) {
+      // The offset value iterators of some vector compressions only move one position at a time
+      if (n < 0) {
+        for (std::ptrdiff_t i = n; i < 0; ++i) {
+          --_offset_value_it;
+        }
+      } else {
+        for (std::ptrdiff_t i = 0; i < n; ++i) {
+          ++_offset_value_it;
+        }
+      }
+      _null_value_it += n;
+      _chunk_offset += n;
+
+      const auto& exception_offsets = _segment->exception_offsets();
+      _exception_offset_it = std::lower_bound(exception_offsets.cbegin(), exception_offsets.cend(), _chunk_offset);
+    }
+
+    bool equal(const Iterator& other) const { return _offset_value_it == other._offset_value_it; }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const { return other._offset_value_it - _offset_value_it; }
+
+    SegmentPosition<T> dereference() const {
+      if (*_null_value_it) return SegmentPosition<T>{T{}, true, _chunk_offset};
+
+      const auto& exception_offsets = _segment->exception_offsets();
+      if (_exception_offset_it != exception_offsets.cend() && *_exception_offset_it == _chunk_offset) {
+        const auto exception_index = std::distance(exception_offsets.cbegin(), _exception_offset_it);
+        return SegmentPosition<T>{_segment->exception_values()[exception_index], false, _chunk_offset};
+      }
+
+      const auto block_id = _chunk_offset / DecimalScaledSegment<T>::block_size;
+      const auto scaled_value = _segment->block_minima()[block_id] + static_cast<int64_t>(*_offset_value_it);
+      const auto value = DecimalScaledSegment<T>::decode(scaled_value, _segment->block_exponents()[block_id]);
+      return SegmentPosition<T>{value, false, _chunk_offset};
+    }
+
+   private:
+    const DecimalScaledSegment<T>* _segment;
+    OffsetValueIteratorT _offset_value_it;
+    NullValueIterator _null_value_it;
+    ExceptionOffsetIterator _exception_offset_it;
+    ChunkOffset _chunk_offset;
+  };
+
+  template <typename OffsetValueDecompressorT>
+  class PointAccessIterator
+      : public BasePointAccessSegmentIterator<PointAccessIterator<OffsetValueDecompressorT>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = DecimalScaledIterable<T>;
+
+    // Begin Iterator
+    PointAccessIterator(const DecimalScaledSegment<T>* segment,
+                        const std::shared_ptr<OffsetValueDecompressorT>& attribute_decompressor,
+                        const PosList::const_iterator position_filter_begin, PosList::const_iterator position_filter_it)
+        : BasePointAccessSegmentIterator<PointAccessIterator<OffsetValueDecompressorT>,
+                                         SegmentPosition<T>>{std::move(position_filter_begin),
+                                                             std::move(position_filter_it)},
+          _segment{segment},
+          _offset_value_decompressor{attribute_decompressor} {}
+
+    // End Iterator
+    explicit PointAccessIterator(const PosList::const_iterator position_filter_begin,
+                                 PosList::const_iterator position_filter_it)
+        : PointAccessIterator{nullptr, nullptr, std::move(position_filter_begin), std::move(position_filter_it)} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+      const auto chunk_offset = chunk_offsets.offset_in_referenced_chunk;
+
+      if (_segment->null_values()[chunk_offset]) return SegmentPosition<T>{T{}, true, chunk_offsets.offset_in_poslist};
+
+      const auto& exception_offsets = _segment->exception_offsets();
+      if (!exception_offsets.empty()) {
+        const auto exception_it = std::lower_bound(exception_offsets.cbegin(), exception_offsets.cend(), chunk_offset);
+        if (exception_it != exception_offsets.cend() && *exception_it == chunk_offset) {
+          const auto exception_index = std::distance(exception_offsets.cbegin(), exception_it);
+          return SegmentPosition<T>{_segment->exception_values()[exception_index], false,
+                                    chunk_offsets.offset_in_poslist};
+        }
+      }
+
+      const auto block_id = chunk_offset / DecimalScaledSegment<T>::block_size;
+      const auto scaled_value =
+          _segment->block_minima()[block_id] + static_cast<int64_t>(_offset_value_decompressor->get(chunk_offset));
+      const auto value = DecimalScaledSegment<T>::decode(scaled_value, _segment->block_exponents()[block_id]);
+      return SegmentPosition<T>{value, false, chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const DecimalScaledSegment<T>* _segment;
+    std::shared_ptr<OffsetValueDecompressorT> _offset_value_decompressor;
+  };
+};
+
+}  // namespace opossum
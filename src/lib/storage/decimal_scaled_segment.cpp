@@ -0,0 +1,133 @@
+#include "decimal_scaled_segment.hpp"
+
+#include <algorithm>
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T, typename U>
+DecimalScaledSegment<T, U>::DecimalScaledSegment(pmr_vector<int64_t> block_minima,
+                                                 pmr_vector<uint8_t> block_exponents, pmr_vector<bool> null_values,
+                                                 std::unique_ptr<const BaseCompressedVector> offset_values,
+                                                 pmr_vector<ChunkOffset> exception_offsets,
+                                                 pmr_vector<T> exception_values)
+    : BaseEncodedSegment{data_type_from_type<T>()},
+      _block_minima{std::move(block_minima)},
+      _block_exponents{std::move(block_exponents)},
+      _null_values{std::move(null_values)},
+      _offset_values{std::move(offset_values)},
+      _exception_offsets{std::move(exception_offsets)},
+      _exception_values{std::move(exception_values)},
+      _decompressor{_offset_values->create_base_decompressor()} {
+  DebugAssert(_exception_offsets.size() == _exception_values.size(), "Each exception needs a value.");
+  DebugAssert(std::is_sorted(_exception_offsets.cbegin(), _exception_offsets.cend()),
+              "Exception offsets need to be sorted.");
+}
+
+template <typename T, typename U>
+const pmr_vector<int64_t>& DecimalScaledSegment<T, U>::block_minima() const {
+  return _block_minima;
+}
+
+template <typename T, typename U>
+const pmr_vector<uint8_t>& DecimalScaledSegment<T, U>::block_exponents() const {
+  return _block_exponents;
+}
+
+template <typename T, typename U>
+const pmr_vector<bool>& DecimalScaledSegment<T, U>::null_values() const {
+  return _null_values;
+}
+
+template <typename T, typename U>
+const BaseCompressedVector& DecimalScaledSegment<T, U>::offset_values() const {
+  return *_offset_values;
+}
+
+template <typename T, typename U>
+const pmr_vector<ChunkOffset>& DecimalScaledSegment<T, U>::exception_offsets() const {
+  return _exception_offsets;
+}
+
+template <typename T, typename U>
+const pmr_vector<T>& DecimalScaledSegment<T, U>::exception_values() const {
+  return _exception_values;
+}
+
+template <typename T, typename U>
+const AllTypeVariant DecimalScaledSegment<T, U>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T, typename U>
+const std::optional<T> DecimalScaledSegment<T, U>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (_null_values[chunk_offset]) {
+    return std::nullopt;
+  }
+
+  if (!_exception_offsets.empty()) {
+    const auto exception_it = std::lower_bound(_exception_offsets.cbegin(), _exception_offsets.cend(), chunk_offset);
+    if (exception_it != _exception_offsets.cend() && *exception_it == chunk_offset) {
+      return _exception_values[std::distance(_exception_offsets.cbegin(), exception_it)];
+    }
+  }
+
+  const auto block_id = chunk_offset / block_size;
+  const auto scaled_value = _block_minima[block_id] + static_cast<int64_t>(_decompressor->get(chunk_offset));
+  return decode(scaled_value, _block_exponents[block_id]);
+}
+
+template <typename T, typename U>
+size_t DecimalScaledSegment<T, U>::size() const {
+  return _offset_values->size();
+}
+
+template <typename T, typename U>
+std::shared_ptr<BaseSegment> DecimalScaledSegment<T, U>::copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_block_minima = pmr_vector<int64_t>{_block_minima, alloc};
+  auto new_block_exponents = pmr_vector<uint8_t>{_block_exponents, alloc};
+  auto new_null_values = pmr_vector<bool>{_null_values, alloc};
+  auto new_offset_values = _offset_values->copy_using_allocator(alloc);
+  auto new_exception_offsets = pmr_vector<ChunkOffset>{_exception_offsets, alloc};
+  auto new_exception_values = pmr_vector<T>{_exception_values, alloc};
+
+  return std::allocate_shared<DecimalScaledSegment>(
+      alloc, std::move(new_block_minima), std::move(new_block_exponents), std::move(new_null_values),
+      std::move(new_offset_values), std::move(new_exception_offsets), std::move(new_exception_values));
+}
+
+template <typename T, typename U>
+size_t DecimalScaledSegment<T, U>::estimate_memory_usage() const {
+  static const auto bits_per_byte = 8u;
+
+  return sizeof(*this) + sizeof(int64_t) * _block_minima.size() + _block_exponents.size() +
+         _offset_values->data_size() + _null_values.size() / bits_per_byte +
+         (sizeof(ChunkOffset) + sizeof(T)) * _exception_offsets.size();
+}
+
+template <typename T, typename U>
+EncodingType DecimalScaledSegment<T, U>::encoding_type() const {
+  return EncodingType::DecimalScaled;
+}
+
+template <typename T, typename U>
+std::optional<CompressedVectorType> DecimalScaledSegment<T, U>::compressed_vector_type() const {
+  return _offset_values->type();
+}
+
+template class DecimalScaledSegment<float>;
+template class DecimalScaledSegment<double>;
+
+}  // namespace opossum
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <optional>
+
+#include "base_encoded_segment.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing lossless decimal scaling of floating-point values
+ *
+ * Floating-point columns often hold values with few decimal places, e.g., sensor readings such as 21.5 or prices such
+ * as 4.99. Multiplied by a power of ten, these become small integers, which can be stored much more compactly than
+ * the floating-point values themselves (similar to ALP, "Adaptive Lossless floating-Point compression").
+ *
+ * The segment is divided into fixed-size blocks. For each block, the encoder picks the exponent e for which most values
+ * v can be restored exactly from round(v * 10^e). These integers are then frame-of-reference encoded: each block
+ * stores its minimum integer, and the offsets from it are compressed using vector compression.
+ *
+ * The encoding is lossless: values that cannot be restored bit by bit (e.g., 1/3, NaN, infinity, or -0.0) are stored
+ * unmodified as exceptions, together with their chunk offsets. Their offsets in the compressed vector are zero.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(
+                          enum_c<EncodingType, EncodingType::DecimalScaled>, hana::type_c<T>)>>
+class DecimalScaledSegment : public BaseEncodedSegment {
+ public:
+  static constexpr auto block_size = 1024u;
+
+  // The largest exponent tried by the encoder. Values with more decimal places than float or double can represent
+  // precisely are not restored exactly anyway.
+  static constexpr auto max_exponent = uint8_t{std::is_same_v<T, float> ? 10 : 18};
+
+  explicit DecimalScaledSegment(pmr_vector<int64_t> block_minima, pmr_vector<uint8_t> block_exponents,
+                                pmr_vector<bool> null_values, std::unique_ptr<const BaseCompressedVector> offset_values,
+                                pmr_vector<ChunkOffset> exception_offsets, pmr_vector<T> exception_values);
+
+  const pmr_vector<int64_t>& block_minima() const;
+  const pmr_vector<uint8_t>& block_exponents() const;
+  const pmr_vector<bool>& null_values() const;
+  const BaseCompressedVector& offset_values() const;
+  const pmr_vector<ChunkOffset>& exception_offsets() const;
+  const pmr_vector<T>& exception_values() const;
+
+  static T decode(const int64_t scaled_value, const uint8_t exponent) {
+    return static_cast<T>(static_cast<double>(scaled_value) / _powers_of_ten[exponent]);
+  }
+
+  /**
+   * Returns round(value * 10^exponent) if decode() restores exactly the same value from it (including the sign of
+   * zero), std::nullopt otherwise. The encoder and the EncodingAdvisor use this to determine the exponents.
+   */
+  static std::optional<int64_t> encode(const T value, const uint8_t exponent) {
+    // Beyond 2^53, not every integer can be represented as a double. This also rules out NaN and infinity.
+    static constexpr auto max_scaled_value = static_cast<double>(int64_t{1} << 53);
+
+    const auto scaled_value = static_cast<double>(value) * _powers_of_ten[exponent];
+    if (!(std::abs(scaled_value) < max_scaled_value)) return std::nullopt;
+
+    const auto rounded_value = static_cast<int64_t>(std::llround(scaled_value));
+    const auto decoded_value = decode(rounded_value, exponent);
+    if (decoded_value != value || std::signbit(decoded_value) != std::signbit(value)) return std::nullopt;
+
+    return rounded_value;
+  }
+
+  /**
+   * @defgroup BaseSegment interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  const std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  static constexpr auto _powers_of_ten =
+      std::array<double, 19>{1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8, 1e9,
+                             1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+
+  const pmr_vector<int64_t> _block_minima;
+  const pmr_vector<uint8_t> _block_exponents;
+  const pmr_vector<bool> _null_values;
+  const std::unique_ptr<const BaseCompressedVector> _offset_values;
+  const pmr_vector<ChunkOffset> _exception_offsets;
+  const pmr_vector<T> _exception_values;
+  std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+}  // namespace opossum
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include "storage/base_segment_encoder.hpp"
+
+#include "storage/delta_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_segment/value_segment_iterable.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class DeltaEncoder : public SegmentEncoder<DeltaEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::Delta>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
+    using UnsignedT = std::make_unsigned_t<T>;
+
+    const auto alloc = value_segment->values().get_allocator();
+
+    static constexpr auto block_size = DeltaSegment<T>::block_size;
+
+    const auto size = value_segment->size();
+
+    // Ceiling of integer division
+    const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
+
+    const auto num_blocks = div_ceil(size, block_size);
+
+    // holds the values with NULLs replaced by the previous value, so that their delta is zero. NULLs at the
+    // beginning of the segment take the first non-NULL value instead of a default value (e.g., 0 for timestamps),
+    // which would result in a huge delta.
+    auto values = pmr_vector<T>{alloc};
+    values.reserve(size);
+
+    // holds whether a segment value is null
+    auto null_values = pmr_vector<bool>{alloc};
+    null_values.reserve(size);
+
+    auto leading_null_count = size_t{0};
+
+    auto iterable = ValueSegmentIterable<T>{*value_segment};
+    iterable.for_each([&](const auto& segment_value) {
+      null_values.push_back(segment_value.is_null());
+
+      if (!segment_value.is_null()) {
+        if (values.empty()) values.resize(leading_null_count, segment_value.value());
+        values.push_back(segment_value.value());
+      } else if (values.empty()) {
+        ++leading_null_count;
+      } else {
+        values.push_back(values.back());
+      }
+    });
+
+    // The segment contains only NULLs
+    if (values.empty()) values.resize(size, T{0});
+
+    // holds the first value of each block
+    auto block_bases = pmr_vector<T>{alloc};
+    block_bases.reserve(num_blocks);
+
+    // holds the minimum delta of each block
+    auto block_minimum_deltas = pmr_vector<T>{alloc};
+    block_minimum_deltas.reserve(num_blocks);
+
+    // holds the uncompressed offsets of the deltas from the block's minimum delta
+    auto offset_values = pmr_vector<uint32_t>{alloc};
+    offset_values.reserve(size);
+
+    // used as optional input for the compression of the offset values
+    auto max_offset = uint32_t{0u};
+
+    // Differences are computed on the unsigned type, so that they wrap around instead of overflowing
+    const auto delta = [&](const size_t index) {
+      return static_cast<T>(static_cast<UnsignedT>(values[index]) - static_cast<UnsignedT>(values[index - 1]));
+    };
+
+    for (auto block_begin = size_t{0}; block_begin < size; block_begin += block_size) {
+      const auto block_end = std::min(block_begin + block_size, size);
+
+      auto minimum_delta = std::numeric_limits<T>::max();
+      for (auto index = block_begin + 1; index < block_end; ++index) {
+        minimum_delta = std::min(minimum_delta, delta(index));
+      }
+      // Blocks with a single value do not have any deltas
+      if (block_end - block_begin == 1) minimum_delta = T{0};
+
+      block_bases.push_back(values[block_begin]);
+      block_minimum_deltas.push_back(minimum_delta);
+
+      // The first value of a block is stored as its base, it has no delta
+      offset_values.push_back(0u);
+
+      for (auto index = block_begin + 1; index < block_end; ++index) {
+        const auto offset = static_cast<UnsignedT>(delta(index)) - static_cast<UnsignedT>(minimum_delta);
+
+        // Make sure that the offset fits into uint32_t (required for vector compression.)
+        Assert(offset <= std::numeric_limits<uint32_t>::max(), "Range of deltas in block must fit into uint32_t.");
+
+        offset_values.push_back(static_cast<uint32_t>(offset));
+        max_offset = std::max(max_offset, static_cast<uint32_t>(offset));
+      }
+    }
+
+    auto compressed_offset_values = compress_vector(offset_values, vector_compression_type(), alloc, {max_offset});
+
+    return std::allocate_shared<DeltaSegment<T>>(alloc, std::move(block_bases), std::move(block_minimum_deltas),
+                                                 std::move(null_values), std::move(compressed_offset_values));
+  }
+};
+
+}  // namespace opossum
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <type_traits>
+
+#include "storage/segment_iterables.hpp"
+
+#include "storage/delta_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace opossum {
+
+template <typename T>
+class DeltaIterable : public PointAccessibleSegmentIterable<DeltaIterable<T>> {
+ public:
+  using ValueType = T;
+
+  explicit DeltaIterable(const DeltaSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& offset_values) {
+      using OffsetValueIteratorT = decltype(offset_values.cbegin());
+
+      auto begin = Iterator<OffsetValueIteratorT>{_segment.block_bases().cbegin(),
+                                                  _segment.block_minimum_deltas().cbegin(), offset_values.cbegin(),
+                                                  _segment.null_values().cbegin()};
+
+      auto end = Iterator<OffsetValueIteratorT>{offset_values.cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
+    resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& vector) {
+      auto decompressor = vector.create_decompressor();
+      using OffsetValueDecompressorT = std::decay_t<decltype(*decompressor)>;
+
+      auto begin = PointAccessIterator<OffsetValueDecompressorT>{
+          &_segment.block_bases(), &_segment.block_minimum_deltas(), &_segment.null_values(), std::move(decompressor),
+          position_filter->cbegin(), position_filter->cbegin()};
+
+      auto end = PointAccessIterator<OffsetValueDecompressorT>{position_filter->cbegin(), position_filter->cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const DeltaSegment<T>& _segment;
+
+ private:
+  template <typename OffsetValueIteratorT>
+  class Iterator : public BaseSegmentIterator<Iterator<OffsetValueIteratorT>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = DeltaIterable<T>;
+    using BlockValueIterator = typename pmr_vector<T>::const_iterator;
+    using NullValueIterator = typename pmr_vector<bool>::const_iterator;
+
+   public:
+    // Begin Iterator
+    explicit Iterator(BlockValueIterator block_base_it, BlockValueIterator block_minimum_delta_it,
+                      OffsetValueIteratorT offset_value_it, NullValueIterator null_value_it)
+        : _block_base_it{block_base_it},
+          _block_minimum_delta_it{block_minimum_delta_it},
+          _offset_value_it{offset_value_it},
+          _null_value_it{null_value_it},
+          _index_within_block{0u},
+          _chunk_offset{0u},
+          _previous_value{} {}
+
+    // End iterator
+    explicit Iterator(OffsetValueIteratorT offset_value_it) : Iterator{{}, {}, offset_value_it, {}} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      _previous_value = _current_value();
+
+      ++_offset_value_it;
+      ++_null_value_it;
+      ++_index_within_block;
+      ++_chunk_offset;
+
+      if (_index_within_block >= DeltaSegment<T>::block_size) {
+        _index_within_block = 0u;
+        ++_block_base_it;
+        ++_block_minimum_delta_it;
+      }
+    }
+
+    void decrement() {
+      --_offset_value_it;
+      --_null_value_it;
+      --_chunk_offset;
+
+      if (_index_within_block > 0) {
+        --_index_within_block;
+
+        // The previous value of the new position is its own value minus its delta
+        using UnsignedT = std::make_unsigned_t<T>;
+        _previous_value =
+            static_cast<T>(static_cast<UnsignedT>(_previous_value) - static_cast<UnsignedT>(*_block_minimum_delta_it) -
+                           static_cast<UnsignedT>(*_offset_value_it));
+      } else {
+        --_block_base_it;
+        --_block_minimum_delta_it;
+        _index_within_block = DeltaSegment<T>::block_size - 1;
+
+        // Sum up the deltas from the base of the block up to the previous position
+        _previous_value = *_block_base_it;
+        for (auto offset_value_it = _offset_value_it - _index_within_block + 1; offset_value_it < _offset_value_it;
+             ++offset_value_it) {
+          _previous_value = DeltaSegment<T>::apply_delta(_previous_value, *_block_minimum_delta_it, *offset_value_it);
+        }
+      }
+    }
+
+    void advance(std::ptrdiff_t n) {
+      // For now, the lazy approach
+      if (n < 0) {
+        for (std::ptrdiff_t i = n; i < 0; ++i) {
+          decrement();
+        }
+      } else {
+        for (std::ptrdiff_t i = 0; i < n; ++i) {
+          increment();
+        }
+      }
+    }
+
+    bool equal(const Iterator& other) const { return _offset_value_it == other._offset_value_it; }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const { return other._offset_value_it - _offset_value_it; }
+
+    SegmentPosition<T> dereference() const {
+      return SegmentPosition<T>{_current_value(), *_null_value_it, _chunk_offset};
+    }
+
+    // The iterator keeps the value of the previous position (instead of the current one), so that it never needs to
+    // read the delta of the position behind the last one
+    T _current_value() const {
+      if (_index_within_block == 0) return *_block_base_it;
+      return DeltaSegment<T>::apply_delta(_previous_value, *_block_minimum_delta_it, *_offset_value_it);
+    }
+
+   private:
+    BlockValueIterator _block_base_it;
+    BlockValueIterator _block_minimum_delta_it;
+    OffsetValueIteratorT _offset_value_it;
+    NullValueIterator _null_value_it;
+    size_t _index_within_block;
+    ChunkOffset _chunk_offset;
+    T _previous_value;
+  };
+
+  template <typename OffsetValueDecompressorT>
+  class PointAccessIterator
+      : public BasePointAccessSegmentIterator<PointAccessIterator<OffsetValueDecompressorT>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = DeltaIterable<T>;
+
+    // Begin Iterator
+    PointAccessIterator(const pmr_vector<T>* block_bases, const pmr_vector<T>* block_minimum_deltas,
+                        const pmr_vector<bool>* null_values,
+                        const std::shared_ptr<OffsetValueDecompressorT>& attribute_decompressor,
+                        const PosList::const_iterator position_filter_begin, PosList::const_iterator position_filter_it)
+        : BasePointAccessSegmentIterator<PointAccessIterator<OffsetValueDecompressorT>,
+                                         SegmentPosition<T>>{std::move(position_filter_begin),
+                                                             std::move(position_filter_it)},
+          _block_bases{block_bases},
+          _block_minimum_deltas{block_minimum_deltas},
+          _null_values{null_values},
+          _offset_value_decompressor{attribute_decompressor} {}
+
+    // End Iterator
+    explicit PointAccessIterator(const PosList::const_iterator position_filter_begin,
+                                 PosList::const_iterator position_filter_it)
+        : PointAccessIterator{nullptr, nullptr, nullptr, nullptr, std::move(position_filter_begin),
+                              std::move(position_filter_it)} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+
+      static constexpr auto block_size = DeltaSegment<T>::block_size;
+
+      const auto chunk_offset = chunk_offsets.offset_in_referenced_chunk;
+      const auto is_null = (*_null_values)[chunk_offset];
+      if (is_null) return SegmentPosition<T>{T{}, true, chunk_offsets.offset_in_poslist};
+
+      const auto block_id = chunk_offset / block_size;
+      const auto minimum_delta = (*_block_minimum_deltas)[block_id];
+
+      auto value = (*_block_bases)[block_id];
+      for (auto offset = block_id * block_size + 1; offset <= chunk_offset; ++offset) {
+        value = DeltaSegment<T>::apply_delta(value, minimum_delta, _offset_value_decompressor->get(offset));
+      }
+
+      return SegmentPosition<T>{value, false, chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const pmr_vector<T>* _block_bases;
+    const pmr_vector<T>* _block_minimum_deltas;
+    const pmr_vector<bool>* _null_values;
+    std::shared_ptr<OffsetValueDecompressorT> _offset_value_decompressor;
+  };
+};
+
+}  // namespace opossum
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+
+#include <memory>
+
+#include "base_encoded_segment.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing delta encoding
+ *
+ * Delta encoding stores the differences between consecutive values instead of the values themselves. It is meant for
+ * sorted or monotonic sequences such as timestamps or surrogate keys, where the deltas are small even though the
+ * values (and the value range within a block, as used by frame-of-reference encoding) are large.
+ *
+ * The segment is divided into fixed-size blocks. Each block stores its first value (the base) and the minimum of its
+ * deltas. The deltas are stored as offsets from that minimum, so that regular steps (e.g., one value per second)
+ * become zeros. These offsets are compressed using vector compression, which should be SimdBp128 (bit-packing) for
+ * the best compression rates.
+ *
+ * NULLs repeat the previous value (i.e., their delta is zero) and are marked in a separate vector.
+ *
+ * Accessing a single value requires summing up the deltas from the start of its block. The blocks are therefore
+ * small compared to the blocks of frame-of-reference encoding. Sequential accesses only add one delta per value.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(enum_c<EncodingType, EncodingType::Delta>,
+                                                                              hana::type_c<T>)>>
+class DeltaSegment : public BaseEncodedSegment {
+ public:
+  // Matches the block size of SimdBp128, so that a point access decompresses a single block of offsets
+  static constexpr auto block_size = 128u;
+
+  explicit DeltaSegment(pmr_vector<T> block_bases, pmr_vector<T> block_minimum_deltas, pmr_vector<bool> null_values,
+                        std::unique_ptr<const BaseCompressedVector> offset_values);
+
+  const pmr_vector<T>& block_bases() const;
+  const pmr_vector<T>& block_minimum_deltas() const;
+  const pmr_vector<bool>& null_values() const;
+  const BaseCompressedVector& offset_values() const;
+
+  /**
+   * Adds the delta at a position (i.e., the block's minimum delta plus the stored offset) to the previous value. The
+   * arithmetic is done on the unsigned type so that large deltas wrap around instead of overflowing.
+   */
+  static T apply_delta(const T previous_value, const T minimum_delta, const uint32_t offset) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    return static_cast<T>(static_cast<UnsignedT>(previous_value) + static_cast<UnsignedT>(minimum_delta) +
+                          static_cast<UnsignedT>(offset));
+  }
+
+  /**
+   * @defgroup BaseSegment interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  const std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  const pmr_vector<T> _block_bases;
+  const pmr_vector<T> _block_minimum_deltas;
+  const pmr_vector<bool> _null_values;
+  const std::unique_ptr<const BaseCompressedVector> _offset_values;
+  std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+}  // namespace opossum
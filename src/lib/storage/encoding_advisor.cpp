@@ -0,0 +1,453 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/decimal_scaled_segment.hpp"
+#include "storage/delta_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Number of bits needed to represent values up to max_value
+size_t bit_width(const uint64_t max_value) {
+  auto bits = size_t{1};
+  while (bits < 64 && (max_value >> bits) != 0) ++bits;
+  return bits;
+}
+
+// Estimated size of one element of a compressed vector that stores values up to max_value
+double compressed_vector_bytes_per_value(const VectorCompressionType vector_compression_type,
+                                         const uint64_t max_value) {
+  if (vector_compression_type == VectorCompressionType::SimdBp128) {
+    // Bit-packed blocks of 128 values, each with a one-byte header
+    return static_cast<double>(bit_width(max_value)) / 8.0 + 1.0 / 128.0;
+  }
+
+  if (max_value <= std::numeric_limits<uint8_t>::max()) return 1.0;
+  if (max_value <= std::numeric_limits<uint16_t>::max()) return 2.0;
+  return 4.0;
+}
+
+// Estimated size of a value in a ValueSegment or a dictionary. Strings additionally need a std::string object.
+double value_size(const DataType data_type, const SegmentCharacteristics& characteristics) {
+  auto size = 0.0;
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    size = static_cast<double>(sizeof(ColumnDataType));
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      size += static_cast<double>(characteristics.average_string_length);
+    }
+  });
+  return size;
+}
+
+// Estimated size of a value without any object overhead, as stored by LZ4
+double raw_value_size(const DataType data_type, const SegmentCharacteristics& characteristics) {
+  if (data_type == DataType::String) return static_cast<double>(characteristics.average_string_length);
+  return value_size(data_type, characteristics);
+}
+
+/**
+ * Relative costs of accessing a row, indexed by SegmentAccessType (Scan, PointAccess, Materialization). A sequential
+ * scan of an unencoded segment costs 1.0. Scans of dictionary segments compare value ids instead of values. Bit-packed
+ * (SimdBp128) vectors need to be unpacked, which is particularly expensive for point accesses. Point accesses to
+ * run-length segments search the runs, delta segments sum up the deltas from the start of the block, and LZ4 segments
+ * need to decompress a whole block for a point access. Decimal-scaled values are converted to floating-point values.
+ */
+std::array<double, SegmentAccessCounter::ACCESS_TYPE_COUNT> access_costs_per_row(
+    const SegmentEncodingSpec& encoding_spec, const SegmentCharacteristics& characteristics) {
+  auto costs = std::array<double, SegmentAccessCounter::ACCESS_TYPE_COUNT>{};
+  switch (encoding_spec.encoding_type) {
+    case EncodingType::Unencoded:
+      costs = {1.0, 1.0, 1.0};
+      break;
+    case EncodingType::Dictionary:
+      costs = {1.0, 1.5, 1.5};
+      break;
+    case EncodingType::FixedStringDictionary:
+      costs = {1.2, 2.0, 2.5};
+      break;
+    case EncodingType::FrameOfReference:
+      costs = {1.5, 2.0, 1.5};
+      break;
+    case EncodingType::RunLength: {
+      const auto run_search_cost = std::log2(static_cast<double>(characteristics.run_count) + 1.0) / 4.0;
+      costs = {1.5, 1.0 + run_search_cost, 1.5};
+    } break;
+    case EncodingType::LZ4:
+      costs = {5.0, 100.0, 5.0};
+      break;
+    case EncodingType::Delta:
+      costs = {1.5, 10.0, 1.5};
+      break;
+    case EncodingType::DecimalScaled:
+      costs = {2.0, 2.5, 2.0};
+      break;
+  }
+
+  if (encoding_spec.vector_compression_type == VectorCompressionType::SimdBp128) {
+    costs[static_cast<size_t>(SegmentAccessType::Scan)] += 0.5;
+    costs[static_cast<size_t>(SegmentAccessType::PointAccess)] += 2.5;
+    costs[static_cast<size_t>(SegmentAccessType::Materialization)] += 0.5;
+  }
+
+  return costs;
+}
+
+// Returns the encoding of an existing segment, for comparison with the recommended one
+SegmentEncodingSpec current_encoding(const BaseSegment& segment) {
+  const auto encoded_segment = dynamic_cast<const BaseEncodedSegment*>(&segment);
+  if (!encoded_segment) return SegmentEncodingSpec{EncodingType::Unencoded};
+
+  const auto compressed_vector_type = encoded_segment->compressed_vector_type();
+  if (!compressed_vector_type) return SegmentEncodingSpec{encoded_segment->encoding_type()};
+
+  const auto vector_compression_type = *compressed_vector_type == CompressedVectorType::SimdBp128
+                                           ? VectorCompressionType::SimdBp128
+                                           : VectorCompressionType::FixedSizeByteAligned;
+  return SegmentEncodingSpec{encoded_segment->encoding_type(), vector_compression_type};
+}
+
+bool encodings_equal(const SegmentEncodingSpec& lhs, const SegmentEncodingSpec& rhs) {
+  if (lhs.encoding_type != rhs.encoding_type) return false;
+  if (!lhs.vector_compression_type || !rhs.vector_compression_type) return true;
+  return *lhs.vector_compression_type == *rhs.vector_compression_type;
+}
+
+// FrameOfReferenceEncoder and DeltaEncoder store the offsets of the values (or deltas) from the block's minimum as
+// uint32_t and fail if they do not fit. The ranges of the whole segment are upper bounds for those of each block. The
+// DeltaEncoder replaces NULLs with the previous value, adding deltas of zero, which are covered by the value range.
+bool encoding_supports_segment(const SegmentEncodingSpec& encoding_spec,
+                               const SegmentCharacteristics& characteristics) {
+  constexpr auto max_offset = uint64_t{std::numeric_limits<uint32_t>::max()};
+  switch (encoding_spec.encoding_type) {
+    case EncodingType::FrameOfReference:
+      return characteristics.value_range.value_or(0) <= max_offset;
+    case EncodingType::Delta:
+      return characteristics.value_range.value_or(0) <= max_offset &&
+             characteristics.delta_range.value_or(0) <= max_offset;
+    default:
+      return true;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+EncodingAdvisor::EncodingAdvisor() : EncodingAdvisor(Config{}) {}
+
+EncodingAdvisor::EncodingAdvisor(const Config& config) : _config(config) {}
+
+SegmentCharacteristics EncodingAdvisor::analyze_segment(const BaseSegment& segment, const DataType data_type) {
+  auto characteristics = SegmentCharacteristics{};
+
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto value_counts = std::unordered_map<ColumnDataType, size_t>{};
+    auto previous_value = std::optional<ColumnDataType>{};
+    auto previous_is_null = std::optional<bool>{};
+    auto min_value = std::optional<ColumnDataType>{};
+    auto max_value = std::optional<ColumnDataType>{};
+    auto total_string_length = size_t{0};
+    auto min_delta = std::optional<int64_t>{};
+    auto max_delta = std::optional<int64_t>{};
+
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      ++characteristics.row_count;
+
+      if (position.is_null()) {
+        ++characteristics.null_count;
+        if (!previous_is_null || !*previous_is_null) ++characteristics.run_count;
+        previous_is_null = true;
+        return;
+      }
+
+      const auto& value = position.value();
+      if (!previous_is_null || *previous_is_null || !previous_value || *previous_value != value) {
+        ++characteristics.run_count;
+      }
+      if (previous_value && value < *previous_value) characteristics.is_sorted = false;
+
+      ++value_counts[value];
+      if (!min_value || value < *min_value) min_value = value;
+      if (!max_value || *max_value < value) max_value = value;
+
+      if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        total_string_length += value.size();
+        characteristics.max_string_length = std::max(characteristics.max_string_length, value.size());
+      }
+
+      if constexpr (std::is_integral_v<ColumnDataType>) {
+        if (previous_value) {
+          // Computed on unsigned values, so that the delta wraps around instead of overflowing (as in DeltaSegment)
+          const auto delta =
+              static_cast<int64_t>(static_cast<uint64_t>(value) - static_cast<uint64_t>(*previous_value));
+          if (!min_delta || delta < *min_delta) min_delta = delta;
+          if (!max_delta || *max_delta < delta) max_delta = delta;
+        }
+      }
+
+      if constexpr (std::is_floating_point_v<ColumnDataType>) {
+        auto exponent = uint8_t{0};
+        while (exponent <= DecimalScaledSegment<ColumnDataType>::max_exponent &&
+               !DecimalScaledSegment<ColumnDataType>::encode(value, exponent)) {
+          ++exponent;
+        }
+
+        if (exponent <= DecimalScaledSegment<ColumnDataType>::max_exponent) {
+          characteristics.decimal_exponent = std::max(characteristics.decimal_exponent.value_or(0), exponent);
+        } else {
+          ++characteristics.decimal_exception_count;
+        }
+      }
+
+      previous_value = value;
+      previous_is_null = false;
+    });
+
+    characteristics.distinct_count = value_counts.size();
+
+    const auto non_null_count = characteristics.row_count - characteristics.null_count;
+    for (const auto& [value, count] : value_counts) {
+      const auto probability = static_cast<double>(count) / static_cast<double>(non_null_count);
+      characteristics.entropy -= probability * std::log2(probability);
+    }
+
+    if constexpr (std::is_integral_v<ColumnDataType>) {
+      if (min_value) {
+        characteristics.value_range = static_cast<uint64_t>(*max_value) - static_cast<uint64_t>(*min_value);
+      }
+      if (min_delta) {
+        characteristics.delta_range = static_cast<uint64_t>(*max_delta) - static_cast<uint64_t>(*min_delta);
+      }
+    }
+
+    if constexpr (std::is_floating_point_v<ColumnDataType>) {
+      if (characteristics.decimal_exponent) {
+        const auto scaled_range = (static_cast<double>(*max_value) - static_cast<double>(*min_value)) *
+                                  std::pow(10.0, *characteristics.decimal_exponent);
+        if (scaled_range < static_cast<double>(std::numeric_limits<uint64_t>::max())) {
+          characteristics.value_range = static_cast<uint64_t>(scaled_range);
+        }
+      }
+    }
+
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      if (non_null_count > 0) characteristics.average_string_length = total_string_length / non_null_count;
+    }
+  });
+
+  return characteristics;
+}
+
+std::vector<SegmentEncodingSpec> EncodingAdvisor::candidate_encodings(const DataType data_type) {
+  auto candidates = std::vector<SegmentEncodingSpec>{};
+  for (const auto encoding_type : encoding_type_enum_values) {
+    if (!encoding_supports_data_type(encoding_type, data_type)) continue;
+
+    switch (encoding_type) {
+      case EncodingType::Dictionary:
+      case EncodingType::FixedStringDictionary:
+      case EncodingType::FrameOfReference:
+      case EncodingType::Delta:
+      case EncodingType::DecimalScaled:
+        candidates.emplace_back(encoding_type, VectorCompressionType::FixedSizeByteAligned);
+        candidates.emplace_back(encoding_type, VectorCompressionType::SimdBp128);
+        break;
+
+      case EncodingType::Unencoded:
+      case EncodingType::RunLength:
+      case EncodingType::LZ4:
+        candidates.emplace_back(encoding_type);
+        break;
+    }
+  }
+  return candidates;
+}
+
+size_t EncodingAdvisor::estimate_memory_usage(const SegmentEncodingSpec& encoding_spec, const DataType data_type,
+                                              const SegmentCharacteristics& characteristics) {
+  const auto row_count = static_cast<double>(characteristics.row_count);
+  const auto distinct_count = static_cast<double>(characteristics.distinct_count);
+  const auto run_count = static_cast<double>(characteristics.run_count);
+  const auto null_value_bytes = characteristics.null_count > 0 ? row_count : 0.0;
+  const auto vector_compression_type =
+      encoding_spec.vector_compression_type.value_or(VectorCompressionType::FixedSizeByteAligned);
+
+  auto bytes = 0.0;
+  switch (encoding_spec.encoding_type) {
+    case EncodingType::Unencoded:
+      bytes = row_count * value_size(data_type, characteristics) + null_value_bytes;
+      break;
+
+    case EncodingType::Dictionary:
+      // NULL is represented by an additional value id
+      bytes = distinct_count * value_size(data_type, characteristics) +
+              row_count * compressed_vector_bytes_per_value(vector_compression_type, characteristics.distinct_count);
+      break;
+
+    case EncodingType::FixedStringDictionary:
+      bytes = distinct_count * static_cast<double>(characteristics.max_string_length) +
+              row_count * compressed_vector_bytes_per_value(vector_compression_type, characteristics.distinct_count);
+      break;
+
+    case EncodingType::RunLength:
+      // Per run: the value, its end position, and its NULL flag
+      bytes = run_count * (value_size(data_type, characteristics) + sizeof(ChunkOffset) + 1.0);
+      break;
+
+    case EncodingType::FrameOfReference: {
+      // Each block stores its minimum and the offsets of its values. For sorted data, the range of a block is only a
+      // fraction of the range of the segment.
+      const auto block_size = static_cast<double>(FrameOfReferenceSegment<int32_t>::block_size);
+      const auto block_count = std::ceil(row_count / block_size);
+      auto block_value_range = static_cast<double>(characteristics.value_range.value_or(0));
+      if (characteristics.is_sorted && block_count > 0) block_value_range /= block_count;
+
+      bytes = block_count * value_size(data_type, characteristics) +
+              row_count * compressed_vector_bytes_per_value(vector_compression_type,
+                                                            static_cast<uint64_t>(block_value_range)) +
+              null_value_bytes;
+    } break;
+
+    case EncodingType::Delta: {
+      // Each block stores its base and its minimum delta, followed by the offsets of the deltas from that minimum
+      const auto block_count = std::ceil(row_count / static_cast<double>(DeltaSegment<int32_t>::block_size));
+      bytes = 2.0 * block_count * value_size(data_type, characteristics) +
+              row_count * compressed_vector_bytes_per_value(vector_compression_type,
+                                                            characteristics.delta_range.value_or(0)) +
+              null_value_bytes;
+    } break;
+
+    case EncodingType::DecimalScaled: {
+      // Like frame-of-reference encoding of the scaled values. Values that cannot be scaled are stored as exceptions,
+      // together with their chunk offsets. Without any scalable value, all values are exceptions.
+      const auto block_size = static_cast<double>(DecimalScaledSegment<double>::block_size);
+      const auto block_count = std::ceil(row_count / block_size);
+      auto block_value_range = static_cast<double>(characteristics.value_range.value_or(0));
+      if (characteristics.is_sorted && block_count > 0) block_value_range /= block_count;
+
+      const auto exception_count = characteristics.decimal_exponent
+                                       ? static_cast<double>(characteristics.decimal_exception_count)
+                                       : row_count - static_cast<double>(characteristics.null_count);
+
+      bytes = block_count * (sizeof(int64_t) + 1.0) +
+              row_count * compressed_vector_bytes_per_value(vector_compression_type,
+                                                            static_cast<uint64_t>(block_value_range)) +
+              exception_count * (sizeof(ChunkOffset) + value_size(data_type, characteristics)) + null_value_bytes;
+    } break;
+
+    case EncodingType::LZ4: {
+      // LZ4 compresses repeated sequences, so we approximate its size by the entropy of the values plus the distinct
+      // values as literals, or by the runs for data with few runs
+      const auto raw_size = raw_value_size(data_type, characteristics);
+      const auto entropy_bytes = row_count * characteristics.entropy / 8.0 + distinct_count * raw_size;
+      const auto run_bytes = run_count * (raw_size + 3.0);
+      bytes = std::min(entropy_bytes, run_bytes) + null_value_bytes;
+    } break;
+  }
+
+  return static_cast<size_t>(std::ceil(bytes));
+}
+
+double EncodingAdvisor::estimate_cost(const SegmentEncodingSpec& encoding_spec, const DataType data_type,
+                                      const SegmentCharacteristics& characteristics,
+                                      const SegmentAccessCounter& access_counter) const {
+  const auto memory_usage = estimate_memory_usage(encoding_spec, data_type, characteristics);
+  const auto access_costs = access_costs_per_row(encoding_spec, characteristics);
+
+  auto access_cost = 0.0;
+  for (const auto access_type :
+       {SegmentAccessType::Scan, SegmentAccessType::PointAccess, SegmentAccessType::Materialization}) {
+    access_cost +=
+        static_cast<double>(access_counter.row_count(access_type)) * access_costs[static_cast<size_t>(access_type)];
+  }
+
+  return _config.memory_cost_per_byte * static_cast<double>(memory_usage) + _config.access_cost_per_row * access_cost;
+}
+
+SegmentEncodingSpec EncodingAdvisor::recommend_segment_encoding(const BaseSegment& segment, const DataType data_type,
+                                                                const SegmentAccessCounter& access_counter) const {
+  const auto characteristics = analyze_segment(segment, data_type);
+
+  auto best_encoding_spec = SegmentEncodingSpec{EncodingType::Unencoded};
+  auto best_cost = std::numeric_limits<double>::max();
+  for (const auto& encoding_spec : candidate_encodings(data_type)) {
+    if (!encoding_supports_segment(encoding_spec, characteristics)) continue;
+
+    const auto cost = estimate_cost(encoding_spec, data_type, characteristics, access_counter);
+    if (cost < best_cost) {
+      best_cost = cost;
+      best_encoding_spec = encoding_spec;
+    }
+  }
+
+  return best_encoding_spec;
+}
+
+ChunkEncodingSpec EncodingAdvisor::recommend_chunk_encoding(const Table& table, const ChunkID chunk_id) const {
+  Assert(table.type() == TableType::Data, "Encodings can only be recommended for data tables");
+  const auto chunk = table.get_chunk(chunk_id);
+
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    chunk_encoding_spec.emplace_back(recommend_segment_encoding(
+        *chunk->get_segment(column_id), table.column_data_type(column_id), chunk->access_counter(column_id)));
+  }
+  return chunk_encoding_spec;
+}
+
+std::vector<std::shared_ptr<AbstractTask>> EncodingAdvisor::schedule_reencoding(const std::string& table_name) const {
+  const auto table = StorageManager::get().get_table(table_name);
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto& chunk = *table->get_chunk(chunk_id);
+    if (chunk.is_mutable() || chunk.size() == 0) continue;
+
+    // The analysis of the segments is part of the task, so that it does not block the caller
+    const auto task = std::make_shared<JobTask>([advisor = *this, table, chunk_id]() {
+      const auto chunk = table->get_chunk(chunk_id);
+      const auto chunk_encoding_spec = advisor.recommend_chunk_encoding(*table, chunk_id);
+
+      // The ChunkEncoder keeps indexed segments as they are, so changed recommendations for them are ignored
+      auto encoding_changes = false;
+      for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+        if (!encodings_equal(current_encoding(*chunk->get_segment(column_id)), chunk_encoding_spec[column_id]) &&
+            !chunk->is_indexed(column_id)) {
+          encoding_changes = true;
+        }
+      }
+      if (!encoding_changes) return;
+
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types(), chunk_encoding_spec);
+    });
+    task->schedule();
+    tasks.emplace_back(task);
+  }
+
+  return tasks;
+}
+
+}  // namespace opossum
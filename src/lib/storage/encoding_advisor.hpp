@@ -0,0 +1,104 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class BaseSegment;
+class SegmentAccessCounter;
+class Table;
+
+// Data characteristics of a segment that determine how well the encodings compress it
+struct SegmentCharacteristics {
+  size_t row_count{0};
+  size_t null_count{0};
+  size_t distinct_count{0};
+
+  // Number of runs of equal values (consecutive NULLs form a run as well)
+  size_t run_count{0};
+
+  // True if the non-NULL values are in ascending order
+  bool is_sorted{true};
+
+  // Difference between the largest and the smallest value, only set for integral columns and for floating-point
+  // columns that are decimal-scaled (see below), where it refers to the scaled values
+  std::optional<uint64_t> value_range;
+
+  // Difference between the largest and the smallest delta of consecutive non-NULL values, only set for integral columns
+  std::optional<uint64_t> delta_range;
+
+  // Only set for floating-point columns: the largest exponent that DecimalScaledSegment needs to restore a value
+  // exactly, and the number of values that it cannot restore with any exponent
+  std::optional<uint8_t> decimal_exponent;
+  size_t decimal_exception_count{0};
+
+  // Shannon entropy of the non-NULL values in bits per value
+  double entropy{0.0};
+
+  // Only set for string columns
+  size_t average_string_length{0};
+  size_t max_string_length{0};
+};
+
+/**
+ * The EncodingAdvisor selects an encoding per segment, taking into account both the data characteristics of the
+ * segment and how the segment is accessed by the workload (see SegmentAccessCounter, which needs to be enabled for
+ * this). For each encoding (and vector compression) that supports the data type, it estimates
+ *
+ *   cost = memory_cost_per_byte * estimated memory usage
+ *        + access_cost_per_row  * sum over access types (accessed rows * relative cost per row of the encoding)
+ *
+ * and recommends the cheapest one. Thus, rarely accessed segments are compressed as much as possible (e.g., using
+ * LZ4), whereas segments that are often scanned or accessed randomly are kept in encodings that are cheap to access.
+ *
+ * The memory usage is estimated from the characteristics, the access costs per row are rough relative values (with an
+ * unencoded sequential scan costing 1.0). Both are meant to rank the encodings, not to predict exact numbers.
+ */
+class EncodingAdvisor {
+ public:
+  struct Config {
+    // By default, accessing 100 rows is considered to cost as much as storing one byte
+    double memory_cost_per_byte{1.0};
+    double access_cost_per_row{0.01};
+  };
+
+  EncodingAdvisor();
+  explicit EncodingAdvisor(const Config& config);
+
+  static SegmentCharacteristics analyze_segment(const BaseSegment& segment, const DataType data_type);
+
+  // All encodings and vector compressions that support the data type, including Unencoded
+  static std::vector<SegmentEncodingSpec> candidate_encodings(const DataType data_type);
+
+  static size_t estimate_memory_usage(const SegmentEncodingSpec& encoding_spec, const DataType data_type,
+                                      const SegmentCharacteristics& characteristics);
+
+  double estimate_cost(const SegmentEncodingSpec& encoding_spec, const DataType data_type,
+                       const SegmentCharacteristics& characteristics, const SegmentAccessCounter& access_counter) const;
+
+  SegmentEncodingSpec recommend_segment_encoding(const BaseSegment& segment, const DataType data_type,
+                                                 const SegmentAccessCounter& access_counter) const;
+
+  ChunkEncodingSpec recommend_chunk_encoding(const Table& table, const ChunkID chunk_id) const;
+
+  /**
+   * Schedules a task for each immutable chunk of the stored table that analyzes the chunk and re-encodes it if a
+   * different encoding is recommended than the current one. Indexed segments are not re-encoded. If a
+   * NodeQueueScheduler is active, both the analysis and the re-encoding happen in the background, the returned tasks
+   * can be used to wait for them.
+   */
+  std::vector<std::shared_ptr<AbstractTask>> schedule_reencoding(const std::string& table_name) const;
+
+ private:
+  const Config _config;
+};
+
+}  // namespace opossum
@@ -17,12 +17,22 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
-enum class EncodingType : uint8_t { Unencoded, Dictionary, RunLength, FixedStringDictionary, FrameOfReference, LZ4 };
+enum class EncodingType : uint8_t {
+  Unencoded,
+  Dictionary,
+  RunLength,
+  FixedStringDictionary,
+  FrameOfReference,
+  LZ4,
+  Delta,
+  DecimalScaled
+};
 
 inline static std::vector<EncodingType> encoding_type_enum_values{
     EncodingType::Unencoded,        EncodingType::Dictionary,
     EncodingType::RunLength,        EncodingType::FixedStringDictionary,
-    EncodingType::FrameOfReference, EncodingType::LZ4};
+    EncodingType::FrameOfReference, EncodingType::LZ4,
+    EncodingType::Delta,            EncodingType::DecimalScaled};
 
 /**
  * @brief Maps each encoding type to its supported data types
@@ -38,7 +48,9 @@ constexpr auto supported_data_types_for_encoding_type = hana::make_map(
     hana::make_pair(enum_c<EncodingType, EncodingType::RunLength>, data_types),
     hana::make_pair(enum_c<EncodingType, EncodingType::FixedStringDictionary>, hana::tuple_t<pmr_string>),
     hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, hana::tuple_t<int32_t, int64_t>),
-    hana::make_pair(enum_c<EncodingType, EncodingType::LZ4>, data_types));
+    hana::make_pair(enum_c<EncodingType, EncodingType::LZ4>, data_types),
+    hana::make_pair(enum_c<EncodingType, EncodingType::Delta>, hana::tuple_t<int32_t, int64_t>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::DecimalScaled>, hana::tuple_t<float, double>));
 
 /**
  * @return an integral constant implicitly convertible to bool
@@ -61,4 +61,8 @@ SegmentIndexType BaseIndex::type() const { return _type; }
 
 size_t BaseIndex::memory_consumption() const { return _memory_consumption(); }
 
+std::vector<std::shared_ptr<const BaseSegment>> BaseIndex::get_indexed_segments() const {
+  return _get_indexed_segments();
+}
+
 }  // namespace opossum
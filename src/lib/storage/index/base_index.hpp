@@ -126,6 +126,11 @@ class BaseIndex : private Noncopyable {
    */
   size_t memory_consumption() const;
 
+  /**
+   * Returns the indexed segments in the order in which they are indexed
+   */
+  std::vector<std::shared_ptr<const BaseSegment>> get_indexed_segments() const;
+
  protected:
   /**
    * Seperate the public interface of the index from the interface for programmers implementing own
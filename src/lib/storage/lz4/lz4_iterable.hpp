@@ -37,25 +37,18 @@ class LZ4Iterable : public PointAccessibleSegmentIterable<LZ4Iterable<T>> {
   /**
    * For the point access, we first retrieve the values for all chunk offsets in the position list and then save
    * the decompressed values in a vector. The first value in that vector (index 0) is the value for the chunk offset
-   * at index 0 in the position list.
+   * at index 0 in the position list. The values are retrieved grouped by block, so that each block is decompressed at
+   * most once, no matter how the position list is ordered.
    */
   template <typename Functor>
   void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
     using ValueIterator = typename std::vector<T>::const_iterator;
 
-    auto decompressed_filtered_segment = std::vector<ValueType>(position_filter->size());
-    auto cached_block = std::vector<char>{};
-    auto cached_block_index = std::optional<size_t>{};
-    for (auto index = size_t{0u}; index < position_filter->size(); ++index) {
-      const auto& position = (*position_filter)[index];
-      auto [value, block_index] = _segment.decompress(position.chunk_offset, cached_block_index, cached_block);  // NOLINT
-      decompressed_filtered_segment[index] = std::move(value);
-      cached_block_index = block_index;
-    }
+    const auto decompressed_filtered_segment = _segment.decompress(*position_filter);
 
-    auto begin = PointAccessIterator<ValueIterator>{decompressed_filtered_segment, &_segment.null_values(),
+    auto begin = PointAccessIterator<ValueIterator>{&decompressed_filtered_segment, &_segment.null_values(),
                                                     position_filter->cbegin(), position_filter->cbegin()};
-    auto end = PointAccessIterator<ValueIterator>{decompressed_filtered_segment, &_segment.null_values(),
+    auto end = PointAccessIterator<ValueIterator>{&decompressed_filtered_segment, &_segment.null_values(),
                                                   position_filter->cbegin(), position_filter->cend()};
 
     functor(begin, end);
@@ -129,7 +122,7 @@ class LZ4Iterable : public PointAccessibleSegmentIterable<LZ4Iterable<T>> {
     using IterableType = LZ4Iterable<T>;
 
     // Begin Iterator
-    PointAccessIterator(const std::vector<T>& data, const std::optional<pmr_vector<bool>>* null_values,
+    PointAccessIterator(const std::vector<T>* data, const std::optional<pmr_vector<bool>>* null_values,
                         const PosList::const_iterator position_filter_begin, PosList::const_iterator position_filter_it)
         : BasePointAccessSegmentIterator<PointAccessIterator<ValueIterator>,
                                          SegmentPosition<T>>{std::move(position_filter_begin),
@@ -142,13 +135,14 @@ class LZ4Iterable : public PointAccessibleSegmentIterable<LZ4Iterable<T>> {
 
     SegmentPosition<T> dereference() const {
       const auto& chunk_offsets = this->chunk_offsets();
-      const auto value = _data[chunk_offsets.offset_in_poslist];
+      const auto& value = (*_data)[chunk_offsets.offset_in_poslist];
       const auto is_null = *_null_values && (**_null_values)[chunk_offsets.offset_in_referenced_chunk];
       return SegmentPosition<T>{value, is_null, chunk_offsets.offset_in_poslist};
     }
 
    private:
-    const std::vector<T> _data;
+    // Iterators are copied frequently, so they only point to the decompressed values
+    const std::vector<T>* _data;
     const std::optional<pmr_vector<bool>>* _null_values;
   };
 };
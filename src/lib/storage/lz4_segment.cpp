@@ -2,9 +2,11 @@
 
 #include <lz4.h>
 
+#include <algorithm>
 #include <climits>
 #include <sstream>
 #include <string>
+#include <utility>
 
 #include "resolve_type.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
@@ -266,29 +268,20 @@ std::pair<T, size_t> LZ4Segment<T>::decompress(const ChunkOffset& chunk_offset,
 }
 
 template <>
-std::pair<pmr_string, size_t> LZ4Segment<pmr_string>::decompress(const ChunkOffset& chunk_offset,
-                                                                 const std::optional<size_t> cached_block_index,
-                                                                 std::vector<char>& cached_block) const {
-  /**
-   * If the input segment only contained empty strings, the original size is 0. The segment can't be decompressed, and
-   * instead we can just return as many empty strings as the input contained.
-   */
-  if (_lz4_blocks.empty()) {
-    return std::pair{pmr_string{""}, 0u};
-  }
-
+std::pair<pmr_string, size_t> LZ4Segment<pmr_string>::_decompress_string(
+    const ChunkOffset& chunk_offset, BaseVectorDecompressor& offset_decompressor,
+    const std::optional<size_t> cached_block_index, std::vector<char>& cached_block) const {
   /**
    * Calculate character begin and end offsets. This range may span more than one block. If this is the case, multiple
    * blocks need to be decompressed.
    * The offsets are stored in a compressed vector and accessed via the vector decompression interface.
    */
-  auto offset_decompressor = (*_string_offsets)->create_base_decompressor();
-  auto start_offset = offset_decompressor->get(chunk_offset);
+  auto start_offset = offset_decompressor.get(chunk_offset);
   size_t end_offset;
-  if (chunk_offset + 1 == offset_decompressor->size()) {
+  if (chunk_offset + 1 == offset_decompressor.size()) {
     end_offset = (_lz4_blocks.size() - 1) * _block_size + _last_block_size;
   } else {
-    end_offset = offset_decompressor->get(chunk_offset + 1);
+    end_offset = offset_decompressor.get(chunk_offset + 1);
   }
 
   /**
@@ -336,7 +329,7 @@ std::pair<pmr_string, size_t> LZ4Segment<pmr_string>::decompress(const ChunkOffs
      * is used.
      */
     const auto use_caching =
-        cached_block_index && *cached_block_index >= start_block && *cached_block_index <= end_offset;
+        cached_block_index && *cached_block_index >= start_block && *cached_block_index <= end_block;
 
     /**
      * If the cached block is not the first block, keep a copy so that the blocks can still be decompressed into the
@@ -390,12 +383,79 @@ std::pair<pmr_string, size_t> LZ4Segment<pmr_string>::decompress(const ChunkOffs
   }
 }
 
+template <>
+std::pair<pmr_string, size_t> LZ4Segment<pmr_string>::decompress(const ChunkOffset& chunk_offset,
+                                                                 const std::optional<size_t> cached_block_index,
+                                                                 std::vector<char>& cached_block) const {
+  /**
+   * If the input segment only contained empty strings, the original size is 0. The segment can't be decompressed, and
+   * instead we can just return as many empty strings as the input contained.
+   */
+  if (_lz4_blocks.empty()) {
+    return std::pair{pmr_string{""}, 0u};
+  }
+
+  const auto offset_decompressor = (*_string_offsets)->create_base_decompressor();
+  return _decompress_string(chunk_offset, *offset_decompressor, cached_block_index, cached_block);
+}
+
 template <typename T>
 T LZ4Segment<T>::decompress(const ChunkOffset& chunk_offset) const {
   auto decompressed_block = std::vector<char>(_block_size);
   return decompress(chunk_offset, std::nullopt, decompressed_block).first;
 }
 
+template <typename T>
+std::vector<T> LZ4Segment<T>::decompress(const PosList& position_filter) const {
+  auto values = std::vector<T>(position_filter.size());
+
+  // See decompress() for segments that only contain empty strings
+  if (position_filter.empty() || _lz4_blocks.empty()) {
+    return values;
+  }
+
+  auto offset_decompressor = std::unique_ptr<BaseVectorDecompressor>{};
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    offset_decompressor = (*_string_offsets)->create_base_decompressor();
+  }
+
+  /**
+   * Pair each position with the block it resides in (for strings, the block in which the string starts) and sort the
+   * positions by that block. Positions in the same block keep the order of the list.
+   */
+  auto positions_by_block = std::vector<std::pair<size_t, size_t>>(position_filter.size());
+  for (auto index = size_t{0u}; index < position_filter.size(); ++index) {
+    const auto chunk_offset = position_filter[index].chunk_offset;
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      positions_by_block[index] = {offset_decompressor->get(chunk_offset) / _block_size, index};
+    } else {
+      positions_by_block[index] = {chunk_offset * sizeof(T) / _block_size, index};
+    }
+  }
+
+  if (!std::is_sorted(positions_by_block.cbegin(), positions_by_block.cend())) {
+    std::sort(positions_by_block.begin(), positions_by_block.end());
+  }
+
+  auto cached_block = std::vector<char>{};
+  auto cached_block_index = std::optional<size_t>{};
+  for (const auto& [block_index, index] : positions_by_block) {
+    const auto chunk_offset = position_filter[index].chunk_offset;
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      auto [value, new_cached_block_index] =
+          _decompress_string(chunk_offset, *offset_decompressor, cached_block_index, cached_block);
+      values[index] = std::move(value);
+      cached_block_index = new_cached_block_index;
+    } else {
+      const auto [value, new_cached_block_index] = decompress(chunk_offset, cached_block_index, cached_block);
+      values[index] = value;
+      cached_block_index = new_cached_block_index;
+    }
+  }
+
+  return values;
+}
+
 template <typename T>
 std::shared_ptr<BaseSegment> LZ4Segment<T>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
   auto new_lz4_blocks = pmr_vector<pmr_vector<char>>{alloc};
@@ -150,6 +150,16 @@ class LZ4Segment : public BaseEncodedSegment {
   std::pair<T, size_t> decompress(const ChunkOffset& chunk_offset, const std::optional<size_t> cached_block_index,
                                   std::vector<char>& cached_block) const;
 
+  /**
+   * Retrieves the values at the positions of a position list and decompresses each block at most once. For that, the
+   * positions are accessed grouped by the block they reside in instead of in the order of the list. Otherwise, an
+   * unordered position list (e.g., the output of a hash join) would decompress the same blocks again and again.
+   *
+   * @param position_filter The positions of the values. All of them have to reference this segment.
+   * @return A vector containing the decompressed values in the order of the position list.
+   */
+  std::vector<T> decompress(const PosList& position_filter) const;
+
   std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
 
   size_t estimate_memory_usage() const final;
@@ -211,6 +221,15 @@ class LZ4Segment : public BaseEncodedSegment {
    */
   void _decompress_block_to_bytes(const size_t block_index, std::vector<char>& decompressed_data,
                                   const size_t write_offset) const;
+
+  /**
+   * Retrieves a single string (see the cached decompress method above). The passed decompressor of the string offsets
+   * is reused across calls, so that decompressing many strings does not create a new decompressor for each of them.
+   */
+  std::pair<pmr_string, size_t> _decompress_string(const ChunkOffset& chunk_offset,
+                                                   BaseVectorDecompressor& offset_decompressor,
+                                                   const std::optional<size_t> cached_block_index,
+                                                   std::vector<char>& cached_block) const;
 };
 
 }  // namespace opossum
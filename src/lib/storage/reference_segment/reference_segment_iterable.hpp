@@ -49,12 +49,17 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
         }
       });
     } else {
-      using Accessors = std::vector<std::shared_ptr<AbstractSegmentAccessor<T>>>;
-
-      auto accessors = std::make_shared<Accessors>(referenced_table->chunk_count());
-
-      auto begin = MultipleChunkIterator{referenced_table, referenced_column_id, accessors, begin_it, begin_it};
-      auto end = MultipleChunkIterator{referenced_table, referenced_column_id, accessors, begin_it, end_it};
+      // Retrieve all values upfront. Consecutive positions that reference the same chunk are retrieved in a single
+      // batch, instead of making a virtual call per position.
+      const auto size = pos_list.size();
+      auto values = std::vector<T>(size);
+      auto null_values = std::make_unique<bool[]>(size);
+      auto accessors = std::vector<std::unique_ptr<AbstractSegmentAccessor<T>>>(referenced_table->chunk_count());
+      access_row_ids(*referenced_table, referenced_column_id, pos_list.cbegin(), pos_list.cend(), accessors,
+                     values.data(), null_values.get());
+
+      auto begin = MultipleChunkIterator{values.data(), null_values.get(), ChunkOffset{0}};
+      auto end = MultipleChunkIterator{values.data(), null_values.get(), static_cast<ChunkOffset>(size)};
 
       functor(begin, end);
     }
@@ -114,73 +119,41 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
     std::shared_ptr<Accessor> _accessor;
   };
 
-  // The iterator for cases where we potentially iterate over multiple referenced chunks
+  // The iterator for cases where we potentially iterate over multiple referenced chunks. It iterates over the values
+  // that were retrieved upfront.
   class MultipleChunkIterator : public BaseSegmentIterator<MultipleChunkIterator, SegmentPosition<T>> {
    public:
     using ValueType = T;
     using IterableType = ReferenceSegmentIterable<T>;
-    using PosListIterator = PosList::const_iterator;
 
    public:
-    explicit MultipleChunkIterator(
-        const std::shared_ptr<const Table>& referenced_table, const ColumnID referenced_column_id,
-        const std::shared_ptr<std::vector<std::shared_ptr<AbstractSegmentAccessor<T>>>>& accessors,
-        const PosListIterator& begin_pos_list_it, const PosListIterator& pos_list_it)
-        : _referenced_table{referenced_table},
-          _referenced_column_id{referenced_column_id},
-          _begin_pos_list_it{begin_pos_list_it},
-          _pos_list_it{pos_list_it},
-          _accessors{accessors} {}
+    explicit MultipleChunkIterator(const T* values, const bool* null_values, const ChunkOffset chunk_offset)
+        : _values{values}, _null_values{null_values}, _chunk_offset{chunk_offset} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
-    void increment() { ++_pos_list_it; }
-
-    void decrement() { --_pos_list_it; }
-
-    void advance(std::ptrdiff_t n) { _pos_list_it += n; }
-
-    bool equal(const MultipleChunkIterator& other) const { return _pos_list_it == other._pos_list_it; }
-
-    std::ptrdiff_t distance_to(const MultipleChunkIterator& other) const { return other._pos_list_it - _pos_list_it; }
-
-    // TODO(anyone): benchmark if using two maps instead doing the dynamic cast every time really is faster.
-    SegmentPosition<T> dereference() const {
-      const auto pos_list_offset = static_cast<ChunkOffset>(std::distance(_begin_pos_list_it, _pos_list_it));
+    void increment() { ++_chunk_offset; }
 
-      if (_pos_list_it->is_null()) return SegmentPosition<T>{T{}, true, pos_list_offset};
+    void decrement() { --_chunk_offset; }
 
-      const auto chunk_id = _pos_list_it->chunk_id;
-      const auto& chunk_offset = _pos_list_it->chunk_offset;
+    void advance(std::ptrdiff_t n) { _chunk_offset += n; }
 
-      if (!(*_accessors)[chunk_id]) {
-        _create_accessor(chunk_id);
-      }
-      const auto typed_value = (*_accessors)[chunk_id]->access(chunk_offset);
+    bool equal(const MultipleChunkIterator& other) const { return _chunk_offset == other._chunk_offset; }
 
-      if (typed_value) {
-        return SegmentPosition<T>{std::move(*typed_value), false, pos_list_offset};
-      } else {
-        return SegmentPosition<T>{T{}, true, pos_list_offset};
-      }
+    std::ptrdiff_t distance_to(const MultipleChunkIterator& other) const {
+      return std::ptrdiff_t{other._chunk_offset} - std::ptrdiff_t{_chunk_offset};
     }
 
-    void _create_accessor(const ChunkID chunk_id) const {
-      auto segment = _referenced_table->get_chunk(chunk_id)->get_segment(_referenced_column_id);
-      auto accessor = std::move(create_segment_accessor<T>(segment));
-      (*_accessors)[chunk_id] = std::move(accessor);
+    SegmentPosition<T> dereference() const {
+      if (_null_values[_chunk_offset]) return SegmentPosition<T>{T{}, true, _chunk_offset};
+      return SegmentPosition<T>{_values[_chunk_offset], false, _chunk_offset};
     }
 
    private:
-    std::shared_ptr<const Table> _referenced_table;
-    ColumnID _referenced_column_id;
-
-    PosListIterator _begin_pos_list_it;
-    PosListIterator _pos_list_it;
-
-    // PointAccessIterators share vector with one Accessor per Chunk
-    std::shared_ptr<std::vector<std::shared_ptr<AbstractSegmentAccessor<T>>>> _accessors;
+    const T* _values;
+    const bool* _null_values;
+    ChunkOffset _chunk_offset;
   };
 };
 
@@ -8,6 +8,8 @@
 #include <memory>
 
 // Include your encoded segment file here!
+#include "storage/decimal_scaled_segment.hpp"
+#include "storage/delta_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
@@ -34,7 +36,9 @@ constexpr auto encoded_segment_for_type = hana::make_map(
     hana::make_pair(enum_c<EncodingType, EncodingType::FixedStringDictionary>,
                     template_c<FixedStringDictionarySegment>),
     hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, template_c<FrameOfReferenceSegment>),
-    hana::make_pair(enum_c<EncodingType, EncodingType::LZ4>, template_c<LZ4Segment>));
+    hana::make_pair(enum_c<EncodingType, EncodingType::LZ4>, template_c<LZ4Segment>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::Delta>, template_c<DeltaSegment>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::DecimalScaled>, template_c<DecimalScaledSegment>));
 
 /**
  * @brief Resolves the type of an encoded segment.
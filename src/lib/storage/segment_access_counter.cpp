@@ -0,0 +1,59 @@
+#include "segment_access_counter.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+void record_segment_access(const Chunk& chunk, const ColumnID column_id, const SegmentAccessType access_type) {
+  if (!SegmentAccessCounter::is_enabled()) return;
+
+  const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(column_id));
+  if (!reference_segment) {
+    chunk.access_counter(column_id).increase(access_type, chunk.size());
+    return;
+  }
+
+  const auto& pos_list = *reference_segment->pos_list();
+  if (pos_list.empty()) return;
+
+  const auto& referenced_table = *reference_segment->referenced_table();
+  const auto referenced_column_id = reference_segment->referenced_column_id();
+
+  if (pos_list.references_single_chunk()) {
+    const auto referenced_chunk_id = pos_list.common_chunk_id();
+    if (referenced_chunk_id == INVALID_CHUNK_ID) return;
+
+    referenced_table.get_chunk(referenced_chunk_id)
+        ->access_counter(referenced_column_id)
+        .increase(SegmentAccessType::PointAccess, pos_list.size());
+    return;
+  }
+
+  auto row_counts = std::vector<uint64_t>(referenced_table.chunk_count());
+  for (const auto& row_id : pos_list) {
+    if (row_id.is_null()) continue;
+    ++row_counts[row_id.chunk_id];
+  }
+
+  for (auto referenced_chunk_id = ChunkID{0}; referenced_chunk_id < row_counts.size(); ++referenced_chunk_id) {
+    if (row_counts[referenced_chunk_id] == 0) continue;
+    referenced_table.get_chunk(referenced_chunk_id)
+        ->access_counter(referenced_column_id)
+        .increase(SegmentAccessType::PointAccess, row_counts[referenced_chunk_id]);
+  }
+}
+
+void record_segment_accesses(const Table& table, const ColumnID column_id, const SegmentAccessType access_type) {
+  if (!SegmentAccessCounter::is_enabled()) return;
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    record_segment_access(*table.get_chunk(chunk_id), column_id, access_type);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+enum class SegmentAccessType : uint8_t {
+  Scan,            // Sequential evaluation of a predicate on all rows of a segment
+  PointAccess,     // Random accesses to single rows, e.g., through the PosList of a ReferenceSegment
+  Materialization  // Sequential decoding of all values, e.g., by joins, aggregates, or sorts
+};
+
+/**
+ * Counts the rows that were accessed in a segment, by type of access. The EncodingAdvisor uses the counts to weigh the
+ * access costs of the encodings against their memory consumption. Chunks keep one counter per column (instead of one
+ * per segment), so that the counts are not lost when a segment is re-encoded.
+ *
+ * Recording accesses adds work to the operators (e.g., a pass over the PosLists of ReferenceSegments) and contended
+ * atomic increments. Thus, it is disabled by default and has to be enabled for workloads that the EncodingAdvisor
+ * should take into account.
+ */
+class SegmentAccessCounter {
+ public:
+  static constexpr auto ACCESS_TYPE_COUNT = size_t{3};
+
+  static void set_enabled(const bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+  static bool is_enabled() { return _enabled.load(std::memory_order_relaxed); }
+
+  void increase(const SegmentAccessType access_type, const uint64_t row_count) {
+    _row_counts[static_cast<size_t>(access_type)].fetch_add(row_count, std::memory_order_relaxed);
+  }
+
+  uint64_t row_count(const SegmentAccessType access_type) const {
+    return _row_counts[static_cast<size_t>(access_type)].load(std::memory_order_relaxed);
+  }
+
+  void reset() {
+    for (auto& row_count : _row_counts) {
+      row_count.store(0, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  inline static std::atomic_bool _enabled{false};
+
+  std::array<std::atomic<uint64_t>, ACCESS_TYPE_COUNT> _row_counts{};
+};
+
+/**
+ * Records an access to the segment at @param column_id of @param chunk. If it is a ReferenceSegment, the access is
+ * recorded as point accesses to the referenced segments, one per position. Does nothing unless the SegmentAccessCounter
+ * is enabled.
+ */
+void record_segment_access(const Chunk& chunk, const ColumnID column_id, const SegmentAccessType access_type);
+
+// Records an access to the segments at @param column_id of all chunks of @param table
+void record_segment_accesses(const Table& table, const ColumnID column_id, const SegmentAccessType access_type);
+
+}  // namespace opossum
@@ -1,11 +1,16 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "storage/base_segment_accessor.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/lz4_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "types.hpp"
 #include "utils/performance_warning.hpp"
 
@@ -31,12 +36,53 @@ std::unique_ptr<AbstractSegmentAccessor<T>> create_segment_accessor(const std::s
   return opossum::detail::CreateSegmentAccessor<T>::create(segment);
 }
 
+/**
+ * Retrieves the values of the segments at @param column_id of @param table for the RowIDs in [@param row_id_it,
+ * @param row_id_end) and writes them to @param values and @param null_values (see the batched
+ * AbstractSegmentAccessor::access). Consecutive RowIDs that reference the same chunk are retrieved in a single batch.
+ * The accessors are created lazily and kept in @param accessors, which is indexed by ChunkID and has to have an entry
+ * for each chunk of the table. This way, they can be reused across calls.
+ */
+template <typename T, typename RowIDIterator>
+void access_row_ids(const Table& table, const ColumnID column_id, RowIDIterator row_id_it,
+                    const RowIDIterator row_id_end, std::vector<std::unique_ptr<AbstractSegmentAccessor<T>>>& accessors,
+                    T* values, bool* null_values) {
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+
+  while (row_id_it != row_id_end) {
+    if (row_id_it->is_null()) {
+      *null_values = true;
+      ++values;
+      ++null_values;
+      ++row_id_it;
+      continue;
+    }
+
+    const auto chunk_id = row_id_it->chunk_id;
+    chunk_offsets.clear();
+    for (; row_id_it != row_id_end && row_id_it->chunk_id == chunk_id; ++row_id_it) {
+      chunk_offsets.emplace_back(row_id_it->chunk_offset);
+    }
+
+    auto& accessor = accessors[chunk_id];
+    if (!accessor) {
+      accessor = create_segment_accessor<T>(table.get_chunk(chunk_id)->get_segment(column_id));
+    }
+
+    accessor->access(chunk_offsets.data(), chunk_offsets.size(), values, null_values);
+    values += chunk_offsets.size();
+    null_values += chunk_offsets.size();
+  }
+}
+
 /**
  * A SegmentAccessor is templated per SegmentType and DataType (T).
  * It requires that the underlying segment implements an implicit interface:
  *
  *   const std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
  *
+ * The batched access reads ValueSegments and DictionarySegments directly, all other segments through get_typed_value,
+ * which is not virtual.
  */
 template <typename T, typename SegmentType>
 class SegmentAccessor : public AbstractSegmentAccessor<T> {
@@ -45,10 +91,101 @@ class SegmentAccessor : public AbstractSegmentAccessor<T> {
 
   const std::optional<T> access(ChunkOffset offset) const final { return _segment.get_typed_value(offset); }
 
+  void access(const ChunkOffset* chunk_offsets, const size_t count, T* values, bool* null_values) const final {
+    if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+      const auto& segment_values = _segment.values();
+      for (auto index = size_t{0}; index < count; ++index) {
+        values[index] = segment_values[chunk_offsets[index]];
+      }
+
+      if (_segment.is_nullable()) {
+        const auto& segment_null_values = _segment.null_values();
+        for (auto index = size_t{0}; index < count; ++index) {
+          null_values[index] = segment_null_values[chunk_offsets[index]];
+        }
+      } else {
+        std::fill_n(null_values, count, false);
+      }
+    } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+      // Creating a typed decompressor allocates memory, which does not pay off for a few values
+      if (count < MIN_COUNT_FOR_TYPED_DECOMPRESSION) {
+        _access_typed_values(chunk_offsets, count, values, null_values);
+        return;
+      }
+
+      const auto& dictionary = *_segment.dictionary();
+      const auto null_value_id = _segment.null_value_id();
+      resolve_compressed_vector_type(*_segment.attribute_vector(), [&](const auto& attribute_vector) {
+        const auto decompressor = attribute_vector.create_decompressor();
+        for (auto index = size_t{0}; index < count; ++index) {
+          const auto value_id = decompressor->get(chunk_offsets[index]);
+          null_values[index] = value_id == null_value_id;
+          if (value_id != null_value_id) {
+            values[index] = dictionary[value_id];
+          }
+        }
+      });
+    } else {
+      _access_typed_values(chunk_offsets, count, values, null_values);
+    }
+  }
+
  protected:
+  static constexpr auto MIN_COUNT_FOR_TYPED_DECOMPRESSION = size_t{16};
+
+  void _access_typed_values(const ChunkOffset* chunk_offsets, const size_t count, T* values,
+                            bool* null_values) const {
+    for (auto index = size_t{0}; index < count; ++index) {
+      auto typed_value = _segment.get_typed_value(chunk_offsets[index]);
+      null_values[index] = !typed_value;
+      if (typed_value) {
+        values[index] = std::move(*typed_value);
+      }
+    }
+  }
+
   const SegmentType& _segment;
 };
 
+/**
+ * Accessing a single value of an LZ4Segment requires decompressing the block it resides in. This accessor keeps the
+ * last decompressed block, so that consecutive accesses to the same block (e.g., through a sorted PosList) decompress
+ * it only once. As a consequence, the accessor must not be used by multiple threads concurrently.
+ */
+template <typename T>
+class SegmentAccessor<T, LZ4Segment<T>> : public AbstractSegmentAccessor<T> {
+ public:
+  explicit SegmentAccessor(const LZ4Segment<T>& segment) : AbstractSegmentAccessor<T>{}, _segment{segment} {}
+
+  const std::optional<T> access(ChunkOffset offset) const final {
+    const auto& null_values = _segment.null_values();
+    if (null_values && (*null_values)[offset]) {
+      return std::nullopt;
+    }
+
+    auto [value, block_index] = _segment.decompress(offset, _cached_block_index, _cached_block);  // NOLINT
+    _cached_block_index = block_index;
+    return std::move(value);
+  }
+
+  void access(const ChunkOffset* chunk_offsets, const size_t count, T* values, bool* null_values) const final {
+    const auto& segment_null_values = _segment.null_values();
+    for (auto index = size_t{0}; index < count; ++index) {
+      null_values[index] = segment_null_values && (*segment_null_values)[chunk_offsets[index]];
+      if (null_values[index]) continue;
+
+      auto [value, block_index] = _segment.decompress(chunk_offsets[index], _cached_block_index, _cached_block);
+      values[index] = std::move(value);
+      _cached_block_index = block_index;
+    }
+  }
+
+ protected:
+  const LZ4Segment<T>& _segment;
+  mutable std::vector<char> _cached_block;
+  mutable std::optional<size_t> _cached_block_index;
+};
+
 /**
  * For ReferenceSegments, we don't use the SegmentAccessor but either the MultipleChunkReferenceSegmentAccessor or the.
  * SingleChunkReferenceSegmentAccessor. The first one is generally applicable. However, we will have more overhead,
@@ -67,8 +204,40 @@ class MultipleChunkReferenceSegmentAccessor : public AbstractSegmentAccessor<T>
       return std::nullopt;
     }
 
-    const auto chunk_id = row_id.chunk_id;
+    return _accessor(row_id.chunk_id).access(row_id.chunk_offset);
+  }
+
+  // Consecutive positions that reference the same chunk are retrieved with a single batched access
+  void access(const ChunkOffset* chunk_offsets, const size_t count, T* values, bool* null_values) const final {
+    const auto& pos_list = *_segment.pos_list();
+
+    auto referenced_chunk_offsets = std::vector<ChunkOffset>{};
+    auto index = size_t{0};
+    while (index < count) {
+      const auto& row_id = pos_list[chunk_offsets[index]];
+      if (row_id.is_null()) {
+        null_values[index] = true;
+        ++index;
+        continue;
+      }
 
+      referenced_chunk_offsets.clear();
+      auto run_end = index;
+      // NULL_ROW_ID has an invalid ChunkID and thus ends the run
+      while (run_end < count && pos_list[chunk_offsets[run_end]].chunk_id == row_id.chunk_id) {
+        referenced_chunk_offsets.emplace_back(pos_list[chunk_offsets[run_end]].chunk_offset);
+        ++run_end;
+      }
+
+      _accessor(row_id.chunk_id)
+          .access(referenced_chunk_offsets.data(), referenced_chunk_offsets.size(), values + index,
+                  null_values + index);
+      index = run_end;
+    }
+  }
+
+ protected:
+  const AbstractSegmentAccessor<T>& _accessor(const ChunkID chunk_id) const {
     // Grow the _accessors vector faster than linearly if the chunk_id is out of its current bounds
     if (static_cast<size_t>(chunk_id) >= _accessors.size()) {
       _accessors.resize(static_cast<size_t>(chunk_id + _accessors.size()));
@@ -79,10 +248,9 @@ class MultipleChunkReferenceSegmentAccessor : public AbstractSegmentAccessor<T>
           create_segment_accessor<T>(_table->get_chunk(chunk_id)->get_segment(_segment.referenced_column_id()));
     }
 
-    return _accessors[chunk_id]->access(row_id.chunk_offset);
+    return *_accessors[chunk_id];
   }
 
- protected:
   const ReferenceSegment& _segment;
   const std::shared_ptr<const Table> _table;
   // Serves as a "dictionary" from ChunkID to Accessor. Lazily increased in size as Chunks are accessed.
@@ -109,9 +277,24 @@ class SingleChunkReferenceSegmentAccessor : public AbstractSegmentAccessor<T> {
     return _accessor->access(referenced_chunk_offset);
   }
 
+  void access(const ChunkOffset* chunk_offsets, const size_t count, T* values, bool* null_values) const final {
+    const auto& pos_list = *_segment.pos_list();
+
+    auto referenced_chunk_offsets = std::vector<ChunkOffset>(count);
+    for (auto index = size_t{0}; index < count; ++index) {
+      referenced_chunk_offsets[index] = pos_list[chunk_offsets[index]].chunk_offset;
+    }
+
+    _accessor->access(referenced_chunk_offsets.data(), count, values, null_values);
+  }
+
  protected:
   class NullAccessor : public AbstractSegmentAccessor<T> {
     const std::optional<T> access(ChunkOffset offset) const final { return std::nullopt; }
+
+    void access(const ChunkOffset* chunk_offsets, const size_t count, T* values, bool* null_values) const final {
+      std::fill_n(null_values, count, true);
+    }
   };
 
   const ReferenceSegment& _segment;
@@ -3,6 +3,8 @@
 #include <map>
 #include <memory>
 
+#include "storage/decimal_scaled/decimal_scaled_encoder.hpp"
+#include "storage/delta/delta_encoder.hpp"
 #include "storage/dictionary_segment/dictionary_encoder.hpp"
 #include "storage/frame_of_reference/frame_of_reference_encoder.hpp"
 #include "storage/lz4/lz4_encoder.hpp"
@@ -26,7 +28,9 @@ const auto encoder_for_type = std::map<EncodingType, std::shared_ptr<BaseSegment
     {EncodingType::RunLength, std::make_shared<RunLengthEncoder>()},
     {EncodingType::FixedStringDictionary, std::make_shared<DictionaryEncoder<EncodingType::FixedStringDictionary>>()},
     {EncodingType::FrameOfReference, std::make_shared<FrameOfReferenceEncoder>()},
-    {EncodingType::LZ4, std::make_shared<LZ4Encoder>()}};
+    {EncodingType::LZ4, std::make_shared<LZ4Encoder>()},
+    {EncodingType::Delta, std::make_shared<DeltaEncoder>()},
+    {EncodingType::DecimalScaled, std::make_shared<DecimalScaledEncoder>()}};
 
 }  // namespace
 
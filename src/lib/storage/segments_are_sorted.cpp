@@ -0,0 +1,52 @@
+#include "segments_are_sorted.hpp"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace opossum {
+
+bool segments_are_sorted(const std::vector<std::shared_ptr<const BaseSegment>>& segments, const DataType data_type,
+                         const OrderByMode order_by_mode) {
+  const auto ascending = order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::AscendingNullsLast;
+  const auto nulls_first = order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending;
+
+  auto is_sorted = true;
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto previous_value = std::optional<ColumnDataType>{};
+    auto seen_null = false;
+
+    for (const auto& segment : segments) {
+      // segment_iterate cannot be left early, but the remaining segments are skipped
+      if (!is_sorted) return;
+
+      segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+        if (!is_sorted) return;
+
+        if (position.is_null()) {
+          if (nulls_first && previous_value) is_sorted = false;
+          seen_null = true;
+          return;
+        }
+
+        const auto& value = position.value();
+        if (!nulls_first && seen_null) {
+          is_sorted = false;
+        } else if (previous_value && (ascending ? value < *previous_value : value > *previous_value)) {
+          is_sorted = false;
+        }
+        previous_value = value;
+      });
+    }
+  });
+
+  return is_sorted;
+}
+
+}  // namespace opossum
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+/**
+ * Returns whether the values of the segments, read one after another, are ordered as described by order_by_mode. This
+ * includes the position of NULLs, which come first for OrderByMode::Ascending and OrderByMode::Descending and last
+ * otherwise. Used to verify that data can be marked as ordered_by (see Chunk::ordered_by) or does not need sorting.
+ */
+bool segments_are_sorted(const std::vector<std::shared_ptr<const BaseSegment>>& segments, const DataType data_type,
+                         const OrderByMode order_by_mode);
+
+}  // namespace opossum
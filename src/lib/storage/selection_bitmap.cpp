@@ -0,0 +1,52 @@
+#include "selection_bitmap.hpp"
+
+#include <algorithm>
+
+namespace opossum {
+
+SelectionBitmap::SelectionBitmap(const ChunkOffset size) { resize(size); }
+
+void SelectionBitmap::resize(const ChunkOffset size) {
+  _words.resize((size + BITS_PER_WORD - 1) / BITS_PER_WORD);
+  _size = size;
+
+  // Clear the bits beyond the new size so that they do not reappear when growing the bitmap again
+  if (_size % BITS_PER_WORD != 0) {
+    _words.back() &= (Word{1} << (_size % BITS_PER_WORD)) - 1;
+  }
+}
+
+size_t SelectionBitmap::count() const {
+  auto count = size_t{0};
+  for (const auto word : _words) {
+    count += __builtin_popcountll(word);
+  }
+  return count;
+}
+
+bool SelectionBitmap::empty() const {
+  return std::all_of(_words.cbegin(), _words.cend(), [](const auto word) { return word == 0; });
+}
+
+SelectionBitmap& SelectionBitmap::operator|=(const SelectionBitmap& other) {
+  DebugAssert(_size == other._size, "SelectionBitmaps need to have the same size");
+  for (auto word_idx = size_t{0}; word_idx < _words.size(); ++word_idx) {
+    _words[word_idx] |= other._words[word_idx];
+  }
+  return *this;
+}
+
+SelectionBitmap& SelectionBitmap::operator&=(const SelectionBitmap& other) {
+  DebugAssert(_size == other._size, "SelectionBitmaps need to have the same size");
+  for (auto word_idx = size_t{0}; word_idx < _words.size(); ++word_idx) {
+    _words[word_idx] &= other._words[word_idx];
+  }
+  return *this;
+}
+
+void SelectionBitmap::append_to_pos_list(const ChunkID chunk_id, PosList& pos_list) const {
+  pos_list.reserve(pos_list.size() + count());
+  for_each_set_bit([&](const auto chunk_offset) { pos_list.emplace_back(RowID{chunk_id, chunk_offset}); });
+}
+
+}  // namespace opossum
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Represents a set of rows within a single chunk as one bit per ChunkOffset
+ *
+ * For selective predicates, PosLists are the more compact representation of intermediate results. For predicates
+ * that select a large share of a chunk, a bitmap needs only one bit instead of the eight bytes of a RowID per row.
+ * More importantly, union and intersection of two sets of rows become word-wise OR and AND operations and the rows
+ * come out in ascending order without having to sort them.
+ *
+ * The bitmap is used by UnionPositions to merge the positions of both inputs.
+ */
+class SelectionBitmap {
+ public:
+  SelectionBitmap() = default;
+  explicit SelectionBitmap(const ChunkOffset size);
+
+  // Number of rows (i.e., bits) represented by the bitmap, not the number of selected rows
+  ChunkOffset size() const { return _size; }
+  void resize(const ChunkOffset size);
+
+  void set(const ChunkOffset chunk_offset) {
+    DebugAssert(chunk_offset < _size, "ChunkOffset out of range");
+    _words[chunk_offset / BITS_PER_WORD] |= Word{1} << (chunk_offset % BITS_PER_WORD);
+  }
+
+  bool is_set(const ChunkOffset chunk_offset) const {
+    DebugAssert(chunk_offset < _size, "ChunkOffset out of range");
+    return (_words[chunk_offset / BITS_PER_WORD] >> (chunk_offset % BITS_PER_WORD)) & Word{1};
+  }
+
+  // Number of selected rows
+  size_t count() const;
+
+  bool empty() const;
+
+  // Set operations on two bitmaps of the same size
+  SelectionBitmap& operator|=(const SelectionBitmap& other);
+  SelectionBitmap& operator&=(const SelectionBitmap& other);
+
+  // Calls `functor(chunk_offset)` for each selected row in ascending order
+  template <typename Functor>
+  void for_each_set_bit(const Functor& functor) const {
+    for (auto word_idx = size_t{0}; word_idx < _words.size(); ++word_idx) {
+      auto word = _words[word_idx];
+      while (word) {
+        const auto bit_idx = static_cast<ChunkOffset>(__builtin_ctzll(word));
+        functor(static_cast<ChunkOffset>(word_idx * BITS_PER_WORD + bit_idx));
+        word &= word - 1;  // clear the lowest set bit
+      }
+    }
+  }
+
+  // Appends RowID{chunk_id, chunk_offset} for each selected row to `pos_list`
+  void append_to_pos_list(const ChunkID chunk_id, PosList& pos_list) const;
+
+ private:
+  using Word = uint64_t;
+  static constexpr auto BITS_PER_WORD = ChunkOffset{sizeof(Word) * 8};
+
+  std::vector<Word> _words;
+  ChunkOffset _size{0};
+};
+
+}  // namespace opossum
@@ -105,6 +105,8 @@ void Table::append_mutable_chunk() {
     });
   }
   append_chunk(segments);
+
+  if (_use_mvcc == UseMvcc::Yes) _chunks.back()->create_zone_maps();
 }
 
 uint64_t Table::row_count() const {
@@ -196,6 +198,21 @@ std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_
 
 std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
 
+void Table::set_finalization_encoding_spec(const std::optional<SegmentEncodingSpec>& encoding_spec) {
+  _finalization_encoding_spec = encoding_spec;
+}
+
+const std::optional<SegmentEncodingSpec>& Table::finalization_encoding_spec() const {
+  return _finalization_encoding_spec;
+}
+
+void Table::set_clustering_column(const std::optional<std::pair<ColumnID, OrderByMode>>& clustering_column) {
+  Assert(!clustering_column || clustering_column->first < column_count(), "Clustering column does not exist");
+  _clustering_column = clustering_column;
+}
+
+const std::optional<std::pair<ColumnID, OrderByMode>>& Table::clustering_column() const { return _clustering_column; }
+
 size_t Table::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
 
@@ -8,6 +8,7 @@
 
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/index/index_info.hpp"
 #include "storage/table_column_definition.hpp"
 #include "type_cast.hpp"
@@ -106,7 +107,8 @@ class Table : private Noncopyable {
    */
   void append_chunk(const std::shared_ptr<Chunk>& chunk);
 
-  // Create and append a Chunk consisting of ValueSegments.
+  // Create and append a Chunk consisting of ValueSegments. For tables with MVCC, i.e., tables that can be modified by
+  // Inserts, the chunk maintains zone maps so that the ChunkPruningRule can prune it while it is mutable.
   void append_mutable_chunk();
 
   /** @} */
@@ -163,6 +165,27 @@ class Table : private Noncopyable {
     _indexes.emplace_back(i);
   }
 
+  /**
+   * Once a chunk of an MVCC table is full and none of the inserts into it is pending anymore, the Insert operator marks
+   * it immutable and schedules a ChunkFinalizationTask. That task encodes the chunk using this spec (which also
+   * generates its ChunkStatistics) and builds the indexes of the table (see create_index()) for it. With an active
+   * scheduler, this happens in the background and does not block inserts into the table's new mutable chunk.
+   * Use EncodingType::Unencoded to only generate statistics and indexes. By default (std::nullopt), full chunks are
+   * kept mutable and are not finalized.
+   */
+  void set_finalization_encoding_spec(const std::optional<SegmentEncodingSpec>& encoding_spec);
+  const std::optional<SegmentEncodingSpec>& finalization_encoding_spec() const;
+
+  /**
+   * The clustering column of a table determines the physical order of its rows: Each Insert sorts the rows it inserts
+   * by this column. Chunks whose rows end up sorted (e.g., because they were filled by a single Insert) are marked as
+   * ordered_by the column once they are finalized, so that scans on the column can use binary search and Sort,
+   * AggregateSort, and JoinSortMerge can skip sorting them. Rows are never moved after they were inserted, as readers
+   * and the MVCC data refer to them by their position.
+   */
+  void set_clustering_column(const std::optional<std::pair<ColumnID, OrderByMode>>& clustering_column);
+  const std::optional<std::pair<ColumnID, OrderByMode>>& clustering_column() const;
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
@@ -177,5 +200,7 @@ class Table : private Noncopyable {
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexInfo> _indexes;
+  std::optional<SegmentEncodingSpec> _finalization_encoding_spec;
+  std::optional<std::pair<ColumnID, OrderByMode>> _clustering_column;
 };
 }  // namespace opossum
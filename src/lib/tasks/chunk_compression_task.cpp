@@ -19,6 +19,10 @@ ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const
 ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
     : _table_name{table_name}, _chunk_ids{chunk_ids} {}
 
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name,
+                                           const std::map<ChunkID, ChunkEncodingSpec>& chunk_encoding_specs)
+    : _table_name{table_name}, _chunk_encoding_specs{chunk_encoding_specs} {}
+
 void ChunkCompressionTask::_on_execute() {
   auto table = StorageManager::get().get_table(_table_name);
 
@@ -34,9 +38,22 @@ void ChunkCompressionTask::_on_execute() {
 
     ChunkEncoder::encode_chunk(chunk, table->column_data_types());
   }
+
+  for (const auto& [chunk_id, chunk_encoding_spec] : _chunk_encoding_specs) {
+    Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
+
+    auto chunk = table->get_chunk(chunk_id);
+
+    DebugAssert(_chunk_is_completed(chunk, table->max_chunk_size()),
+                "Chunk is not completed and thus can’t be compressed.");
+
+    ChunkEncoder::encode_chunk(chunk, table->column_data_types(), chunk_encoding_spec);
+  }
 }
 
 bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size) {
+  // Immutable chunks (e.g., the last chunk of a table that was encoded as a whole) do not get new rows
+  if (!chunk->is_mutable()) return true;
   if (chunk->size() != max_chunk_size) return false;
 
   auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
@@ -1,16 +1,18 @@
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace opossum {
 
 class Chunk;
 
 /**
- * @brief Compresses a chunk of a table using the default encoding
+ * @brief Compresses a chunk of a table using the default encoding or the given encoding specs
  *
  * The task compresses a chunk by sequentially compressing segments.
  * From each value segment, a dictionary segment is created that replaces the
@@ -27,6 +29,9 @@ class Chunk;
  * full and all of their end-cids must be smaller than infinity. This task calls
  * those chunks “completed”.
  *
+ * Chunks that are already encoded are re-encoded, e.g., with the encodings recommended by the
+ * EncodingAdvisor. Immutable chunks are completed as well.
+ *
  * Note: Reference segments are not invalidated by this task because the order in which
  *       records are stored does not change.
  */
@@ -34,6 +39,7 @@ class ChunkCompressionTask : public AbstractTask {
  public:
   explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
   explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
+  ChunkCompressionTask(const std::string& table_name, const std::map<ChunkID, ChunkEncodingSpec>& chunk_encoding_specs);
 
  protected:
   void _on_execute() override;
@@ -49,5 +55,6 @@ class ChunkCompressionTask : public AbstractTask {
  private:
   const std::string _table_name;
   const std::vector<ChunkID> _chunk_ids;
+  const std::map<ChunkID, ChunkEncodingSpec> _chunk_encoding_specs;
 };
 }  // namespace opossum
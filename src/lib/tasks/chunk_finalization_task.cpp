@@ -0,0 +1,75 @@
+#include "chunk_finalization_task.hpp"
+
+#include <memory>
+
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/segments_are_sorted.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ChunkFinalizationTask::ChunkFinalizationTask(const std::shared_ptr<Table>& table, const ChunkID chunk_id)
+    : _table{table}, _chunk_id{chunk_id} {}
+
+bool ChunkFinalizationTask::chunk_is_complete(const Chunk& chunk, const uint32_t max_chunk_size) {
+  if (chunk.size() != max_chunk_size) return false;
+
+  const auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+
+  for (const auto begin_cid : mvcc_data->begin_cids) {
+    if (begin_cid == MvccData::MAX_COMMIT_ID) return false;
+  }
+
+  return true;
+}
+
+void ChunkFinalizationTask::_on_execute() {
+  Assert(_chunk_id < _table->chunk_count(), "Chunk with given ID does not exist.");
+
+  const auto chunk = _table->get_chunk(_chunk_id);
+  DebugAssert(!chunk->is_mutable(), "Chunk needs to be marked immutable before it is finalized.");
+
+  // Validate, Delete, and Update might access the MVCC data concurrently, so it must not be reallocated
+  const auto& encoding_spec = _table->finalization_encoding_spec();
+  ChunkEncoder::encode_chunk(chunk, _table->column_data_types(), encoding_spec.value_or(EncodingType::Unencoded),
+                             ShrinkMvccData::No);
+
+  // Inserts sort their rows by the clustering column, but concurrent Inserts into the same chunk interleave. Thus, the
+  // chunk is only marked as sorted if all of its rows turned out to be in order.
+  const auto& clustering_column = _table->clustering_column();
+  if (clustering_column) {
+    const auto [column_id, order_by_mode] = *clustering_column;
+    if (segments_are_sorted({chunk->get_segment(column_id)}, _table->column_data_type(column_id), order_by_mode)) {
+      chunk->set_ordered_by(*clustering_column);
+    }
+  }
+
+  for (const auto& index_info : _table->get_indexes()) {
+    if (chunk->get_index(index_info.type, index_info.column_ids)) continue;
+
+    switch (index_info.type) {
+      case SegmentIndexType::GroupKey:
+        chunk->create_index<GroupKeyIndex>(index_info.column_ids);
+        break;
+      case SegmentIndexType::CompositeGroupKey:
+        chunk->create_index<CompositeGroupKeyIndex>(index_info.column_ids);
+        break;
+      case SegmentIndexType::AdaptiveRadixTree:
+        chunk->create_index<AdaptiveRadixTreeIndex>(index_info.column_ids);
+        break;
+      case SegmentIndexType::BTree:
+        chunk->create_index<BTreeIndex>(index_info.column_ids);
+        break;
+      case SegmentIndexType::Invalid:
+        Fail("Cannot create an index of an invalid type.");
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+
+#include "scheduler/abstract_task.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+/**
+ * @brief Finalizes a full chunk of a table after the last insert into it has completed
+ *
+ * The chunk is encoded using the table's finalization_encoding_spec(), which also generates the chunk's statistics,
+ * and the indexes of the table are built for the encoded segments. If the table has a clustering column and the chunk
+ * turns out to be sorted by it, the chunk is marked as ordered_by that column. The Insert operator marks the chunk
+ * immutable before scheduling this task, so that it can be finalized in the background while new rows go to the next
+ * chunk.
+ *
+ * As in the ChunkCompressionTask, segments are replaced atomically and readers that still hold the previous
+ * ValueSegments can continue to use them.
+ */
+class ChunkFinalizationTask : public AbstractTask {
+ public:
+  ChunkFinalizationTask(const std::shared_ptr<Table>& table, const ChunkID chunk_id);
+
+  /**
+   * A chunk is complete if it is full and none of its rows is still being inserted, i.e., all of its begin-cids are
+   * smaller than infinity (rolled back inserts set them to 0).
+   */
+  static bool chunk_is_complete(const Chunk& chunk, const uint32_t max_chunk_size);
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  const std::shared_ptr<Table> _table;
+  const ChunkID _chunk_id;
+};
+
+}  // namespace opossum
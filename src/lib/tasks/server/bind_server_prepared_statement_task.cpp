@@ -5,7 +5,9 @@
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "optimizer/optimizer.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "sql/parameterized_plan_cache.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "storage/prepared_plan.hpp"
 
@@ -15,6 +17,28 @@ void BindServerPreparedStatementTask::_on_execute() {
   try {
     Assert(_params.size() == _prepared_plan->parameter_ids.size(), "Prepared statement parameter count mismatch");
 
+    // If possible, the prepared plan is optimized and translated only once for all executions, independent of the
+    // values of the parameters
+    if (const auto parameterized_lqp = parameterize_prepared_plan(*_prepared_plan, _params)) {
+      const auto cache_key = ParameterizedPlanCacheKey{parameterized_lqp->lqp};
+
+      auto generic_plan = std::shared_ptr<AbstractOperator>{};
+      if (const auto cached_generic_plan = SQLParameterizedPlanCache::get().try_get(cache_key)) {
+        generic_plan = *cached_generic_plan;
+      } else {
+        // The optimizer modifies the LQP it is given, but the cache key needs to stay intact
+        const auto optimized_lqp = Optimizer::create_default_optimizer()->optimize(parameterized_lqp->lqp->deep_copy());
+        generic_plan = LQPTranslator{}.translate_node(optimized_lqp);
+        SQLParameterizedPlanCache::get().set(cache_key, generic_plan);
+      }
+
+      const auto pqp = generic_plan->deep_copy();
+      pqp->set_parameters(parameterized_lqp->parameters);
+
+      _promise.set_value(pqp);
+      return;
+    }
+
     auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{_params.size()};
     for (auto parameter_idx = size_t{0}; parameter_idx < _params.size(); ++parameter_idx) {
       parameter_expressions[parameter_idx] = std::make_shared<ValueExpression>(_params[parameter_idx]);
@@ -3,6 +3,7 @@
 #include <boost/thread/future.hpp>
 
 #include "abstract_server_task.hpp"
+#include "types.hpp"
 
 namespace opossum {
 
@@ -18,8 +19,9 @@ struct CreatePipelineResult {
 // load on the main server thread to a miminum.
 class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipelineResult>> {
  public:
-  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false)
-      : _sql(sql), _allow_load_table(allow_load_table) {}
+  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false,
+                              ParameterizeLiterals parameterize_literals = ParameterizeLiterals::No)
+      : _sql(sql), _allow_load_table(allow_load_table), _parameterize_literals(parameterize_literals) {}
 
  protected:
   void _on_execute() override;
@@ -32,6 +34,9 @@ class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipel
   const std::string _sql;
   const bool _allow_load_table;
 
+  // See SQLPipelineBuilder::with_parameterized_literals()
+  const ParameterizeLiterals _parameterize_literals;
+
   std::string _file_name;
   std::string _table_name;
 };
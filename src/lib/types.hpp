@@ -221,6 +221,10 @@ enum class UseMvcc : bool { Yes = true, No = false };
 
 enum class CleanupTemporaries : bool { Yes = true, No = false };
 
+enum class ParameterizeLiterals : bool { Yes = true, No = false };
+
+enum class ExplainAnalyze : bool { Yes = true, No = false };
+
 // Used as a template parameter that is passed whenever we conditionally erase the type of a template. This is done to
 // reduce the compile time at the cost of the runtime performance. Examples are iterators, which are replaced by
 // AnySegmentIterators that use virtual method calls.
@@ -0,0 +1,185 @@
+#include "meta_table_manager.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include "constant_mappings.hpp"
+#include "operators/abstract_operator.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/task_queue.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MetaTableManager::MetaTableManager() {
+  _meta_tables["meta_tables"] = {{{"table_name", DataType::String},
+                                  {"column_count", DataType::Int},
+                                  {"row_count", DataType::Long},
+                                  {"chunk_count", DataType::Int},
+                                  {"max_chunk_size", DataType::Int},
+                                  {"estimated_size_in_bytes", DataType::Long}},
+                                 _fill_tables_table};
+
+  _meta_tables["meta_chunks"] = {{{"table_name", DataType::String},
+                                  {"chunk_id", DataType::Int},
+                                  {"row_count", DataType::Long},
+                                  {"invalid_row_count", DataType::Long},
+                                  {"is_mutable", DataType::Int},
+                                  {"estimated_size_in_bytes", DataType::Long}},
+                                 _fill_chunks_table};
+
+  _meta_tables["meta_segments"] = {{{"table_name", DataType::String},
+                                    {"chunk_id", DataType::Int},
+                                    {"column_id", DataType::Int},
+                                    {"column_name", DataType::String},
+                                    {"column_data_type", DataType::String},
+                                    {"encoding_type", DataType::String},
+                                    {"compressed_vector_type", DataType::String, true},
+                                    {"estimated_size_in_bytes", DataType::Long}},
+                                   _fill_segments_table};
+
+  _meta_tables["meta_indexes"] = {{{"table_name", DataType::String},
+                                   {"chunk_id", DataType::Int},
+                                   {"column_names", DataType::String},
+                                   {"index_type", DataType::String},
+                                   {"memory_consumption", DataType::Long}},
+                                  _fill_indexes_table};
+
+  _meta_tables["meta_plan_cache"] = {{{"query_string", DataType::String}, {"root_operator", DataType::String}},
+                                     _fill_plan_cache_table};
+
+  _meta_tables["meta_workers"] = {{{"worker_id", DataType::Int},
+                                   {"node_id", DataType::Int},
+                                   {"cpu_id", DataType::Int},
+                                   {"finished_task_count", DataType::Long}},
+                                  _fill_workers_table};
+
+  for (const auto& [name, meta_table] : _meta_tables) {
+    Assert(is_meta_table_name(name), "Names of meta tables need to start with meta_");
+    _table_names.emplace_back(name);
+  }
+}
+
+bool MetaTableManager::is_meta_table_name(const std::string& name) { return boost::starts_with(name, "meta_"); }
+
+const std::vector<std::string>& MetaTableManager::table_names() const { return _table_names; }
+
+bool MetaTableManager::has_table(const std::string& name) const { return _meta_tables.count(name); }
+
+const TableColumnDefinitions& MetaTableManager::column_definitions(const std::string& name) const {
+  const auto meta_table_iter = _meta_tables.find(name);
+  Assert(meta_table_iter != _meta_tables.end(), "No such meta table: " + name);
+  return meta_table_iter->second.column_definitions;
+}
+
+std::shared_ptr<Table> MetaTableManager::generate_table(const std::string& name) const {
+  const auto meta_table_iter = _meta_tables.find(name);
+  Assert(meta_table_iter != _meta_tables.end(), "No such meta table: " + name);
+
+  const auto& meta_table = meta_table_iter->second;
+  auto table = std::make_shared<Table>(meta_table.column_definitions, TableType::Data);
+  meta_table.fill_table(*table);
+  return table;
+}
+
+void MetaTableManager::_fill_tables_table(Table& table) {
+  for (const auto& [table_name, stored_table] : StorageManager::get().tables()) {
+    table.append({pmr_string{table_name}, static_cast<int32_t>(stored_table->column_count()),
+                  static_cast<int64_t>(stored_table->row_count()), static_cast<int32_t>(stored_table->chunk_count()),
+                  static_cast<int32_t>(stored_table->max_chunk_size()),
+                  static_cast<int64_t>(stored_table->estimate_memory_usage())});
+  }
+}
+
+void MetaTableManager::_fill_chunks_table(Table& table) {
+  for (const auto& [table_name, stored_table] : StorageManager::get().tables()) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < stored_table->chunk_count(); ++chunk_id) {
+      const auto chunk = stored_table->get_chunk(chunk_id);
+      table.append({pmr_string{table_name}, static_cast<int32_t>(chunk_id), static_cast<int64_t>(chunk->size()),
+                    static_cast<int64_t>(chunk->invalid_row_count()), static_cast<int32_t>(chunk->is_mutable()),
+                    static_cast<int64_t>(chunk->estimate_memory_usage())});
+    }
+  }
+}
+
+void MetaTableManager::_fill_segments_table(Table& table) {
+  for (const auto& [table_name, stored_table] : StorageManager::get().tables()) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < stored_table->chunk_count(); ++chunk_id) {
+      const auto chunk = stored_table->get_chunk(chunk_id);
+
+      for (auto column_id = ColumnID{0}; column_id < stored_table->column_count(); ++column_id) {
+        const auto segment = chunk->get_segment(column_id);
+
+        auto encoding_type = EncodingType::Unencoded;
+        auto compressed_vector_type = AllTypeVariant{NULL_VALUE};
+        if (const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(segment)) {
+          encoding_type = encoded_segment->encoding_type();
+          if (encoded_segment->compressed_vector_type()) {
+            compressed_vector_type =
+                pmr_string{compressed_vector_type_to_string.left.at(*encoded_segment->compressed_vector_type())};
+          }
+        }
+
+        table.append({pmr_string{table_name}, static_cast<int32_t>(chunk_id), static_cast<int32_t>(column_id),
+                      pmr_string{stored_table->column_name(column_id)},
+                      pmr_string{data_type_to_string.left.at(stored_table->column_data_type(column_id))},
+                      pmr_string{encoding_type_to_string.left.at(encoding_type)}, compressed_vector_type,
+                      static_cast<int64_t>(segment->estimate_memory_usage())});
+      }
+    }
+  }
+}
+
+void MetaTableManager::_fill_indexes_table(Table& table) {
+  for (const auto& [table_name, stored_table] : StorageManager::get().tables()) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < stored_table->chunk_count(); ++chunk_id) {
+      const auto chunk = stored_table->get_chunk(chunk_id);
+
+      // Each index is returned for the first of its indexed columns only
+      for (auto first_column_id = ColumnID{0}; first_column_id < chunk->column_count(); ++first_column_id) {
+        for (const auto& index : chunk->get_indices(std::vector<ColumnID>{first_column_id})) {
+          // Indexes store their segments, so we find the indexed columns by comparing the segments
+          auto column_names = std::string{};
+          for (const auto& indexed_segment : index->get_indexed_segments()) {
+            for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+              if (chunk->get_segment(column_id) != indexed_segment) continue;
+              if (!column_names.empty()) column_names += ", ";
+              column_names += stored_table->column_name(column_id);
+            }
+          }
+
+          table.append({pmr_string{table_name}, static_cast<int32_t>(chunk_id), pmr_string{column_names},
+                        pmr_string{segment_index_type_to_string.left.at(index->type())},
+                        static_cast<int64_t>(index->memory_consumption())});
+        }
+      }
+    }
+  }
+}
+
+void MetaTableManager::_fill_plan_cache_table(Table& table) {
+  for (const auto& [query_string, physical_plan] : SQLPhysicalPlanCache::get().snapshot()) {
+    table.append({pmr_string{query_string}, pmr_string{physical_plan->description(DescriptionMode::SingleLine)}});
+  }
+}
+
+void MetaTableManager::_fill_workers_table(Table& table) {
+  const auto node_queue_scheduler = std::dynamic_pointer_cast<NodeQueueScheduler>(CurrentScheduler::get());
+  if (!node_queue_scheduler) return;
+
+  for (const auto& worker : node_queue_scheduler->workers()) {
+    table.append({static_cast<int32_t>(worker->id()), static_cast<int32_t>(worker->queue()->node_id()),
+                  static_cast<int32_t>(worker->cpu_id()), static_cast<int64_t>(worker->num_finished_tasks())});
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/table_column_definition.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * The MetaTableManager provides virtual tables that describe the state of the engine, e.g., the chunks and segments of
+ * all tables with their encodings and memory usage, or the contents of the plan cache. They can be queried through SQL
+ * like any other table (e.g., `SELECT * FROM meta_segments WHERE table_name = 'lineitem'`).
+ *
+ * Meta tables are not stored. Instead, the GetMetaTable operator generates them whenever it is executed, so cached
+ * plans do not return outdated information. All meta tables are data tables without MVCC data.
+ *
+ *  meta_tables        One row per table: size, chunk count, and estimated memory usage
+ *  meta_chunks        One row per chunk: size, invalidated rows, mutability, and estimated memory usage
+ *  meta_segments      One row per segment: data type, encoding, compressed vector type, and estimated memory usage
+ *  meta_indexes       One row per index: type, indexed columns, and memory consumption
+ *  meta_plan_cache    One row per entry of the SQLPhysicalPlanCache: the SQL string and the root operator of the plan
+ *  meta_workers       One row per worker of the NodeQueueScheduler (empty if there is none): node, CPU, finished tasks
+ */
+class MetaTableManager : public Singleton<MetaTableManager> {
+ public:
+  static bool is_meta_table_name(const std::string& name);
+
+  const std::vector<std::string>& table_names() const;
+  bool has_table(const std::string& name) const;
+
+  const TableColumnDefinitions& column_definitions(const std::string& name) const;
+
+  // Creates the meta table, reflecting the current state
+  std::shared_ptr<Table> generate_table(const std::string& name) const;
+
+ protected:
+  MetaTableManager();
+
+  friend class Singleton;
+
+  struct MetaTable {
+    TableColumnDefinitions column_definitions;
+    std::function<void(Table&)> fill_table;
+  };
+
+  static void _fill_tables_table(Table& table);
+  static void _fill_chunks_table(Table& table);
+  static void _fill_segments_table(Table& table);
+  static void _fill_indexes_table(Table& table);
+  static void _fill_plan_cache_table(Table& table);
+  static void _fill_workers_table(Table& table);
+
+  std::map<std::string, MetaTable> _meta_tables;
+  std::vector<std::string> _table_names;
+};
+
+}  // namespace opossum
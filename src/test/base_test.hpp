@@ -11,7 +11,9 @@
 #include "gtest/gtest.h"
 #include "operators/abstract_operator.hpp"
 #include "operators/table_scan.hpp"
+#include "scheduler/admission_controller.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "sql/parameterized_plan_cache.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/dictionary_segment.hpp"
@@ -69,9 +71,11 @@ class BaseTestWithParam
     PluginManager::reset();
     StorageManager::reset();
     TransactionManager::reset();
+    AdmissionController::get().set_memory_limit(std::nullopt);
 
     SQLPhysicalPlanCache::get().clear();
     SQLLogicalPlanCache::get().clear();
+    SQLParameterizedPlanCache::get().clear();
   }
 
   static std::shared_ptr<AbstractExpression> get_column_expression(const std::shared_ptr<AbstractOperator>& op,
@@ -1,3 +1,6 @@
+#include <thread>
+#include <vector>
+
 #include "base_test.hpp"
 
 #include "cache/cache.hpp"
@@ -6,6 +9,7 @@
 #include "cache/lru_cache.hpp"
 #include "cache/lru_k_cache.hpp"
 #include "cache/random_cache.hpp"
+#include "cache/sharded_cache.hpp"
 
 namespace opossum {
 
@@ -231,6 +235,69 @@ TEST(CachePolicyTest, RandomCacheTest) {
   ASSERT_EQ(53, cache.get(6));  // Hit.
 }
 
+// Sharded cache with CLOCK eviction and TinyLFU admission
+TEST(CachePolicyTest, ShardedCacheTest) {
+  ShardedCache<int, int> cache(2);
+
+  ASSERT_EQ(cache.try_get(1), std::nullopt);  // Miss, Fr(1)=1
+  cache.set(1, 2);                            // Insert
+  ASSERT_EQ(cache.try_get(1), 2);             // Hit, Fr(1)=2
+  ASSERT_EQ(cache.try_get(2), std::nullopt);  // Miss, Fr(2)=1
+  cache.set(2, 4);                            // Insert
+
+  // The cache is full. 3 was not requested more often than the eviction candidate, so it is not admitted.
+  ASSERT_EQ(cache.try_get(3), std::nullopt);  // Miss, Fr(3)=1
+  cache.set(3, 6);                            // Reject
+  ASSERT_FALSE(cache.has(3));
+
+  ASSERT_EQ(cache.try_get(1), 2);             // Hit, Fr(1)=3
+  ASSERT_EQ(cache.try_get(3), std::nullopt);  // Miss, Fr(3)=2
+  ASSERT_EQ(cache.try_get(3), std::nullopt);  // Miss, Fr(3)=3
+  cache.set(3, 6);                            // Evict 2 (1 was referenced, Fr(2)=1 < Fr(3)=3)
+  ASSERT_TRUE(cache.has(1));
+  ASSERT_FALSE(cache.has(2));
+  ASSERT_TRUE(cache.has(3));
+
+  cache.set(3, 7);  // Update
+  ASSERT_EQ(cache.try_get(3), 7);
+
+  const auto statistics = cache.statistics();
+  ASSERT_EQ(statistics.hit_count, 3u);
+  ASSERT_EQ(statistics.miss_count, 5u);
+  ASSERT_EQ(statistics.eviction_count, 1u);
+  ASSERT_EQ(statistics.rejection_count, 1u);
+}
+
+TEST(CachePolicyTest, ShardedCacheConcurrentAccess) {
+  constexpr auto THREAD_COUNT = 8;
+  constexpr auto KEY_COUNT = 4'000;
+
+  Cache<int, int, ShardedCache> cache(1'024);
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto access_id = 0; access_id < 20'000; ++access_id) {
+        const auto key = (access_id * 7 + thread_id) % KEY_COUNT;
+        if (const auto value = cache.try_get(key)) {
+          ASSERT_EQ(*value, key * 2);
+        } else {
+          cache.set(key, key * 2);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Each shard holds up to capacity / shard count entries
+  EXPECT_LE(cache.size(), 1'024u);
+
+  const auto statistics = static_cast<const ShardedCache<int, int>&>(cache.cache()).statistics();
+  EXPECT_EQ(statistics.hit_count + statistics.miss_count, size_t{THREAD_COUNT * 20'000});
+}
+
 // Test the default cache (uses GDFS).
 TEST(CachePolicyTest, Iterators) {
   Cache<int, int> cache(2);
@@ -258,7 +325,7 @@ class CacheTest : public BaseTest {};
 
 // Here, all cache types are defined.
 using CacheTypes = ::testing::Types<LRUCache<int, int>, LRUKCache<2, int, int>, GDSCache<int, int>, GDFSCache<int, int>,
-                                    RandomCache<int, int>>;
+                                    RandomCache<int, int>, ShardedCache<int, int>>;
 TYPED_TEST_CASE(CacheTest, CacheTypes, );  // NOLINT(whitespace/parens)
 
 TYPED_TEST(CacheTest, Size) {
@@ -0,0 +1,85 @@
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/evaluation/correlated_subquery_result_cache.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CorrelatedSubqueryResultCacheTest : public BaseTest {
+ public:
+  void SetUp() override {
+    table_a = load_table("resources/test_data/tbl/expression_evaluator/input_a.tbl", 4);
+    table_b = load_table("resources/test_data/tbl/expression_evaluator/input_b.tbl", 4);
+    pqp_a = std::make_shared<TableWrapper>(table_a);
+    pqp_b = std::make_shared<TableWrapper>(table_b);
+  }
+
+  std::shared_ptr<Table> table_a, table_b;
+  std::shared_ptr<AbstractOperator> pqp_a, pqp_b;
+};
+
+TEST_F(CorrelatedSubqueryResultCacheTest, GetAndSet) {
+  auto cache = CorrelatedSubqueryResultCache{};
+
+  EXPECT_EQ(cache.get(pqp_a, {AllTypeVariant{1}}), nullptr);
+
+  cache.set(pqp_a, {AllTypeVariant{1}}, table_a);
+  cache.set(pqp_a, {AllTypeVariant{2}, AllTypeVariant{"a"}}, table_b);
+
+  EXPECT_EQ(cache.get(pqp_a, {AllTypeVariant{1}}), table_a);
+  EXPECT_EQ(cache.get(pqp_a, {AllTypeVariant{2}, AllTypeVariant{"a"}}), table_b);
+  EXPECT_EQ(cache.get(pqp_a, {AllTypeVariant{2}, AllTypeVariant{"b"}}), nullptr);
+  EXPECT_EQ(cache.get(pqp_a, {AllTypeVariant{int64_t{1}}}), nullptr);
+  EXPECT_EQ(cache.get(pqp_b, {AllTypeVariant{1}}), nullptr);
+
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_EQ(cache.hit_count(), 2u);
+  EXPECT_EQ(cache.miss_count(), 4u);
+}
+
+TEST_F(CorrelatedSubqueryResultCacheTest, NullParametersAreEqual) {
+  auto cache = CorrelatedSubqueryResultCache{};
+
+  cache.set(pqp_a, {NULL_VALUE, AllTypeVariant{3}}, table_a);
+  EXPECT_EQ(cache.get(pqp_a, {NULL_VALUE, AllTypeVariant{3}}), table_a);
+  EXPECT_EQ(cache.get(pqp_a, {NULL_VALUE, NULL_VALUE}), nullptr);
+}
+
+TEST_F(CorrelatedSubqueryResultCacheTest, MemoryBudget) {
+  auto cache = CorrelatedSubqueryResultCache{table_a->estimate_memory_usage()};
+
+  cache.set(pqp_a, {AllTypeVariant{1}}, table_a);
+  cache.set(pqp_a, {AllTypeVariant{2}}, table_a);
+
+  EXPECT_EQ(cache.get(pqp_a, {AllTypeVariant{1}}), table_a);
+  EXPECT_EQ(cache.get(pqp_a, {AllTypeVariant{2}}), nullptr);
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_EQ(cache.memory_usage(), table_a->estimate_memory_usage());
+}
+
+TEST_F(CorrelatedSubqueryResultCacheTest, ExpressionEvaluatorReusesResults) {
+  // Chunk 0 of table_b contains the values 10, 9, 10, 8 - the subquery is only executed for the three distinct ones
+  const auto x = PQPColumnExpression::from_table(*table_b, "x");
+  const auto d = PQPColumnExpression::from_table(*table_a, "d");
+  const auto table_scan = std::make_shared<TableScan>(pqp_a, equals_(d, correlated_parameter_(ParameterID{0}, x)));
+  const auto subquery = pqp_subquery_(table_scan, DataType::Int, false, std::make_pair(ParameterID{0}, ColumnID{0}));
+
+  const auto cache = std::make_shared<CorrelatedSubqueryResultCache>();
+  const auto pos_list =
+      ExpressionEvaluator{table_b, ChunkID{0}, {}, cache}.evaluate_expression_to_pos_list(*not_exists_(subquery));
+
+  EXPECT_EQ(pos_list.size(), 4u);
+  EXPECT_EQ(cache->size(), 3u);
+  EXPECT_EQ(cache->hit_count(), 1u);
+  EXPECT_EQ(cache->miss_count(), 3u);
+}
+
+}  // namespace opossum
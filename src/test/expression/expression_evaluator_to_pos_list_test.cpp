@@ -136,6 +136,19 @@ TEST_F(ExpressionEvaluatorToPosListTest, LogicalWithNulls) {
   EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *or_(is_null_(c), equals_(c, 33)), {0, 1, 3}));
 }
 
+TEST_F(ExpressionEvaluatorToPosListTest, LogicalNested) {
+  // The inner expressions are evaluated on the selection passed down by the outer ones
+  // clang-format off
+  EXPECT_TRUE(test_expression(table_b, ChunkID{0}, *and_(or_(equals_(x, 10), equals_(x, 8)), not_equals_(x, 8)), {0, 2}));  // NOLINT
+  EXPECT_TRUE(test_expression(table_b, ChunkID{0}, *or_(and_(equals_(x, 10), less_than_(x, 10)), or_(equals_(x, 9), equals_(x, 8))), {1, 3}));  // NOLINT
+  EXPECT_TRUE(test_expression(table_b, ChunkID{0}, *or_(equals_(x, 9), and_(greater_than_(x, 8), is_not_null_(x))), {0, 1, 2}));  // NOLINT
+  EXPECT_TRUE(test_expression(table_b, ChunkID{0}, *and_(equals_(x, 10), value_(1)), {0, 2}));
+  EXPECT_TRUE(test_expression(table_b, ChunkID{0}, *and_(equals_(x, 10), value_(0)), {}));
+  EXPECT_TRUE(test_expression(table_b, ChunkID{0}, *or_(less_than_(x, 100), equals_(x, 10)), {0, 1, 2, 3}));
+  EXPECT_TRUE(test_expression(table_b, ChunkID{1}, *and_(between_(x, 7, 8), in_(x, list_(7, 8))), {0, 1, 2}));
+  // clang-format on
+}
+
 TEST_F(ExpressionEvaluatorToPosListTest, ExistsCorrelated) {
   const auto table_wrapper = std::make_shared<TableWrapper>(table_a);
   const auto table_scan =
@@ -147,6 +160,12 @@ TEST_F(ExpressionEvaluatorToPosListTest, ExistsCorrelated) {
 
   EXPECT_TRUE(test_expression(table_b, ChunkID{0}, *not_exists_(subquery), {0, 1, 2, 3}));
   EXPECT_TRUE(test_expression(table_b, ChunkID{1}, *not_exists_(subquery), {0, 2}));
+
+  // The subquery is only executed for rows that are still selected
+  EXPECT_TRUE(test_expression(table_b, ChunkID{0}, *and_(less_than_(x, 10), exists_(subquery)), {}));
+  EXPECT_TRUE(test_expression(table_b, ChunkID{1}, *and_(less_than_(x, 10), exists_(subquery)), {1}));
+  EXPECT_TRUE(test_expression(table_b, ChunkID{1}, *and_(equals_(x, 8), not_exists_(subquery)), {0, 2}));
+  EXPECT_TRUE(test_expression(table_b, ChunkID{1}, *or_(equals_(x, 8), exists_(subquery)), {0, 1, 2}));
 }
 
 TEST_F(ExpressionEvaluatorToPosListTest, ExistsUncorrelated) {
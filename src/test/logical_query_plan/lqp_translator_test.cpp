@@ -641,6 +641,7 @@ TEST_F(LQPTranslatorTest, JoinAndPredicates) {
 
   const auto join_op = std::dynamic_pointer_cast<const JoinHash>(op);
   ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->output_order(), JoinHash::OutputOrder::Partitioned);
 
   const auto predicate_op_left = std::dynamic_pointer_cast<const TableScan>(join_op->input_left());
   ASSERT_TRUE(predicate_op_left);
@@ -659,6 +660,22 @@ TEST_F(LQPTranslatorTest, JoinAndPredicates) {
   EXPECT_EQ(get_table_op_right->table_name(), "table_int_float2");
 }
 
+TEST_F(LQPTranslatorTest, JoinWithMaterializedOutput) {
+  // The join result is materialized by the aggregate, so the join groups its output by the referenced chunks
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(int_float_a), expression_vector(sum_(int_float2_b)),
+    JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a),
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  const auto join_op = std::dynamic_pointer_cast<const JoinHash>(op->input_left());
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->output_order(), JoinHash::OutputOrder::GroupedByChunk);
+}
+
 TEST_F(LQPTranslatorTest, LimitNode) {
   /**
    * Build LQP and translate to PQP
@@ -0,0 +1,64 @@
+#include <limits>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "memory/tracking_memory_resource.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class TrackingMemoryResourceTest : public BaseTest {};
+
+TEST_F(TrackingMemoryResourceTest, TrackAllocations) {
+  auto memory_resource = TrackingMemoryResource{};
+  EXPECT_EQ(memory_resource.current_bytes(), 0u);
+  EXPECT_EQ(memory_resource.remaining_budget(), std::numeric_limits<size_t>::max());
+
+  {
+    auto vector = pmr_vector<int32_t>(100, PolymorphicAllocator<int32_t>{&memory_resource});
+    EXPECT_EQ(memory_resource.current_bytes(), 400u);
+
+    auto other_vector = pmr_vector<int64_t>(10, PolymorphicAllocator<int64_t>{&memory_resource});
+    EXPECT_EQ(memory_resource.current_bytes(), 480u);
+  }
+
+  EXPECT_EQ(memory_resource.current_bytes(), 0u);
+  EXPECT_EQ(memory_resource.peak_bytes(), 480u);
+}
+
+TEST_F(TrackingMemoryResourceTest, Budget) {
+  auto memory_resource = TrackingMemoryResource{1'000};
+  EXPECT_EQ(memory_resource.budget(), 1'000u);
+  EXPECT_EQ(memory_resource.remaining_budget(), 1'000u);
+
+  auto vector = pmr_vector<int32_t>(100, PolymorphicAllocator<int32_t>{&memory_resource});
+  EXPECT_EQ(memory_resource.remaining_budget(), 600u);
+
+  // Exceeding the budget does not make the allocation fail
+  auto large_vector = pmr_vector<int32_t>(1'000, PolymorphicAllocator<int32_t>{&memory_resource});
+  EXPECT_EQ(memory_resource.current_bytes(), 4'400u);
+  EXPECT_EQ(memory_resource.remaining_budget(), 0u);
+}
+
+TEST_F(TrackingMemoryResourceTest, NestedResources) {
+  auto query_memory_resource = TrackingMemoryResource{1'000};
+  auto operator_memory_resource = TrackingMemoryResource{std::nullopt, &query_memory_resource};
+  auto other_operator_memory_resource = TrackingMemoryResource{std::nullopt, &query_memory_resource};
+  EXPECT_EQ(operator_memory_resource.parent(), &query_memory_resource);
+  EXPECT_FALSE(query_memory_resource.parent());
+
+  // Allocations are accounted for on both levels, and the budget of the parent applies to all of its children
+  auto vector = pmr_vector<int32_t>(100, PolymorphicAllocator<int32_t>{&operator_memory_resource});
+  auto other_vector = pmr_vector<int32_t>(50, PolymorphicAllocator<int32_t>{&other_operator_memory_resource});
+  EXPECT_EQ(operator_memory_resource.current_bytes(), 400u);
+  EXPECT_EQ(other_operator_memory_resource.current_bytes(), 200u);
+  EXPECT_EQ(query_memory_resource.current_bytes(), 600u);
+  EXPECT_EQ(operator_memory_resource.remaining_budget(), 400u);
+
+  // The tighter budget wins
+  auto limited_memory_resource = TrackingMemoryResource{100, &query_memory_resource};
+  EXPECT_EQ(limited_memory_resource.remaining_budget(), 100u);
+}
+
+}  // namespace opossum
@@ -16,6 +16,7 @@
 #include "operators/join_hash.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/print.hpp"
+#include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -448,6 +449,17 @@ TYPED_TEST(OperatorsAggregateTest, SingleAggregateMaxWithNull) {
                     "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/max_null.tbl", 1, false);
 }
 
+TYPED_TEST(OperatorsAggregateTest, SingleAggregateMaxOnSortedInput) {
+  // The Sort marks its output as sorted, so that the AggregateSort does not need to sort it again
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::DescendingNullsLast}) {
+    const auto sort = std::make_shared<Sort>(this->_table_wrapper_1_1_null, ColumnID{0}, order_by_mode, 2u);
+    sort->execute();
+
+    this->test_output(sort, {{ColumnID{1}, AggregateFunction::Max}}, {ColumnID{0}},
+                      "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/max_null.tbl", 1, false);
+  }
+}
+
 TYPED_TEST(OperatorsAggregateTest, SingleAggregateMinWithNull) {
   this->test_output(this->_table_wrapper_1_1_null, {{ColumnID{1}, AggregateFunction::Min}}, {ColumnID{0}},
                     "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/min_null.tbl", 1, false);
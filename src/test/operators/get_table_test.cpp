@@ -7,6 +7,7 @@
 #include "operators/delete.hpp"
 #include "operators/get_table.hpp"
 #include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/chunk.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -56,6 +57,31 @@ TEST_F(OperatorsGetTableTest, ExcludedChunks) {
   EXPECT_EQ(table->get_value<int>(ColumnID(0), 1u), original_table->get_value<int>(ColumnID(0), 3u));
 }
 
+TEST_F(OperatorsGetTableTest, PruneChunksWithParameters) {
+  // The chunks of the encoded table have statistics: {12345, 456.7}, {12345, 457.7}, {123, 458.7}, {12, 350.7}
+  const auto table = load_table("resources/test_data/tbl/int_float2.tbl", 1u);
+  ChunkEncoder::encode_all_chunks(table, EncodingType::Dictionary);
+  StorageManager::get().add_table("tableWithStatistics", table);
+
+  const auto predicates = std::vector<OperatorScanPredicate>{
+      {ColumnID{0}, PredicateCondition::GreaterThan, ParameterID{0}},
+      {ColumnID{1}, PredicateCondition::Between, AllTypeVariant{457.0f}, ParameterID{1}}};
+
+  auto gt = std::make_shared<opossum::GetTable>("tableWithStatistics");
+  gt->set_parameter_pruning_predicates(predicates);
+  gt->set_parameters({{ParameterID{0}, AllTypeVariant{100}}, {ParameterID{1}, AllTypeVariant{500.0f}}});
+  gt->execute();
+  EXPECT_EQ(gt->get_output()->chunk_count(), 2u);
+  EXPECT_EQ(gt->get_output()->get_value<int>(ColumnID{0}, 0u), 12345);
+  EXPECT_EQ(gt->get_output()->get_value<int>(ColumnID{0}, 1u), 123);
+
+  // Without parameter values, no chunks are pruned
+  auto gt_without_parameters = std::make_shared<opossum::GetTable>("tableWithStatistics");
+  gt_without_parameters->set_parameter_pruning_predicates(predicates);
+  gt_without_parameters->execute();
+  EXPECT_EQ(gt_without_parameters->get_output()->chunk_count(), 4u);
+}
+
 TEST_F(OperatorsGetTableTest, ExcludeCleanedUpChunk) {
   auto gt = std::make_shared<opossum::GetTable>("tableWithValues");
   auto context = std::make_shared<TransactionContext>(1u, 3u);
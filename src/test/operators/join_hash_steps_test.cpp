@@ -189,6 +189,165 @@ TEST_F(JoinHashStepsTest, RadixClusteringOfNulls) {
   }
 }
 
+TEST_F(JoinHashStepsTest, TwoPassRadixClustering) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 100);
+  for (auto value = 0; value < 1'000; ++value) {
+    table->append({value * 7});
+  }
+
+  const auto radix_bit_count = size_t{5};
+  std::vector<std::vector<size_t>> histograms;
+  const auto chunk_offsets = determine_chunk_offsets(table);
+  const auto materialized =
+      materialize_input<int, int, false>(table, ColumnID{0}, chunk_offsets, histograms, radix_bit_count);
+
+  const auto single_pass_result =
+      partition_radix_parallel<int, int, false>(materialized, chunk_offsets, histograms, radix_bit_count);
+  // Limiting the bits per pass to 2 results in two passes with 3 and 2 bits
+  const auto two_pass_result =
+      partition_radix_parallel<int, int, false>(materialized, chunk_offsets, histograms, radix_bit_count, 2);
+
+  // Both passes keep the order of the elements within a partition, so the results are identical
+  ASSERT_EQ(two_pass_result.partition_offsets, single_pass_result.partition_offsets);
+  EXPECT_EQ(single_pass_result.partition_offsets.size(), 32u);
+  EXPECT_EQ(single_pass_result.partition_offsets.back(), 1'000u);
+  for (auto offset = size_t{0}; offset < single_pass_result.partition_offsets.back(); ++offset) {
+    EXPECT_EQ((*two_pass_result.elements)[offset].row_id, (*single_pass_result.elements)[offset].row_id);
+    EXPECT_EQ((*two_pass_result.elements)[offset].value, (*single_pass_result.elements)[offset].value);
+  }
+
+  // The same holds when NULL values are retained
+  histograms.clear();
+  const auto chunk_offsets_nulls = determine_chunk_offsets(_table_int_with_nulls->get_output());
+  const auto materialized_nulls = materialize_input<int, int, true>(_table_int_with_nulls->get_output(), ColumnID{0},
+                                                                    chunk_offsets_nulls, histograms, 3);
+  const auto single_pass_result_nulls =
+      partition_radix_parallel<int, int, true>(materialized_nulls, chunk_offsets_nulls, histograms, 3);
+  const auto two_pass_result_nulls =
+      partition_radix_parallel<int, int, true>(materialized_nulls, chunk_offsets_nulls, histograms, 3, 1);
+
+  ASSERT_EQ(two_pass_result_nulls.partition_offsets, single_pass_result_nulls.partition_offsets);
+  EXPECT_EQ(*two_pass_result_nulls.null_value_bitvector, *single_pass_result_nulls.null_value_bitvector);
+  for (auto offset = size_t{0}; offset < single_pass_result_nulls.partition_offsets.back(); ++offset) {
+    EXPECT_EQ((*two_pass_result_nulls.elements)[offset].row_id, (*single_pass_result_nulls.elements)[offset].row_id);
+  }
+}
+
+TEST_F(JoinHashStepsTest, SpillAndLoadPartitions) {
+  auto radix_container = RadixContainer<pmr_string>{};
+  radix_container.elements = std::make_shared<Partition<pmr_string>>();
+  radix_container.elements->emplace_back(RowID{ChunkID{0}, ChunkOffset{1}}, "a");
+  radix_container.elements->emplace_back(RowID{ChunkID{1}, ChunkOffset{0}}, "");
+  radix_container.elements->emplace_back(RowID{ChunkID{1}, ChunkOffset{2}}, "a longer string");
+  radix_container.partition_offsets = {1, 1, 3};
+  radix_container.null_value_bitvector = std::make_shared<std::vector<bool>>(std::vector<bool>{false, true, false});
+
+  const auto spilled_container = spill_partitions(radix_container);
+  EXPECT_EQ(spilled_container.partition_offsets, radix_container.partition_offsets);
+  EXPECT_TRUE(spilled_container.has_null_values);
+
+  const auto all_partitions = load_partitions<pmr_string>(spilled_container, 0, 3);
+  EXPECT_EQ(all_partitions.partition_offsets, radix_container.partition_offsets);
+  EXPECT_EQ(*all_partitions.null_value_bitvector, *radix_container.null_value_bitvector);
+  for (auto offset = size_t{0}; offset < 3; ++offset) {
+    EXPECT_EQ((*all_partitions.elements)[offset].row_id, (*radix_container.elements)[offset].row_id);
+    EXPECT_EQ((*all_partitions.elements)[offset].value, (*radix_container.elements)[offset].value);
+  }
+
+  // Loading a subset of the partitions rebases the offsets
+  const auto last_partitions = load_partitions<pmr_string>(spilled_container, 1, 3);
+  EXPECT_EQ(last_partitions.partition_offsets, (std::vector<size_t>{0, 2}));
+  ASSERT_EQ(last_partitions.elements->size(), 2u);
+  EXPECT_EQ((*last_partitions.elements)[1].value, "a longer string");
+  EXPECT_EQ(*last_partitions.null_value_bitvector, (std::vector<bool>{true, false}));
+}
+
+TEST_F(JoinHashStepsTest, SpillAndLoadMultipleRuns) {
+  const auto make_run = [](const std::vector<int>& values, const std::vector<size_t>& partition_offsets) {
+    auto radix_container = RadixContainer<int>{};
+    radix_container.elements = std::make_shared<Partition<int>>(values.size());
+    for (auto offset = size_t{0}; offset < values.size(); ++offset) {
+      (*radix_container.elements)[offset] =
+          PartitionedElement<int>{RowID{ChunkID{0}, ChunkOffset{static_cast<uint32_t>(offset)}}, values[offset]};
+    }
+    radix_container.partition_offsets = partition_offsets;
+    radix_container.null_value_bitvector = std::make_shared<std::vector<bool>>();
+    return radix_container;
+  };
+
+  auto spilled_container = create_spilled_radix_container(3, false);
+  spill_partitions(make_run({1, 2, 3}, {1, 1, 3}), spilled_container);
+  spill_partitions(make_run({4, 5, 6}, {2, 3, 3}), spilled_container);
+  EXPECT_EQ(spilled_container.partition_offsets, (std::vector<size_t>{3, 4, 6}));
+  EXPECT_EQ(spilled_container.file_size, 6 * (sizeof(RowID) + sizeof(int)));
+
+  // The elements of each partition are gathered from both runs
+  const auto all_partitions = load_partitions<int>(spilled_container, 0, 3);
+  EXPECT_EQ(all_partitions.partition_offsets, (std::vector<size_t>{3, 4, 6}));
+  const auto expected_values = std::vector<int>{1, 4, 5, 6, 2, 3};
+  for (auto offset = size_t{0}; offset < expected_values.size(); ++offset) {
+    EXPECT_EQ((*all_partitions.elements)[offset].value, expected_values[offset]);
+  }
+
+  const auto middle_partition = load_partitions<int>(spilled_container, 1, 2);
+  EXPECT_EQ(middle_partition.partition_offsets, (std::vector<size_t>{1}));
+  EXPECT_EQ((*middle_partition.elements)[0].value, 6);
+}
+
+TEST_F(JoinHashStepsTest, RepartitionSpilledPartition) {
+  const auto make_run = [](const std::vector<int>& values, const std::vector<size_t>& partition_offsets) {
+    auto radix_container = RadixContainer<int>{};
+    radix_container.elements = std::make_shared<Partition<int>>(values.size());
+    for (auto offset = size_t{0}; offset < values.size(); ++offset) {
+      (*radix_container.elements)[offset] =
+          PartitionedElement<int>{RowID{ChunkID{0}, ChunkOffset{static_cast<uint32_t>(offset)}}, values[offset]};
+    }
+    radix_container.partition_offsets = partition_offsets;
+    radix_container.null_value_bitvector = std::make_shared<std::vector<bool>>();
+    return radix_container;
+  };
+
+  // The second partition holds {2, 3, 5} in the first run and {4, 7} in the second one
+  auto spilled_container = create_spilled_radix_container(2, false);
+  spill_partitions(make_run({1, 2, 3, 5}, {1, 4}), spilled_container);
+  spill_partitions(make_run({4, 7}, {0, 2}), spilled_container);
+
+  const auto second_run = load_partitions<int>(spilled_container, 1, 2, 1, 2);
+  EXPECT_EQ(second_run.partition_offsets, (std::vector<size_t>{2}));
+  EXPECT_EQ((*second_run.elements)[0].value, 4);
+  EXPECT_EQ((*second_run.elements)[1].value, 7);
+
+  // Split the partition by the lowest bit of the hash (std::hash<int> is the identity). Each run is repartitioned on
+  // its own, so the result has a run for each of them.
+  const auto repartitioned = repartition_spilled_partition<int, int>(spilled_container, 1, 0, 1);
+  EXPECT_EQ(repartitioned.partition_file_offsets.size(), 2u);
+  EXPECT_EQ(repartitioned.partition_offsets, (std::vector<size_t>{2, 5}));
+
+  const auto loaded = load_partitions<int>(repartitioned, 0, 2);
+  const auto expected_values = std::vector<int>{2, 4, 3, 5, 7};
+  for (auto offset = size_t{0}; offset < expected_values.size(); ++offset) {
+    EXPECT_EQ((*loaded.elements)[offset].value, expected_values[offset]);
+  }
+}
+
+TEST_F(JoinHashStepsTest, PartitionByHashBits) {
+  auto radix_container = RadixContainer<int>{};
+  radix_container.elements = std::make_shared<Partition<int>>(8);
+  for (auto value = 0; value < 8; ++value) {
+    (*radix_container.elements)[value] = PartitionedElement<int>{RowID{ChunkID{0}, ChunkOffset{0}}, value};
+  }
+  radix_container.partition_offsets = {8};
+  radix_container.null_value_bitvector = std::make_shared<std::vector<bool>>();
+
+  // Partition by the second and third bit of the hash. As std::hash<int> is the identity, the partitions are formed by
+  // the values {0, 1}, {2, 3}, {4, 5}, and {6, 7}
+  const auto partitioned = partition_by_hash_bits<int, int>(radix_container, 1, 2);
+  ASSERT_EQ(partitioned.partition_offsets, (std::vector<size_t>{2, 4, 6, 8}));
+  for (auto offset = 0; offset < 8; ++offset) {
+    EXPECT_EQ((*partitioned.elements)[offset].value, offset);
+  }
+}
+
 TEST_F(JoinHashStepsTest, DetermineChunkOffsets) {
   // offset store the start offset for each chunk
   const auto chunk_offsets_nulls = determine_chunk_offsets(_table_with_nulls_and_zeros->get_output());
@@ -197,6 +356,40 @@ TEST_F(JoinHashStepsTest, DetermineChunkOffsets) {
   EXPECT_EQ(chunk_offsets_nulls[1], 10);
 }
 
+TEST_F(JoinHashStepsTest, GroupMatchesByChunk) {
+  auto build_pos_list = PosList{RowID{ChunkID{2}, ChunkOffset{5}}, NULL_ROW_ID, RowID{ChunkID{0}, ChunkOffset{7}},
+                                RowID{ChunkID{2}, ChunkOffset{1}}, RowID{ChunkID{0}, ChunkOffset{3}}};
+  auto probe_pos_list = PosList{RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{1}},
+                                RowID{ChunkID{0}, ChunkOffset{2}}, RowID{ChunkID{1}, ChunkOffset{0}},
+                                RowID{ChunkID{1}, ChunkOffset{1}}};
+
+  group_matches_by_chunk(build_pos_list, probe_pos_list, ChunkID{3});
+
+  // Grouped by the build side chunk, NULLs last, while the probe side stays ordered within each group
+  const auto expected_build_pos_list =
+      PosList{RowID{ChunkID{0}, ChunkOffset{7}}, RowID{ChunkID{0}, ChunkOffset{3}}, RowID{ChunkID{2}, ChunkOffset{5}},
+              RowID{ChunkID{2}, ChunkOffset{1}}, NULL_ROW_ID};
+  const auto expected_probe_pos_list =
+      PosList{RowID{ChunkID{0}, ChunkOffset{2}}, RowID{ChunkID{1}, ChunkOffset{1}}, RowID{ChunkID{0}, ChunkOffset{0}},
+              RowID{ChunkID{1}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{1}}};
+  EXPECT_EQ(build_pos_list, expected_build_pos_list);
+  EXPECT_EQ(probe_pos_list, expected_probe_pos_list);
+}
+
+TEST_F(JoinHashStepsTest, GuaranteeSingleChunkIfApplicable) {
+  auto single_chunk_pos_list = PosList{RowID{ChunkID{1}, ChunkOffset{5}}, RowID{ChunkID{1}, ChunkOffset{2}}};
+  guarantee_single_chunk_if_applicable(single_chunk_pos_list);
+  EXPECT_TRUE(single_chunk_pos_list.references_single_chunk());
+
+  auto multi_chunk_pos_list = PosList{RowID{ChunkID{1}, ChunkOffset{5}}, RowID{ChunkID{0}, ChunkOffset{2}}};
+  guarantee_single_chunk_if_applicable(multi_chunk_pos_list);
+  EXPECT_FALSE(multi_chunk_pos_list.references_single_chunk());
+
+  auto pos_list_with_null = PosList{RowID{ChunkID{1}, ChunkOffset{5}}, NULL_ROW_ID};
+  guarantee_single_chunk_if_applicable(pos_list_with_null);
+  EXPECT_FALSE(pos_list_with_null.references_single_chunk());
+}
+
 TEST_F(JoinHashStepsTest, ThrowWhenNoNullValuesArePassed) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
@@ -1,7 +1,12 @@
+#include <algorithm>
+
 #include "../base_test.hpp"
 
+#include "memory/tracking_memory_resource.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -52,6 +57,25 @@ TEST_F(JoinHashTest, OperatorName) {
   EXPECT_EQ(join->name(), "JoinHash");
 }
 
+TEST_F(JoinHashTest, PerformanceData) {
+  auto join =
+      std::make_shared<JoinHash>(_table_tpch_orders_scanned, _table_tpch_lineitems_scanned, JoinMode::Inner,
+                                 OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals}, 2);
+  join->execute();
+
+  const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(join->performance_data());
+  EXPECT_EQ(performance_data.radix_bits, 2u);
+  EXPECT_EQ(performance_data.input_row_count_left, _table_tpch_orders_scanned->get_output()->row_count());
+  EXPECT_EQ(performance_data.input_row_count_right, _table_tpch_lineitems_scanned->get_output()->row_count());
+  EXPECT_EQ(performance_data.output_row_count, join->get_output()->row_count());
+  EXPECT_EQ(performance_data.output_chunk_count, join->get_output()->chunk_count());
+
+  // The steps are part of the operator's runtime
+  EXPECT_GT(performance_data.build.count(), 0);
+  EXPECT_GT(performance_data.probe.count(), 0);
+  EXPECT_LE(performance_data.probe + performance_data.output_writing, performance_data.walltime);
+}
+
 // Once we bring in the PosList optimization flag REFERS_TO_SINGLE_CHUNK_ONLY, this test will ensure
 // that the join does not unnecessarily add chunks (e.g., discussed in #698).
 TEST_F(JoinHashTest, DISABLED_ChunkCount /* #698 */) {
@@ -80,6 +104,161 @@ TEST_F(JoinHashTest, RadixClusteredLeftJoinWithZeroAndOnesAnd) {
   EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
 }
 
+TEST_F(JoinHashTest, OutputOrderGroupedByChunk) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto partitioned_join =
+      std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_lineitems, JoinMode::Inner, primary_predicate, 2);
+  partitioned_join->execute();
+
+  const auto grouped_join =
+      std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_lineitems, JoinMode::Inner, primary_predicate, 2,
+                                 std::vector<OperatorJoinPredicate>{}, JoinHash::OutputOrder::GroupedByChunk);
+  grouped_join->execute();
+  EXPECT_EQ(grouped_join->output_order(), JoinHash::OutputOrder::GroupedByChunk);
+  EXPECT_TABLE_EQ_UNORDERED(grouped_join->get_output(), partitioned_join->get_output());
+
+  // orders is the smaller input and thus the build side. Within each output chunk, its RowIDs are grouped by chunk.
+  const auto& output_table = *grouped_join->get_output();
+  for (auto chunk_id = ChunkID{0}; chunk_id < output_table.chunk_count(); ++chunk_id) {
+    const auto segment =
+        std::static_pointer_cast<const ReferenceSegment>(output_table.get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    const auto& pos_list = *segment->pos_list();
+    EXPECT_TRUE(std::is_sorted(pos_list.cbegin(), pos_list.cend(), [](const auto& lhs, const auto& rhs) {
+      return lhs.chunk_id < rhs.chunk_id;
+    }));
+  }
+}
+
+TEST_F(JoinHashTest, SpillToDisk) {
+  const auto test_spilling = [](const std::shared_ptr<AbstractOperator>& left,
+                                const std::shared_ptr<AbstractOperator>& right, const JoinMode mode,
+                                const ColumnID column_id, const size_t memory_budget) {
+    const auto primary_predicate = OperatorJoinPredicate{{column_id, column_id}, PredicateCondition::Equals};
+    const auto join = std::make_shared<JoinHash>(left, right, mode, primary_predicate);
+    join->execute();
+
+    const auto spilling_join = std::make_shared<JoinHash>(left, right, mode, primary_predicate);
+    spilling_join->set_memory_resource(std::make_shared<TrackingMemoryResource>(memory_budget));
+    spilling_join->execute();
+
+    const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(spilling_join->performance_data());
+    EXPECT_GT(performance_data.spilled_bytes, 0u);
+    EXPECT_TABLE_EQ_UNORDERED(spilling_join->get_output(), join->get_output());
+  };
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi, JoinMode::AntiNullAsTrue,
+                          JoinMode::AntiNullAsFalse}) {
+    test_spilling(_table_tpch_orders_scanned, _table_tpch_lineitems_scanned, mode, ColumnID{0}, 1'000);
+    test_spilling(_table_with_nulls, _table_with_nulls, mode, ColumnID{0}, 100);
+  }
+
+  // o_comment, spilled strings need to be restored
+  test_spilling(_table_tpch_orders, _table_tpch_orders, JoinMode::Inner, ColumnID{8}, 1'000);
+}
+
+TEST_F(JoinHashTest, SpillSkewedPartitionRecursively) {
+  // The partition of the value 7 exceeds the budget on its own. It cannot be split up, but is processed anyway.
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 100);
+  for (auto row_id = 0; row_id < 500; ++row_id) {
+    table->append({row_id % 5 == 0 ? row_id : 7});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto spilling_join =
+      std::make_shared<JoinHash>(table_wrapper, table_wrapper, JoinMode::Inner, primary_predicate);
+  spilling_join->set_memory_resource(std::make_shared<TrackingMemoryResource>(2'000));
+  spilling_join->execute();
+
+  // 400 rows with the value 7 match each other, the remaining 100 rows match themselves
+  EXPECT_EQ(spilling_join->get_output()->row_count(), 400u * 400u + 100u);
+  // Besides both inputs, the partition of the value 7 has been spilled again when trying to split it up
+  const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(spilling_join->performance_data());
+  EXPECT_GT(performance_data.spilled_bytes, 2 * 500 * (sizeof(RowID) + sizeof(int32_t)));
+}
+
+TEST_F(JoinHashTest, SpillInputsBatchByBatch) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 100);
+  for (auto row_id = 0; row_id < 10'000; ++row_id) {
+    table->append({row_id});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto materialized_size = 10'000 * (sizeof(RowID) + sizeof(int32_t));
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto join = std::make_shared<JoinHash>(table_wrapper, table_wrapper, JoinMode::Inner, primary_predicate);
+  const auto memory_resource = std::make_shared<TrackingMemoryResource>();
+  join->set_memory_resource(memory_resource);
+  join->execute();
+
+  // Without a budget, both inputs are materialized through the memory resource of the join
+  EXPECT_GE(memory_resource->peak_bytes(), 2 * materialized_size);
+
+  const auto spilling_join =
+      std::make_shared<JoinHash>(table_wrapper, table_wrapper, JoinMode::Inner, primary_predicate);
+  const auto spilling_memory_resource = std::make_shared<TrackingMemoryResource>(20'000);
+  spilling_join->set_memory_resource(spilling_memory_resource);
+  spilling_join->execute();
+
+  // When spilling, the inputs never reside in memory as a whole
+  EXPECT_EQ(spilling_join->get_output()->row_count(), 10'000u);
+  EXPECT_LT(spilling_memory_resource->peak_bytes(), materialized_size);
+}
+
+TEST_F(JoinHashTest, PruneProbeSide) {
+  // The probe side consists of the chunks {1, 2}, {3, 4}, and {5, 6}. Only the second one can match the build side.
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int}};
+  const auto probe_table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  for (auto value = 1; value <= 6; ++value) {
+    probe_table->append({value});
+  }
+  ChunkEncoder::encode_all_chunks(probe_table, EncodingType::Dictionary);
+  const auto probe_table_wrapper = std::make_shared<TableWrapper>(probe_table);
+  probe_table_wrapper->execute();
+
+  const auto build_table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  build_table->append({4});
+  build_table->append({3});
+  const auto build_table_wrapper = std::make_shared<TableWrapper>(build_table);
+  build_table_wrapper->execute();
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+  // The smaller input is the build side of inner joins, the right input is the build side of semi joins
+  const auto inner_join = std::make_shared<JoinHash>(build_table_wrapper, probe_table_wrapper, JoinMode::Inner,
+                                                     primary_predicate);
+  inner_join->execute();
+  const auto semi_join = std::make_shared<JoinHash>(probe_table_wrapper, build_table_wrapper, JoinMode::Semi,
+                                                    primary_predicate);
+  semi_join->execute();
+
+  for (const auto& [join, probe_column_id] : {std::make_pair(inner_join, ColumnID{1}),
+                                              std::make_pair(semi_join, ColumnID{0})}) {
+    const auto& output = *join->get_output();
+    EXPECT_EQ(output.row_count(), 2u);
+
+    // The output references a copy of the probe side that only contains the chunk that was not pruned
+    for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+      const auto segment = output.get_chunk(chunk_id)->get_segment(probe_column_id);
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+      ASSERT_TRUE(reference_segment);
+      EXPECT_EQ(reference_segment->referenced_table()->chunk_count(), 1u);
+    }
+  }
+
+  // If no chunk of the probe side can match, the join does not materialize the probe side at all
+  const auto no_match_table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  no_match_table->append({10});
+  const auto no_match_table_wrapper = std::make_shared<TableWrapper>(no_match_table);
+  no_match_table_wrapper->execute();
+  const auto no_match_join = std::make_shared<JoinHash>(no_match_table_wrapper, probe_table_wrapper, JoinMode::Inner,
+                                                        primary_predicate);
+  no_match_join->execute();
+  EXPECT_EQ(no_match_join->get_output()->row_count(), 0u);
+}
+
 TEST_F(JoinHashTest, HashJoinNotApplicable) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
@@ -0,0 +1,104 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/join_sort_merge/radix_cluster_sort.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class JoinSortMergeTest : public BaseTest {
+ protected:
+  static void SetUpTestCase() {
+    const auto column_definitions =
+        TableColumnDefinitions{TableColumnDefinition{"a", DataType::Int}, TableColumnDefinition{"b", DataType::Int}};
+
+    // In both tables, more than half of the rows have the key 7. The remaining keys only partially overlap.
+    auto left_table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+    for (auto row_id = 0; row_id < 100; ++row_id) {
+      left_table->append({row_id % 5 == 0 ? row_id : 7, row_id});
+    }
+    _skewed_left = std::make_shared<TableWrapper>(left_table);
+    _skewed_left->execute();
+
+    auto right_table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+    for (auto row_id = 0; row_id < 80; ++row_id) {
+      right_table->append({row_id % 3 == 0 ? row_id * 2 : 7, 100 - row_id});
+    }
+    _skewed_right = std::make_shared<TableWrapper>(right_table);
+    _skewed_right->execute();
+  }
+
+  inline static std::shared_ptr<TableWrapper> _skewed_left, _skewed_right;
+};
+
+TEST_F(JoinSortMergeTest, DetectHeavyHitters) {
+  auto radix_cluster_sort =
+      RadixClusterSort<int32_t>(_skewed_left->get_output(), _skewed_right->get_output(), {ColumnID{0}, ColumnID{0}},
+                                true, false, false, 8);
+  const auto output = radix_cluster_sort.execute();
+
+  ASSERT_EQ(output.heavy_hitters, std::vector<int32_t>{7});
+
+  // The heavy hitter has a cluster of its own after the regular clusters, on both sides
+  ASSERT_EQ(output.clusters_left->size(), 9u);
+  ASSERT_EQ(output.clusters_right->size(), 9u);
+  EXPECT_EQ((*output.clusters_left)[8]->size(), 80u);
+  EXPECT_EQ((*output.clusters_right)[8]->size(), 53u);
+  for (auto cluster_id = size_t{0}; cluster_id < 8; ++cluster_id) {
+    for (const auto& materialized_value : *(*output.clusters_left)[cluster_id]) {
+      EXPECT_NE(materialized_value.value, 7);
+    }
+  }
+}
+
+TEST_F(JoinSortMergeTest, SkewedJoins) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto secondary_predicates =
+      std::vector<OperatorJoinPredicate>{{{ColumnID{1}, ColumnID{1}}, PredicateCondition::LessThan}};
+
+  // The heavy hitter is split across multiple jobs, which must not change the result
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::FullOuter}) {
+    for (const auto& predicates : {std::vector<OperatorJoinPredicate>{}, secondary_predicates}) {
+      const auto join_sort_merge =
+          std::make_shared<JoinSortMerge>(_skewed_left, _skewed_right, mode, primary_predicate, predicates);
+      join_sort_merge->execute();
+
+      const auto join_nested_loop =
+          std::make_shared<JoinNestedLoop>(_skewed_left, _skewed_right, mode, primary_predicate, predicates);
+      join_nested_loop->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(join_sort_merge->get_output(), join_nested_loop->get_output());
+    }
+  }
+}
+
+TEST_F(JoinSortMergeTest, SortedInputs) {
+  // Chunks that are sorted by the join column are not sorted again. Descending chunks are reversed instead.
+  const auto sorted_left = std::make_shared<Sort>(_skewed_left, ColumnID{0}, OrderByMode::Ascending, 10);
+  sorted_left->execute();
+  const auto sorted_right = std::make_shared<Sort>(_skewed_right, ColumnID{0}, OrderByMode::Descending, 10);
+  sorted_right->execute();
+
+  for (const auto predicate_condition : {PredicateCondition::Equals, PredicateCondition::LessThan}) {
+    const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, predicate_condition};
+
+    const auto join_sort_merge =
+        std::make_shared<JoinSortMerge>(sorted_left, sorted_right, JoinMode::Inner, primary_predicate);
+    join_sort_merge->execute();
+
+    const auto join_nested_loop =
+        std::make_shared<JoinNestedLoop>(_skewed_left, _skewed_right, JoinMode::Inner, primary_predicate);
+    join_nested_loop->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join_sort_merge->get_output(), join_nested_loop->get_output());
+  }
+}
+
+}  // namespace opossum
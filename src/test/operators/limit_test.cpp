@@ -118,4 +118,21 @@ TEST_F(OperatorsLimitTest, Limit10ReferenceSegment) {
   test_limit_10();
 }
 
+TEST_F(OperatorsLimitTest, ForwardOrderedBy) {
+  const auto ordered_by = std::make_pair(ColumnID{1}, OrderByMode::Descending);
+  const auto table = load_table("resources/test_data/tbl/int_int3.tbl", 3);
+  table->get_chunk(ChunkID{0})->set_ordered_by(ordered_by);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // The limited chunks are prefixes of the input chunks, so they keep their order
+  auto limit = std::make_shared<Limit>(table_wrapper, to_expression(int64_t{4}));
+  limit->execute();
+
+  const auto& output = limit->get_output();
+  ASSERT_EQ(output->chunk_count(), 2u);
+  EXPECT_EQ(output->get_chunk(ChunkID{0})->ordered_by(), ordered_by);
+  EXPECT_FALSE(output->get_chunk(ChunkID{1})->ordered_by());
+}
+
 }  // namespace opossum
@@ -13,6 +13,9 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -54,6 +57,20 @@ TEST_F(OperatorsProjectionTest, ExecutedOnAllChunks) {
                             load_table("resources/test_data/tbl/projection/int_float_add.tbl"));
 }
 
+TEST_F(OperatorsProjectionTest, ExecutedOnAllChunksWithScheduler) {
+  // Each chunk is projected in its own job - the output chunks still have to appear in the order of the input chunks
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto projection = std::make_shared<opossum::Projection>(table_wrapper_a, expression_vector(add_(a_a, a_b)));
+  projection->execute();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  EXPECT_TABLE_EQ_ORDERED(projection->get_output(), load_table("resources/test_data/tbl/projection/int_float_add.tbl"));
+}
+
 TEST_F(OperatorsProjectionTest, ForwardsIfPossibleDataTable) {
   // The Projection will forward segments from its input if all expressions are segment references.
   // Why would you enforce something like this? E.g., Update relies on it.
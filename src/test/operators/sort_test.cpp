@@ -187,6 +187,37 @@ TEST_P(OperatorsSortTest, DescendingSortOfOneColumnWithNullsLast) {
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, SortOfSortedInput) {
+  std::shared_ptr<Table> expected_result =
+      load_table("resources/test_data/tbl/int_float_null_sorted_asc_nulls_last.tbl", 2);
+
+  // The output of the first Sort is marked as sorted, so the second one only has to move the NULLs
+  auto sort_nulls_first = std::make_shared<Sort>(_table_wrapper_null, ColumnID{0}, OrderByMode::Ascending, 2u);
+  sort_nulls_first->execute();
+
+  auto sort_nulls_last = std::make_shared<Sort>(sort_nulls_first, ColumnID{0}, OrderByMode::AscendingNullsLast, 2u);
+  sort_nulls_last->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort_nulls_last->get_output(), expected_result);
+}
+
+TEST_P(OperatorsSortTest, SortOfChunkwiseSortedInput) {
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_sorted.tbl", 2);
+
+  // Each chunk is sorted on its own, but the chunks are not in order
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", 1);
+  for (const auto& chunk : table->chunks()) {
+    chunk->set_ordered_by({ColumnID{0}, OrderByMode::Ascending});
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(table_wrapper, ColumnID{0}, OrderByMode::Ascending, 2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
 TEST_P(OperatorsSortTest, AscendingSortOfOneDictSegmentWithNull) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_null_sorted_asc.tbl", 2);
 
@@ -0,0 +1,103 @@
+#include <memory>
+#include <random>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan/compressed_vector_scan.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+
+#include "constant_mappings.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+using Params = std::tuple<VectorCompressionType, uint32_t>;
+
+class OperatorsTableScanCompressedVectorScanTest : public BaseTestWithParam<Params> {
+ protected:
+  void SetUp() override {
+    std::tie(_compression_type, _max_value_id) = GetParam();
+
+    // Use a size that is neither a multiple of the mask block size nor of the SIMD-BP128 block sizes
+    _values = pmr_vector<uint32_t>(4'321);
+
+    auto generator = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<uint32_t>{0u, _max_value_id};
+    for (auto& value : _values) {
+      value = distribution(generator);
+    }
+
+    _vector = compress_vector(_values, _compression_type, {}, {_max_value_id});
+  }
+
+  template <bool Invert>
+  void check_range(const uint32_t lower, const uint32_t range_size) {
+    // The null value id is the largest value id, as it is in dictionary segments
+    const auto null_value_id = _max_value_id;
+
+    auto expected = PosList{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _values.size(); ++chunk_offset) {
+      const auto value = _values[chunk_offset];
+      const auto in_range = value >= lower && value < lower + range_size;
+      if (Invert ? (!in_range && value != null_value_id) : in_range) {
+        expected.emplace_back(RowID{ChunkID{3}, chunk_offset});
+      }
+    }
+
+    auto matches = PosList{};
+    scan_compressed_vector_range<Invert>(*_vector, ValueID{lower}, range_size, ValueID{null_value_id}, ChunkID{3},
+                                         matches);
+
+    ASSERT_EQ(matches.size(), expected.size());
+    EXPECT_TRUE(std::equal(matches.begin(), matches.end(), expected.begin()));
+  }
+
+  VectorCompressionType _compression_type;
+  uint32_t _max_value_id;
+  pmr_vector<uint32_t> _values;
+  std::unique_ptr<const BaseCompressedVector> _vector;
+};
+
+auto compressed_vector_scan_formatter = [](const ::testing::TestParamInfo<Params> info) {
+  auto string = vector_compression_type_to_string.left.at(std::get<0>(info.param));
+  string.erase(std::remove_if(string.begin(), string.end(), [](char c) { return !std::isalnum(c); }), string.end());
+  return string + "MaxValueID" + std::to_string(std::get<1>(info.param));
+};
+
+// The maximum value ids result in one, two, and four byte wide codes for FixedSizeByteAligned
+INSTANTIATE_TEST_CASE_P(VectorCompressionTypes, OperatorsTableScanCompressedVectorScanTest,
+                        ::testing::Combine(::testing::Values(VectorCompressionType::SimdBp128,
+                                                             VectorCompressionType::FixedSizeByteAligned),
+                                           ::testing::Values(uint32_t{100}, uint32_t{3'000}, uint32_t{100'000})),
+                        compressed_vector_scan_formatter);
+
+TEST_P(OperatorsTableScanCompressedVectorScanTest, Equals) {
+  check_range<false>(0u, 1u);
+  check_range<false>(_max_value_id / 2, 1u);
+  check_range<false>(_max_value_id - 1, 1u);
+}
+
+TEST_P(OperatorsTableScanCompressedVectorScanTest, NotEquals) {
+  check_range<true>(0u, 1u);
+  check_range<true>(_max_value_id / 2, 1u);
+  check_range<true>(_max_value_id - 1, 1u);
+}
+
+TEST_P(OperatorsTableScanCompressedVectorScanTest, LessThan) {
+  check_range<false>(0u, 0u);
+  check_range<false>(0u, _max_value_id / 3);
+  check_range<false>(0u, _max_value_id);
+}
+
+TEST_P(OperatorsTableScanCompressedVectorScanTest, GreaterThanEquals) {
+  check_range<false>(_max_value_id / 3, _max_value_id - _max_value_id / 3);
+  check_range<false>(_max_value_id - 1, 1u);
+}
+
+TEST_P(OperatorsTableScanCompressedVectorScanTest, Between) {
+  check_range<false>(_max_value_id / 4, _max_value_id / 2);
+  check_range<false>(7u, 13u);
+}
+
+}  // namespace opossum
@@ -10,6 +10,7 @@ struct TestData {
   opossum::PredicateCondition predicate_condition;
   int32_t search_value;
   std::vector<int32_t> expected;
+  std::optional<int32_t> search_value2{};  // upper bound for Between
 };
 
 using Params = std::tuple<TestData, opossum::OrderByMode, bool>;
@@ -31,6 +32,7 @@ class OperatorsTableScanSortedSegmentSearchTest : public BaseTest, public ::test
     std::tie(test_data, _order_by, nullable) = GetParam();
     _predicate_condition = test_data.predicate_condition;
     _search_value = test_data.search_value;
+    _search_value2 = test_data.search_value2;
     _expected = test_data.expected;
 
     const bool ascending = _order_by == OrderByMode::Ascending || _order_by == OrderByMode::AscendingNullsLast;
@@ -64,6 +66,7 @@ class OperatorsTableScanSortedSegmentSearchTest : public BaseTest, public ::test
   std::unique_ptr<ValueSegment<int32_t>> _segment;
   PredicateCondition _predicate_condition;
   int32_t _search_value;
+  std::optional<int32_t> _search_value2;
   std::vector<int32_t> _expected;
   OrderByMode _order_by;
 };
@@ -79,6 +82,7 @@ INSTANTIATE_TEST_CASE_P(
             // 1. predicate condition to use
             // 2. value to compare
             // 3. expected result
+            // 4. upper bound (only for Between)
             //
             // Each row is tested with all four sorted orders and nullable or non-nullable segments. For descending
             // sort orders, the segments contain the values from 9 to 0 and the expected result is reversed, so that
@@ -113,7 +117,14 @@ INSTANTIATE_TEST_CASE_P(
             TestData{"GreaterThanEqualsRangeMinimum", PredicateCondition::GreaterThanEquals, 0, {0, 0, 1, 1, 2, 2, 3, 3, 4, 4}},  // NOLINT
             TestData{"GreaterThanEquals", PredicateCondition::GreaterThanEquals, 2, {2, 2, 3, 3, 4, 4}},
             TestData{"GreaterThanEqualsAboveRange", PredicateCondition::GreaterThanEquals, 5, {}},  // NOLINT
-            TestData{"GreaterThanEqualsRangeMaximum", PredicateCondition::GreaterThanEquals, 4, {4, 4}}),  // NOLINT
+            TestData{"GreaterThanEqualsRangeMaximum", PredicateCondition::GreaterThanEquals, 4, {4, 4}},  // NOLINT
+
+            TestData{"Between", PredicateCondition::Between, 1, {1, 1, 2, 2, 3, 3}, 3},
+            TestData{"BetweenSingleValue", PredicateCondition::Between, 2, {2, 2}, 2},
+            TestData{"BetweenBelowRange", PredicateCondition::Between, -3, {}, -1},
+            TestData{"BetweenAboveRange", PredicateCondition::Between, 5, {}, 7},
+            TestData{"BetweenWholeRange", PredicateCondition::Between, -1, {0, 0, 1, 1, 2, 2, 3, 3, 4, 4}, 5},
+            TestData{"BetweenInvertedBounds", PredicateCondition::Between, 3, {}, 1}),
 
         ::testing::Values(OrderByMode::Ascending, OrderByMode::AscendingNullsLast, OrderByMode::Descending,
                           OrderByMode::DescendingNullsLast),
@@ -125,7 +136,7 @@ TEST_P(OperatorsTableScanSortedSegmentSearchTest, ScanSortedSegment) {
   const auto iterable = create_iterable_from_segment(*_segment);
   iterable.with_iterators([&](auto input_begin, auto input_end) {
     auto sorted_segment_search =
-        SortedSegmentSearch(input_begin, input_end, _order_by, _predicate_condition, _search_value);
+        SortedSegmentSearch(input_begin, input_end, _order_by, _predicate_condition, _search_value, _search_value2);
     sorted_segment_search.scan_sorted_segment([&](auto output_begin, auto output_end) {
       ASSERT_EQ(std::distance(output_begin, output_end), _expected.size());
 
@@ -304,6 +304,60 @@ TEST_P(OperatorsTableScanTest, SingleScanWithSortedSegmentNotEquals) {
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanTest, BetweenScanWithSortedSegment) {
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_sorted_filtered.tbl", 1);
+
+  auto scan = std::make_shared<TableScan>(get_int_sorted_op(),
+                                          between_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), 2, 3));
+  scan->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+}
+
+TEST_P(OperatorsTableScanTest, ForwardOrderedBy) {
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_sorted_filtered.tbl", 1);
+
+  // The output chunks keep the order of the input chunks, so that the second scan can use binary search as well
+  auto scan_a = create_table_scan(get_int_sorted_op(), ColumnID{0}, PredicateCondition::GreaterThan, 1);
+  scan_a->execute();
+
+  const auto& output_a = scan_a->get_output();
+  ASSERT_EQ(output_a->chunk_count(), 1u);
+  EXPECT_EQ(output_a->get_chunk(ChunkID{0})->ordered_by(), std::make_pair(ColumnID{0}, OrderByMode::Ascending));
+
+  auto scan_b = create_table_scan(scan_a, ColumnID{0}, PredicateCondition::LessThan, 4);
+  scan_b->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(scan_b->get_output(), expected_result);
+  EXPECT_EQ(scan_b->get_output()->get_chunk(ChunkID{0})->ordered_by(),
+            std::make_pair(ColumnID{0}, OrderByMode::Ascending));
+}
+
+TEST_P(OperatorsTableScanTest, DoNotForwardOrderedByOfMultiChunkReferences) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int}};
+  const auto data_table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  for (const auto value : {3, 4, 1, 2}) {
+    data_table->append({value});
+  }
+
+  // The positions reference both chunks in ascending order of the values. As the scan groups the matches by the
+  // referenced chunk, the output is not ordered anymore.
+  const auto pos_list = std::make_shared<PosList>(PosList{{ChunkID{1}, ChunkOffset{0}}, {ChunkID{1}, ChunkOffset{1}},
+                                                          {ChunkID{0}, ChunkOffset{0}}, {ChunkID{0}, ChunkOffset{1}}});
+  const auto reference_table = std::make_shared<Table>(column_definitions, TableType::References);
+  reference_table->append_chunk({std::make_shared<ReferenceSegment>(data_table, ColumnID{0}, pos_list)});
+  reference_table->get_chunk(ChunkID{0})->set_ordered_by(std::make_pair(ColumnID{0}, OrderByMode::Ascending));
+  const auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+
+  auto scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 1);
+  scan->execute();
+
+  ASSERT_EQ(scan->get_output()->chunk_count(), 1u);
+  EXPECT_EQ(scan->get_output()->row_count(), 3u);
+  EXPECT_FALSE(scan->get_output()->get_chunk(ChunkID{0})->ordered_by());
+}
+
 TEST_P(OperatorsTableScanTest, SingleScanWithSubquery) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_filtered2.tbl", 1);
 
@@ -809,6 +863,50 @@ TEST_P(OperatorsTableScanTest, SetParameters) {
   EXPECT_EQ(*scan_c->predicate(), *greater_than_equals_(column, placeholder_(ParameterID{4})));
 }
 
+TEST_P(OperatorsTableScanTest, PruneChunksWithParameters) {
+  // int_float.tbl is split into the chunks {12345, 123} and {1234}
+  const auto table_wrapper = get_int_float_op();
+  const auto& table = *table_wrapper->get_output();
+  const auto column_a = get_column_expression(table_wrapper, ColumnID{0});
+
+  const auto scan = std::make_shared<TableScan>(
+      table_wrapper, greater_than_(column_a, correlated_parameter_(ParameterID{0}, column_a)));
+  scan->set_parameters({{ParameterID{0}, AllTypeVariant{2000}}});
+
+  const auto impl = scan->create_impl();
+  EXPECT_FALSE(impl->can_prune_chunk(*table.get_chunk(ChunkID{0})));
+  EXPECT_TRUE(impl->can_prune_chunk(*table.get_chunk(ChunkID{1})));
+
+  scan->execute();
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, {12345});
+
+  // Values of a different type are not used for pruning, as casting them to the column type might change the result
+  const auto column_b = get_column_expression(table_wrapper, ColumnID{1});
+  const auto scan_float = std::make_shared<TableScan>(
+      table_wrapper, greater_than_(column_a, correlated_parameter_(ParameterID{0}, column_b)));
+  scan_float->set_parameters({{ParameterID{0}, AllTypeVariant{1234.5f}}});
+  EXPECT_FALSE(scan_float->create_impl()->can_prune_chunk(*table.get_chunk(ChunkID{1})));
+}
+
+TEST_P(OperatorsTableScanTest, PruneReferencedChunks) {
+  const auto table_wrapper = get_int_float_op();
+  const auto column_a = get_column_expression(table_wrapper, ColumnID{0});
+
+  // Each output chunk of the first scan references a single chunk, whose statistics are used for pruning
+  const auto scan_a = std::make_shared<TableScan>(table_wrapper, less_than_(column_a, 20000));
+  scan_a->execute();
+  const auto& reference_table = *scan_a->get_output();
+  ASSERT_EQ(reference_table.chunk_count(), 2u);
+
+  const auto scan_b = std::make_shared<TableScan>(scan_a, between_(column_a, 1000, 2000));
+  scan_b->execute();
+  ASSERT_COLUMN_EQ(scan_b->get_output(), ColumnID{0}, {1234});
+
+  const auto impl = scan_b->create_impl();
+  EXPECT_TRUE(impl->can_prune_chunk(*reference_table.get_chunk(ChunkID{0})));
+  EXPECT_FALSE(impl->can_prune_chunk(*reference_table.get_chunk(ChunkID{1})));
+}
+
 TEST_P(OperatorsTableScanTest, GetImpl) {
   /**
    * Test that the correct scanning backend is chosen
@@ -76,6 +76,35 @@ TEST_F(UnionPositionsTest, SelfUnionExlusiveRanges) {
                             load_table("resources/test_data/tbl/10_ints_exclusive_ranges.tbl"));
 }
 
+TEST_F(UnionPositionsTest, SingleColumnClusterOutputsSingleChunkPosLists) {
+  /**
+   * If both inputs reference a single table, the bitmap-based implementation emits one output chunk per referenced
+   * chunk, in the order of the referenced chunks
+   */
+
+  auto get_table_op = std::make_shared<GetTable>("10_ints");
+  auto table_scan_a_op = std::make_shared<TableScan>(get_table_op, less_than_(_int_column_0_non_nullable, 20));
+  auto table_scan_b_op = std::make_shared<TableScan>(get_table_op, greater_than_(_int_column_0_non_nullable, 10));
+  auto union_unique_op = std::make_shared<UnionPositions>(table_scan_a_op, table_scan_b_op);
+
+  _execute_all({get_table_op, table_scan_a_op, table_scan_b_op, union_unique_op});
+
+  const auto& output = union_unique_op->get_output();
+  EXPECT_TABLE_EQ_UNORDERED(output, _table_10_ints);
+
+  auto previous_chunk_id = std::optional<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto segment = output->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    const auto pos_list = std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+
+    ASSERT_TRUE(pos_list->references_single_chunk());
+    if (previous_chunk_id) {
+      EXPECT_LT(*previous_chunk_id, pos_list->common_chunk_id());
+    }
+    previous_chunk_id = pos_list->common_chunk_id();
+  }
+}
+
 TEST_F(UnionPositionsTest, SelfUnionOverlappingRanges) {
   /**
    * Scan '10_ints' once for values smaller than 100 and then for those greater than 20. Union the results.
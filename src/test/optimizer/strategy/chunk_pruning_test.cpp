@@ -6,6 +6,7 @@
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "concurrency/transaction_manager.hpp"
 #include "expression/expression_functional.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
@@ -16,12 +17,15 @@
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
 #include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
 #include "optimizer/strategy/chunk_pruning_rule.hpp"
 #include "optimizer/strategy/strategy_base_test.hpp"
 #include "statistics/column_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/value_segment.hpp"
 
 #include "utils/assert.hpp"
 
@@ -86,14 +90,17 @@ TEST_F(ChunkPruningTest, BetweenPruningTest) {
 }
 
 TEST_F(ChunkPruningTest, NoStatisticsAvailable) {
-  auto table = StorageManager::get().get_table("uncompressed");
-  auto chunk = table->get_chunk(ChunkID(0));
-  EXPECT_FALSE(chunk->statistics());
+  // Zone maps are only created for chunks that the table appends itself, not for chunks built from given segments
+  auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 10u, UseMvcc::Yes);
+  table->append_chunk({std::make_shared<ValueSegment<int32_t>>(pmr_concurrent_vector<int32_t>{12345, 123})});
+  StorageManager::get().add_table("no_statistics", table);
+  EXPECT_FALSE(table->get_chunk(ChunkID(0))->statistics());
 
-  auto stored_table_node = std::make_shared<StoredTableNode>("uncompressed");
+  auto stored_table_node = std::make_shared<StoredTableNode>("no_statistics");
 
   auto predicate_node =
-      std::make_shared<PredicateNode>(greater_than_(LQPColumnReference(stored_table_node, ColumnID{0}), 200));
+      std::make_shared<PredicateNode>(greater_than_(LQPColumnReference(stored_table_node, ColumnID{0}), 20000));
   predicate_node->set_left_input(stored_table_node);
 
   auto pruned = StrategyBaseTest::apply_rule(_rule, predicate_node);
@@ -104,6 +111,114 @@ TEST_F(ChunkPruningTest, NoStatisticsAvailable) {
   EXPECT_EQ(excluded, expected);
 }
 
+TEST_F(ChunkPruningTest, MutableChunkPruningTest) {
+  auto table = StorageManager::get().get_table("uncompressed");
+  auto chunk = table->get_chunk(ChunkID(0));
+  EXPECT_TRUE(chunk->is_mutable());
+  EXPECT_TRUE(chunk->statistics());
+
+  // The zone maps of the mutable chunk cover a in [12, 12345]
+  for (const auto& [value, expected] : {std::pair{200, std::vector<ChunkID>{}},
+                                        std::pair{20000, std::vector<ChunkID>{ChunkID{0}}}}) {
+    auto stored_table_node = std::make_shared<StoredTableNode>("uncompressed");
+
+    auto predicate_node =
+        std::make_shared<PredicateNode>(greater_than_(LQPColumnReference(stored_table_node, ColumnID{0}), value));
+    predicate_node->set_left_input(stored_table_node);
+
+    auto pruned = StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+    EXPECT_EQ(pruned, predicate_node);
+    std::vector<ChunkID> excluded = stored_table_node->excluded_chunk_ids();
+    EXPECT_EQ(excluded, expected);
+
+    // The statistics version is recorded for pruned mutable chunks only
+    EXPECT_EQ(stored_table_node->excluded_chunk_statistics_versions().size(), expected.size());
+  }
+}
+
+TEST_F(ChunkPruningTest, InsertWidensZoneMaps) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("uncompressed");
+
+  auto predicate_node =
+      std::make_shared<PredicateNode>(greater_than_(LQPColumnReference(stored_table_node, ColumnID{0}), 20000));
+  predicate_node->set_left_input(stored_table_node);
+
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+  EXPECT_EQ(stored_table_node->excluded_chunk_ids(), std::vector<ChunkID>{ChunkID{0}});
+  const auto get_table = LQPTranslator{}.translate_node(stored_table_node);
+
+  // Insert a row that matches the predicate into the pruned chunk
+  auto values_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Float}}, TableType::Data, 10u);
+  values_table->append({30000, 1.0f});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_table);
+  table_wrapper->execute();
+  const auto insert = std::make_shared<Insert>("uncompressed", table_wrapper);
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+  transaction_context->commit();
+
+  // The cached plan must not rely on the pruning anymore
+  get_table->execute();
+  EXPECT_EQ(get_table->get_output()->row_count(), 5u);
+
+  // A new plan does not prune the chunk either
+  auto new_stored_table_node = std::make_shared<StoredTableNode>("uncompressed");
+  auto new_predicate_node =
+      std::make_shared<PredicateNode>(greater_than_(LQPColumnReference(new_stored_table_node, ColumnID{0}), 20000));
+  new_predicate_node->set_left_input(new_stored_table_node);
+
+  StrategyBaseTest::apply_rule(_rule, new_predicate_node);
+  EXPECT_TRUE(new_stored_table_node->excluded_chunk_ids().empty());
+}
+
+TEST_F(ChunkPruningTest, ParameterPruningTest) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("compressed");
+  const auto column_a = LQPColumnReference(stored_table_node, ColumnID{0});
+
+  auto predicate_node =
+      std::make_shared<PredicateNode>(greater_than_(column_a, correlated_parameter_(ParameterID{0}, column_a)));
+  predicate_node->set_left_input(stored_table_node);
+
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  // The value of the parameter is unknown during optimization, so the predicate is passed on to GetTable
+  EXPECT_TRUE(stored_table_node->excluded_chunk_ids().empty());
+  const auto expected_predicates =
+      std::vector<OperatorScanPredicate>{{ColumnID{0}, PredicateCondition::GreaterThan, ParameterID{0}}};
+  ASSERT_TRUE(stored_table_node->parameter_pruning_predicates());
+  EXPECT_EQ(*stored_table_node->parameter_pruning_predicates(), expected_predicates);
+
+  const auto get_table = LQPTranslator{}.translate_node(stored_table_node);
+  get_table->set_parameters({{ParameterID{0}, AllTypeVariant{200}}});
+  get_table->execute();
+  EXPECT_EQ(get_table->get_output()->chunk_count(), 1u);
+}
+
+TEST_F(ChunkPruningTest, ParameterPruningIntersectionTest) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("compressed");
+  const auto column_a = LQPColumnReference(stored_table_node, ColumnID{0});
+
+  // The first chain has no parameter predicate, so the parameter predicate of the second chain must not be used
+  auto predicate_node_0 = std::make_shared<PredicateNode>(less_than_(column_a, 10));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto predicate_node_1 =
+      std::make_shared<PredicateNode>(greater_than_(column_a, correlated_parameter_(ParameterID{0}, column_a)));
+  predicate_node_1->set_left_input(stored_table_node);
+
+  auto union_node = std::make_shared<UnionNode>(UnionMode::Positions);
+  union_node->set_left_input(predicate_node_0);
+  union_node->set_right_input(predicate_node_1);
+
+  StrategyBaseTest::apply_rule(_rule, union_node);
+
+  ASSERT_TRUE(stored_table_node->parameter_pruning_predicates());
+  EXPECT_TRUE(stored_table_node->parameter_pruning_predicates()->empty());
+}
+
 TEST_F(ChunkPruningTest, TwoOperatorPruningTest) {
   auto stored_table_node = std::make_shared<StoredTableNode>("compressed");
 
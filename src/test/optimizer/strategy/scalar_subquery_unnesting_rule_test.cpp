@@ -0,0 +1,201 @@
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/scalar_subquery_unnesting_rule.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class ScalarSubqueryUnnestingRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_int2.tbl"));
+    StorageManager::get().add_table("table_b", load_table("resources/test_data/tbl/int_int3.tbl"));
+
+    node_table_a = StoredTableNode::make("table_a");
+    node_table_a_col_a = node_table_a->get_column("a");
+    node_table_a_col_b = node_table_a->get_column("b");
+
+    node_table_b = StoredTableNode::make("table_b");
+    node_table_b_col_a = node_table_b->get_column("a");
+    node_table_b_col_b = node_table_b->get_column("b");
+
+    _rule = std::make_shared<ScalarSubqueryUnnestingRule>();
+  }
+
+  std::shared_ptr<ScalarSubqueryUnnestingRule> _rule;
+
+  std::shared_ptr<StoredTableNode> node_table_a, node_table_b;
+  LQPColumnReference node_table_a_col_a, node_table_a_col_b, node_table_b_col_a, node_table_b_col_b;
+};
+
+TEST_F(ScalarSubqueryUnnestingRuleTest, AggregateWithProjection) {
+  // SELECT * FROM table_a WHERE b > (SELECT 2 * AVG(table_b.b) FROM table_b WHERE table_b.a = table_a.a)
+  const auto parameter = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+
+  // clang-format off
+  const auto subquery_lqp =
+  ProjectionNode::make(expression_vector(mul_(2, avg_(node_table_b_col_b))),
+    AggregateNode::make(expression_vector(), expression_vector(avg_(node_table_b_col_b)),
+      PredicateNode::make(equals_(node_table_b_col_a, parameter),
+        ValidateNode::make(
+          node_table_b))));
+
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(greater_than_(node_table_a_col_b, subquery),
+    node_table_a);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(node_table_a_col_a, node_table_a_col_b),
+    PredicateNode::make(greater_than_(node_table_a_col_b, mul_(2, avg_(node_table_b_col_b))),
+      JoinNode::make(JoinMode::Inner, equals_(node_table_a_col_a, node_table_b_col_a),
+        node_table_a,
+        ProjectionNode::make(expression_vector(node_table_b_col_a, mul_(2, avg_(node_table_b_col_b))),
+          AggregateNode::make(expression_vector(node_table_b_col_a), expression_vector(avg_(node_table_b_col_b)),
+            ValidateNode::make(
+              node_table_b))))));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(ScalarSubqueryUnnestingRuleTest, MultipleParametersAndSubqueryOnTheLeft) {
+  // SELECT * FROM table_a WHERE (SELECT MIN(table_b.b) FROM table_b WHERE table_b.a = table_a.a
+  //                              AND table_a.b = table_b.b AND table_b.b > 3) = table_a.b
+  const auto parameter_a = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+  const auto parameter_b = correlated_parameter_(ParameterID{1}, node_table_a_col_b);
+
+  // clang-format off
+  const auto subquery_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(min_(node_table_b_col_b)),
+    PredicateNode::make(equals_(node_table_b_col_a, parameter_a),
+      PredicateNode::make(greater_than_(node_table_b_col_b, 3),
+        PredicateNode::make(equals_(parameter_b, node_table_b_col_b),
+          node_table_b))));
+
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a),
+                                      std::make_pair(ParameterID{1}, node_table_a_col_b));
+
+  const auto input_lqp =
+  PredicateNode::make(equals_(subquery, node_table_a_col_b),
+    node_table_a);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(node_table_a_col_a, node_table_a_col_b),
+    PredicateNode::make(equals_(min_(node_table_b_col_b), node_table_a_col_b),
+      JoinNode::make(JoinMode::Inner, expression_vector(equals_(node_table_a_col_a, node_table_b_col_a), equals_(node_table_a_col_b, node_table_b_col_b)),  // NOLINT
+        node_table_a,
+        AggregateNode::make(expression_vector(node_table_b_col_a, node_table_b_col_b), expression_vector(min_(node_table_b_col_b)),  // NOLINT
+          PredicateNode::make(greater_than_(node_table_b_col_b, 3),
+            node_table_b)))));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(ScalarSubqueryUnnestingRuleTest, NoRewriteOfCount) {
+  // COUNT returns 0 for outer rows without a match, so these rows would be lost in a join
+  const auto parameter = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+
+  // clang-format off
+  const auto subquery_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(count_(node_table_b_col_b)),
+    PredicateNode::make(equals_(node_table_b_col_a, parameter),
+      node_table_b));
+
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(less_than_(node_table_a_col_b, subquery),
+    node_table_a);
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp->deep_copy());
+
+  EXPECT_LQP_EQ(actual_lqp, input_lqp);
+}
+
+TEST_F(ScalarSubqueryUnnestingRuleTest, NoRewriteOfNonEqualsCorrelation) {
+  const auto parameter = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+
+  // clang-format off
+  const auto subquery_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(max_(node_table_b_col_b)),
+    PredicateNode::make(less_than_(node_table_b_col_a, parameter),
+      node_table_b));
+
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(less_than_(node_table_a_col_b, subquery),
+    node_table_a);
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp->deep_copy());
+
+  EXPECT_LQP_EQ(actual_lqp, input_lqp);
+}
+
+TEST_F(ScalarSubqueryUnnestingRuleTest, NoRewriteOfParameterUsedTwice) {
+  const auto parameter = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+
+  // clang-format off
+  const auto subquery_lqp =
+  ProjectionNode::make(expression_vector(add_(sum_(node_table_b_col_b), parameter)),
+    AggregateNode::make(expression_vector(), expression_vector(sum_(node_table_b_col_b)),
+      PredicateNode::make(equals_(node_table_b_col_a, parameter),
+        node_table_b)));
+
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(less_than_(node_table_a_col_b, subquery),
+    node_table_a);
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp->deep_copy());
+
+  EXPECT_LQP_EQ(actual_lqp, input_lqp);
+}
+
+TEST_F(ScalarSubqueryUnnestingRuleTest, NoRewriteOfSubqueryInDisjunction) {
+  const auto parameter = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+
+  // clang-format off
+  const auto subquery_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(sum_(node_table_b_col_b)),
+    PredicateNode::make(equals_(node_table_b_col_a, parameter),
+      node_table_b));
+
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(or_(less_than_(node_table_a_col_b, subquery), equals_(node_table_a_col_a, 5)),
+    node_table_a);
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp->deep_copy());
+
+  EXPECT_LQP_EQ(actual_lqp, input_lqp);
+}
+
+}  // namespace opossum
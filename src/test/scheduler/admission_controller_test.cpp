@@ -0,0 +1,144 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/admission_controller.hpp"
+
+namespace opossum {
+
+class AdmissionControllerTest : public BaseTest {
+ protected:
+  // Waits until the given number of queries is queued
+  static void wait_for_queued_queries(const size_t queued_query_count) {
+    while (AdmissionController::get().queued_query_count() != queued_query_count) {
+      std::this_thread::yield();
+    }
+  }
+};
+
+TEST_F(AdmissionControllerTest, AdmitWithoutLimit) {
+  auto& admission_controller = AdmissionController::get();
+  EXPECT_FALSE(admission_controller.memory_limit());
+
+  {
+    const auto admission_a = admission_controller.admit(1'000'000'000'000);
+    const auto admission_b = admission_controller.admit(1'000'000'000'000);
+    EXPECT_FALSE(admission_b->memory_budget());
+    EXPECT_EQ(admission_controller.admitted_query_count(), 2u);
+    EXPECT_EQ(admission_controller.reserved_bytes(), 2'000'000'000'000u);
+  }
+
+  EXPECT_EQ(admission_controller.admitted_query_count(), 0u);
+  EXPECT_EQ(admission_controller.reserved_bytes(), 0u);
+}
+
+TEST_F(AdmissionControllerTest, MemoryBudget) {
+  auto& admission_controller = AdmissionController::get();
+  admission_controller.set_memory_limit(100);
+
+  // Queries receive the memory that is not reserved for other queries as their budget
+  const auto admission_a = admission_controller.admit(30);
+  EXPECT_EQ(admission_a->memory_budget(), 100u);
+  const auto admission_b = admission_controller.admit(50);
+  EXPECT_EQ(admission_b->memory_budget(), 70u);
+  EXPECT_EQ(admission_controller.reserved_bytes(), 80u);
+}
+
+TEST_F(AdmissionControllerTest, QueueQueriesExceedingLimit) {
+  auto& admission_controller = AdmissionController::get();
+  admission_controller.set_memory_limit(100);
+
+  auto admission_a = admission_controller.admit(60);
+
+  auto admitted_b = std::atomic_bool{false};
+  auto admitted_c = std::atomic_bool{false};
+  auto threads = std::vector<std::thread>{};
+  threads.emplace_back([&]() {
+    const auto admission_b = admission_controller.admit(60);
+    admitted_b = true;
+    EXPECT_EQ(admission_b->memory_budget(), 100u);
+  });
+  wait_for_queued_queries(1);
+
+  // Queries are admitted in order. Thus, C is queued behind B, even though it would fit.
+  threads.emplace_back([&]() {
+    const auto admission_c = admission_controller.admit(10);
+    admitted_c = true;
+  });
+  wait_for_queued_queries(2);
+  EXPECT_FALSE(admitted_b);
+  EXPECT_FALSE(admitted_c);
+
+  admission_a.reset();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_TRUE(admitted_b);
+  EXPECT_TRUE(admitted_c);
+  EXPECT_EQ(admission_controller.queued_query_count(), 0u);
+  EXPECT_EQ(admission_controller.reserved_bytes(), 0u);
+}
+
+TEST_F(AdmissionControllerTest, AdmitAsync) {
+  auto& admission_controller = AdmissionController::get();
+  admission_controller.set_memory_limit(100);
+
+  auto admission_a = std::unique_ptr<AdmissionController::Admission>{};
+  admission_controller.admit_async(60, [&](auto admission) { admission_a = std::move(admission); });
+  ASSERT_TRUE(admission_a);
+
+  // The request does not block, the callback is called by the thread that releases the memory
+  auto admission_b = std::unique_ptr<AdmissionController::Admission>{};
+  admission_controller.admit_async(60, [&](auto admission) { admission_b = std::move(admission); });
+  EXPECT_FALSE(admission_b);
+  EXPECT_EQ(admission_controller.queued_query_count(), 1u);
+
+  admission_a.reset();
+  ASSERT_TRUE(admission_b);
+  EXPECT_EQ(admission_b->memory_budget(), 100u);
+  EXPECT_EQ(admission_controller.queued_query_count(), 0u);
+}
+
+TEST_F(AdmissionControllerTest, AdmitOversizedQueryAlone) {
+  auto& admission_controller = AdmissionController::get();
+  admission_controller.set_memory_limit(100);
+
+  // A query that exceeds the limit on its own is admitted if no other query is running
+  auto admission_a = admission_controller.admit(1'000);
+  EXPECT_EQ(admission_a->memory_budget(), 100u);
+
+  auto admitted_b = std::atomic_bool{false};
+  auto thread = std::thread([&]() {
+    const auto admission_b = admission_controller.admit(10);
+    admitted_b = true;
+    EXPECT_EQ(admission_b->memory_budget(), 100u);
+  });
+  wait_for_queued_queries(1);
+  EXPECT_FALSE(admitted_b);
+
+  admission_a.reset();
+  thread.join();
+  EXPECT_TRUE(admitted_b);
+}
+
+TEST_F(AdmissionControllerTest, RaiseLimit) {
+  auto& admission_controller = AdmissionController::get();
+  admission_controller.set_memory_limit(100);
+
+  const auto admission_a = admission_controller.admit(80);
+
+  auto thread = std::thread([&]() { admission_controller.admit(80); });
+  wait_for_queued_queries(1);
+
+  // Raising the limit admits queued queries
+  admission_controller.set_memory_limit(200);
+  thread.join();
+  EXPECT_EQ(admission_controller.queued_query_count(), 0u);
+}
+
+}  // namespace opossum
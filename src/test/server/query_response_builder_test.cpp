@@ -0,0 +1,134 @@
+#include <cstring>
+
+#include <base_test.hpp>
+#include <server/postgres_wire_handler.hpp>
+#include <server/query_response_builder.hpp>
+
+namespace opossum {
+
+class QueryResponseBuilderTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true},
+                                                            {"b", DataType::Long, false},
+                                                            {"c", DataType::Double, false},
+                                                            {"d", DataType::String, false}},
+                                     TableType::Data);
+    _table->append({int32_t{-42}, int64_t{1} << 40, 1.5, pmr_string{"foo"}});
+    _table->append({NullValue{}, int64_t{7}, -2.0, pmr_string{""}});
+  }
+
+  // Reads the next DataRow message from the packet. NULL values are returned as std::nullopt.
+  std::vector<std::optional<ByteBuffer>> _read_data_row(const InputPacket& packet) {
+    EXPECT_EQ(PostgresWireHandler::read_value<NetworkMessageType>(packet), NetworkMessageType::DataRow);
+    const auto message_begin = packet.offset;
+    const auto length = ntohl(PostgresWireHandler::read_value<uint32_t>(packet));
+    const auto column_count = ntohs(PostgresWireHandler::read_value<uint16_t>(packet));
+
+    auto values = std::vector<std::optional<ByteBuffer>>{};
+    for (auto column_id = 0; column_id < column_count; ++column_id) {
+      const auto value_length = static_cast<int32_t>(ntohl(PostgresWireHandler::read_value<uint32_t>(packet)));
+      if (value_length == -1) {
+        values.emplace_back(std::nullopt);
+      } else {
+        values.emplace_back(PostgresWireHandler::read_values<char>(packet, value_length));
+      }
+    }
+
+    // The length of the message includes the length field itself, but not the message type
+    EXPECT_EQ(static_cast<uint32_t>(std::distance(message_begin, packet.offset)), length);
+    return values;
+  }
+
+  static ByteBuffer _to_bytes(const std::string& string) { return ByteBuffer(string.begin(), string.end()); }
+
+  template <typename T>
+  static T _from_network_bytes(const ByteBuffer& bytes) {
+    EXPECT_EQ(bytes.size(), sizeof(T));
+    auto reversed = ByteBuffer(bytes.rbegin(), bytes.rend());
+    auto value = T{};
+    std::memcpy(&value, reversed.data(), sizeof(T));
+    return value;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(QueryResponseBuilderTest, BuildResultFormats) {
+  EXPECT_EQ(QueryResponseBuilder::build_result_formats({}, 2),
+            std::vector<FormatCode>({FormatCode::Text, FormatCode::Text}));
+  EXPECT_EQ(QueryResponseBuilder::build_result_formats({FormatCode::Binary}, 2),
+            std::vector<FormatCode>({FormatCode::Binary, FormatCode::Binary}));
+  EXPECT_EQ(QueryResponseBuilder::build_result_formats({FormatCode::Binary, FormatCode::Text}, 2),
+            std::vector<FormatCode>({FormatCode::Binary, FormatCode::Text}));
+  EXPECT_THROW(QueryResponseBuilder::build_result_formats({FormatCode::Binary, FormatCode::Text}, 3), std::exception);
+}
+
+TEST_F(QueryResponseBuilderTest, BuildRowDescription) {
+  const auto result_formats = std::vector<FormatCode>{FormatCode::Binary, FormatCode::Binary, FormatCode::Text,
+                                                      FormatCode::Text};
+  const auto row_description = QueryResponseBuilder::build_row_description(_table, result_formats);
+
+  ASSERT_EQ(row_description.size(), 4u);
+  EXPECT_EQ(row_description[0].column_name, "a");
+  EXPECT_EQ(row_description[0].object_id, 23u);
+  EXPECT_EQ(row_description[0].format_code, FormatCode::Binary);
+  EXPECT_EQ(row_description[3].object_id, 25u);
+  EXPECT_EQ(row_description[3].format_code, FormatCode::Text);
+}
+
+TEST_F(QueryResponseBuilderTest, BuildDataRowsText) {
+  const auto result_formats = QueryResponseBuilder::build_result_formats({}, _table->column_count());
+
+  OutputPacket output_packet;
+  QueryResponseBuilder::build_data_rows(*_table->get_chunk(ChunkID{0}), result_formats, output_packet);
+
+  InputPacket input_packet;
+  input_packet.data = output_packet.data;
+  input_packet.offset = input_packet.data.cbegin();
+
+  const auto first_row = _read_data_row(input_packet);
+  ASSERT_EQ(first_row.size(), 4u);
+  EXPECT_EQ(*first_row[0], _to_bytes("-42"));
+  EXPECT_EQ(*first_row[1], _to_bytes("1099511627776"));
+  EXPECT_EQ(*first_row[2], _to_bytes(std::to_string(1.5)));
+  EXPECT_EQ(*first_row[3], _to_bytes("foo"));
+
+  const auto second_row = _read_data_row(input_packet);
+  ASSERT_EQ(second_row.size(), 4u);
+  EXPECT_FALSE(second_row[0]);
+  EXPECT_EQ(*second_row[1], _to_bytes("7"));
+  EXPECT_EQ(*second_row[2], _to_bytes(std::to_string(-2.0)));
+  ASSERT_TRUE(second_row[3]);
+  EXPECT_TRUE(second_row[3]->empty());
+
+  EXPECT_EQ(input_packet.offset, input_packet.data.cend());
+}
+
+TEST_F(QueryResponseBuilderTest, BuildDataRowsBinary) {
+  const auto result_formats = QueryResponseBuilder::build_result_formats({FormatCode::Binary}, _table->column_count());
+
+  OutputPacket output_packet;
+  QueryResponseBuilder::build_data_rows(*_table->get_chunk(ChunkID{0}), result_formats, output_packet);
+
+  InputPacket input_packet;
+  input_packet.data = output_packet.data;
+  input_packet.offset = input_packet.data.cbegin();
+
+  const auto first_row = _read_data_row(input_packet);
+  ASSERT_EQ(first_row.size(), 4u);
+  EXPECT_EQ(_from_network_bytes<int32_t>(*first_row[0]), -42);
+  EXPECT_EQ(_from_network_bytes<int64_t>(*first_row[1]), int64_t{1} << 40);
+  EXPECT_EQ(_from_network_bytes<double>(*first_row[2]), 1.5);
+  EXPECT_EQ(*first_row[3], _to_bytes("foo"));
+
+  const auto second_row = _read_data_row(input_packet);
+  ASSERT_EQ(second_row.size(), 4u);
+  EXPECT_FALSE(second_row[0]);
+  EXPECT_EQ(_from_network_bytes<int64_t>(*second_row[1]), 7);
+  EXPECT_EQ(_from_network_bytes<double>(*second_row[2]), -2.0);
+
+  EXPECT_EQ(input_packet.offset, input_packet.data.cend());
+}
+
+}  // namespace opossum
@@ -76,7 +76,7 @@ class ServerSessionTest : public BaseTest {
     ON_CALL(*_connection, send_row_description(_)).WillByDefault(Invoke([](const std::vector<ColumnDescription>&) {
       return boost::make_ready_future();
     }));
-    ON_CALL(*_connection, send_data_row(_)).WillByDefault(Invoke([](const std::vector<std::string>&) {
+    ON_CALL(*_connection, send_data_rows(_)).WillByDefault(Invoke([](const std::shared_ptr<OutputPacket>&) {
       return boost::make_ready_future();
     }));
     ON_CALL(*_connection, send_command_complete(_)).WillByDefault(Invoke([](const std::string&) {
@@ -229,8 +229,8 @@ TEST_F(ServerSessionTest, SessionExecutesSimpleQueryCommand) {
   // It sends the result schema...
   EXPECT_CALL(*_connection, send_row_description(_));
 
-  // ... as well as the row data (one message per row)
-  EXPECT_CALL(*_connection, send_data_row(_)).Times(3);
+  // ... as well as the row data (one batch of DataRow messages per chunk)
+  EXPECT_CALL(*_connection, send_data_rows(_)).Times(1);
 
   // Finally, the session completes the command...
   EXPECT_CALL(*_connection, send_command_complete(_));
@@ -296,8 +296,8 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerPreparedStatementTask>>()))
       .WillOnce(Return(ByMove(boost::make_ready_future(sql_pipeline->get_result_table()))));
 
-  // It sends the row data (one message per row)
-  EXPECT_CALL(*_connection, send_data_row(_)).Times(3);
+  // It sends the row data (one batch of DataRow messages per chunk)
+  EXPECT_CALL(*_connection, send_data_rows(_)).Times(1);
 
   // ... and completes the command
   EXPECT_CALL(*_connection, send_command_complete(_));
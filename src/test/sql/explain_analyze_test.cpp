@@ -0,0 +1,102 @@
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "operators/join_hash.hpp"
+#include "sql/explain_analyze.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class ExplainAnalyzeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+    StorageManager::get().add_table("table_b", load_table("resources/test_data/tbl/int_float2.tbl", 2));
+  }
+};
+
+TEST_F(ExplainAnalyzeTest, RemovePrefix) {
+  EXPECT_EQ(remove_explain_analyze_prefix("EXPLAIN ANALYZE SELECT * FROM table_a"), "SELECT * FROM table_a");
+  EXPECT_EQ(remove_explain_analyze_prefix(" explain  Analyze\nSELECT 1"), "SELECT 1");
+  EXPECT_FALSE(remove_explain_analyze_prefix("SELECT * FROM table_a"));
+  EXPECT_FALSE(remove_explain_analyze_prefix("EXPLAIN SELECT * FROM table_a"));
+  EXPECT_FALSE(remove_explain_analyze_prefix("SELECT 'EXPLAIN ANALYZE '"));
+}
+
+TEST_F(ExplainAnalyzeTest, DescribeExecutedPlan) {
+  const auto query = "SELECT * FROM table_a JOIN table_b ON table_a.a = table_b.a WHERE table_a.a > 1000";
+  auto pipeline_statement = SQLPipelineBuilder{std::string{"EXPLAIN ANALYZE "} + query}.create_pipeline_statement();
+  const auto explanation = pipeline_statement.get_result_table();
+  const auto& physical_plan = pipeline_statement.get_physical_plan();
+
+  ASSERT_TRUE(explanation);
+  EXPECT_EQ(explanation->column_names().front(), "operator_id");
+
+  auto operator_count = size_t{0};
+  auto join_id = std::optional<int32_t>{};
+  for (auto row_id = size_t{0}; row_id < explanation->row_count(); ++row_id) {
+    ++operator_count;
+    const auto operator_description = explanation->get_value<pmr_string>(ColumnID{3}, row_id);
+    if (operator_description.find("JoinHash") != pmr_string::npos) {
+      join_id = explanation->get_value<int32_t>(ColumnID{0}, row_id);
+
+      // 12345 is the only value of table_a.a > 1000 that occurs in table_b, where it occurs twice
+      EXPECT_EQ(explanation->get_value<int64_t>(ColumnID{7}, row_id), 2);
+      EXPECT_NE(explanation->get_value<pmr_string>(ColumnID{12}, row_id).find("Probe side"), pmr_string::npos);
+
+      // The hash table is allocated through the memory resource of the join
+      EXPECT_GT(explanation->get_value<int64_t>(ColumnID{11}, row_id), 0);
+    }
+  }
+
+  // The root operator is listed first
+  EXPECT_EQ(explanation->get_value<pmr_string>(ColumnID{3}, 0), pmr_string{physical_plan->description()});
+  EXPECT_EQ(explanation->get_value<int64_t>(ColumnID{7}, 0),
+            static_cast<int64_t>(physical_plan->get_output()->row_count()));
+  EXPECT_TRUE(join_id);
+  EXPECT_GT(operator_count, 3u);
+
+  // Explained statements keep their intermediate results, so they are not cached. The result is the same as without
+  // EXPLAIN ANALYZE.
+  EXPECT_FALSE(SQLPhysicalPlanCache::get().has(query));
+  const auto result = SQLPipelineBuilder{query}.create_pipeline_statement().get_result_table();
+  EXPECT_TABLE_EQ_UNORDERED(physical_plan->get_output(), result);
+}
+
+TEST_F(ExplainAnalyzeTest, EstimatedRows) {
+  auto pipeline_statement =
+      SQLPipelineBuilder{"EXPLAIN ANALYZE SELECT * FROM table_a WHERE a = 123"}.create_pipeline_statement();
+  const auto explanation = pipeline_statement.get_result_table();
+
+  // The estimate of the table scan is based on the statistics of table_a, the estimate of the GetTable is exact
+  auto found_estimates = size_t{0};
+  for (auto row_id = size_t{0}; row_id < explanation->row_count(); ++row_id) {
+    const auto estimated_rows =
+        (*explanation->get_chunk(ChunkID{0})->get_segment(ColumnID{6}))[static_cast<ChunkOffset>(row_id)];
+    if (variant_is_null(estimated_rows)) continue;
+    ++found_estimates;
+
+    const auto operator_description = explanation->get_value<pmr_string>(ColumnID{3}, row_id);
+    if (operator_description.find("GetTable") != pmr_string::npos) {
+      EXPECT_FLOAT_EQ(boost::get<float>(estimated_rows), 3.0f);
+    }
+  }
+  EXPECT_GE(found_estimates, 2u);
+}
+
+TEST_F(ExplainAnalyzeTest, StatementWithoutOutput) {
+  auto pipeline_statement =
+      SQLPipelineBuilder{"EXPLAIN ANALYZE INSERT INTO table_a VALUES (1, 2.0)"}.create_pipeline_statement();
+  const auto explanation = pipeline_statement.get_result_table();
+
+  ASSERT_TRUE(explanation);
+  EXPECT_GT(explanation->row_count(), 0u);
+  EXPECT_EQ(StorageManager::get().get_table("table_a")->row_count(), 4u);
+}
+
+}  // namespace opossum
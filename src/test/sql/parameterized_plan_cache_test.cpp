@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "SQLParser.h"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "sql/parameterized_plan_cache.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "sql/sql_translator.hpp"
+#include "storage/prepared_plan.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class ParameterizedPlanCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  }
+
+  static std::shared_ptr<AbstractLQPNode> _unoptimized_lqp(const std::string& query) {
+    auto pipeline_statement = SQLPipelineBuilder{query}.disable_mvcc().create_pipeline_statement();
+    return pipeline_statement.get_unoptimized_logical_plan();
+  }
+
+  static std::shared_ptr<PreparedPlan> _prepared_plan(const std::string& query) {
+    auto parser_result = hsql::SQLParserResult{};
+    hsql::SQLParser::parse(query, &parser_result);
+
+    auto sql_translator = SQLTranslator{UseMvcc::No};
+    const auto lqps = sql_translator.translate_parser_result(parser_result);
+    return std::make_shared<PreparedPlan>(lqps.at(0), sql_translator.parameter_ids_of_value_placeholders());
+  }
+
+  static std::shared_ptr<const Table> _execute(const std::string& query, const bool parameterize, bool& cache_hit) {
+    auto builder = SQLPipelineBuilder{query};
+    if (parameterize) builder.with_parameterized_literals();
+
+    auto pipeline_statement = builder.create_pipeline_statement();
+    const auto result_table = pipeline_statement.get_result_table();
+    cache_hit = pipeline_statement.metrics()->query_plan_cache_hit;
+    return result_table;
+  }
+};
+
+TEST_F(ParameterizedPlanCacheTest, ParameterizeLQP) {
+  const auto lqp = _unoptimized_lqp("SELECT a FROM table_a WHERE a > 5 AND b BETWEEN 1.5 AND 2.5");
+  const auto parameterized_lqp = parameterize_lqp(lqp);
+  ASSERT_TRUE(parameterized_lqp);
+
+  // The original LQP is not modified
+  EXPECT_LQP_EQ(lqp, _unoptimized_lqp("SELECT a FROM table_a WHERE a > 5 AND b BETWEEN 1.5 AND 2.5"));
+
+  auto values = std::vector<AllTypeVariant>{};
+  for (const auto& [parameter_id, value] : parameterized_lqp->parameters) {
+    values.emplace_back(value);
+  }
+  std::sort(values.begin(), values.end());
+  EXPECT_EQ(values, std::vector<AllTypeVariant>({AllTypeVariant{5}, AllTypeVariant{1.5}, AllTypeVariant{2.5}}));
+}
+
+TEST_F(ParameterizedPlanCacheTest, ParameterizeLQPUnsupported) {
+  // Nothing to parameterize
+  EXPECT_FALSE(parameterize_lqp(_unoptimized_lqp("SELECT a FROM table_a")));
+  EXPECT_FALSE(parameterize_lqp(_unoptimized_lqp("SELECT a FROM table_a WHERE a IS NULL")));
+  EXPECT_FALSE(parameterize_lqp(_unoptimized_lqp("SELECT a FROM table_a WHERE a > b")));
+
+  // Subqueries
+  EXPECT_FALSE(parameterize_lqp(_unoptimized_lqp("SELECT a FROM table_a WHERE a > (SELECT MIN(a) FROM table_a)")));
+
+  // Views need to keep their literals
+  EXPECT_FALSE(parameterize_lqp(_unoptimized_lqp("CREATE VIEW v AS SELECT a FROM table_a WHERE a > 5")));
+}
+
+TEST_F(ParameterizedPlanCacheTest, CacheKey) {
+  const auto key = [&](const std::string& query) {
+    return ParameterizedPlanCacheKey{parameterize_lqp(_unoptimized_lqp(query))->lqp};
+  };
+
+  const auto key_a = key("SELECT a FROM table_a WHERE a > 5");
+  const auto key_b = key("SELECT a FROM table_a WHERE a > 1234");
+  const auto key_c = key("SELECT a FROM table_a WHERE a < 5");
+  const auto key_d = key("SELECT a FROM table_a WHERE a > 5.0");
+
+  EXPECT_TRUE(key_a == key_b);
+  EXPECT_EQ(std::hash<ParameterizedPlanCacheKey>{}(key_a), std::hash<ParameterizedPlanCacheKey>{}(key_b));
+  EXPECT_FALSE(key_a == key_c);
+
+  // The data type of the parameter is part of the key
+  EXPECT_FALSE(key_a == key_d);
+}
+
+TEST_F(ParameterizedPlanCacheTest, SharePlanBetweenLiterals) {
+  auto cache_hit = false;
+
+  const auto first_result = _execute("SELECT * FROM table_a WHERE a > 200 AND a < 20000", true, cache_hit);
+  EXPECT_FALSE(cache_hit);
+  EXPECT_EQ(SQLParameterizedPlanCache::get().size(), 1u);
+
+  const auto second_result = _execute("SELECT * FROM table_a WHERE a > 1 AND a < 1000", true, cache_hit);
+  EXPECT_TRUE(cache_hit);
+  EXPECT_EQ(SQLParameterizedPlanCache::get().size(), 1u);
+
+  // The results are the same as without parameterization
+  SQLPhysicalPlanCache::get().clear();
+  const auto first_expected_result = _execute("SELECT * FROM table_a WHERE a > 200 AND a < 20000", false, cache_hit);
+  const auto second_expected_result = _execute("SELECT * FROM table_a WHERE a > 1 AND a < 1000", false, cache_hit);
+  EXPECT_TABLE_EQ_UNORDERED(first_result, first_expected_result);
+  EXPECT_TABLE_EQ_UNORDERED(second_result, second_expected_result);
+  EXPECT_EQ(second_result->row_count(), 1u);
+}
+
+TEST_F(ParameterizedPlanCacheTest, ParameterizePreparedPlan) {
+  const auto prepared_plan = _prepared_plan("SELECT a FROM table_a WHERE a > ? AND b < ?");
+
+  const auto values = std::vector<AllTypeVariant>{pmr_string{"123"}, pmr_string{"500"}};
+  const auto parameterized_lqp = parameterize_prepared_plan(*prepared_plan, values);
+  ASSERT_TRUE(parameterized_lqp);
+  EXPECT_EQ(parameterized_lqp->parameters.size(), 2u);
+  EXPECT_EQ(parameterized_lqp->parameters.at(prepared_plan->parameter_ids[0]), AllTypeVariant{pmr_string{"123"}});
+
+  // The LQP does not depend on the values
+  const auto other_parameterized_lqp =
+      parameterize_prepared_plan(*prepared_plan, {AllTypeVariant{pmr_string{"1"}}, AllTypeVariant{pmr_string{"2"}}});
+  EXPECT_LQP_EQ(parameterized_lqp->lqp, other_parameterized_lqp->lqp);
+
+  // NULL values and subqueries are not supported
+  EXPECT_FALSE(parameterize_prepared_plan(*prepared_plan, {AllTypeVariant{pmr_string{"1"}}, NULL_VALUE}));
+  const auto prepared_plan_with_subquery =
+      _prepared_plan("SELECT a FROM table_a WHERE a > (SELECT MIN(a) + ? FROM table_a)");
+  EXPECT_FALSE(parameterize_prepared_plan(*prepared_plan_with_subquery, {AllTypeVariant{pmr_string{"1"}}}));
+}
+
+}  // namespace opossum
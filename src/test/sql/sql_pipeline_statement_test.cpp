@@ -1,5 +1,6 @@
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include "base_test.hpp"
 
@@ -9,9 +10,12 @@
 
 #include "cache/cache.hpp"
 #include "logical_query_plan/join_node.hpp"
+#include "memory/tracking_memory_resource.hpp"
 #include "operators/abstract_join_operator.hpp"
+#include "operators/join_hash.hpp"
 #include "operators/print.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/admission_controller.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
@@ -531,6 +535,67 @@ TEST_F(SQLPipelineStatementTest, GetTimes) {
   EXPECT_GT(metrics->plan_execution_duration, zero_duration);
 }
 
+TEST_F(SQLPipelineStatementTest, TrackMemoryUsage) {
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline_statement();
+  EXPECT_FALSE(sql_pipeline.memory_resource());
+  sql_pipeline.get_result_table();
+
+  const auto& memory_resource = sql_pipeline.memory_resource();
+  ASSERT_TRUE(memory_resource);
+  EXPECT_FALSE(memory_resource->budget());
+  EXPECT_GT(memory_resource->peak_bytes(), 0u);
+  EXPECT_EQ(sql_pipeline.metrics()->peak_memory_bytes, memory_resource->peak_bytes());
+
+  // Each operator has its own memory resource nested below the one of the query
+  auto join_count = size_t{0};
+  for (const auto& task : sql_pipeline.get_tasks()) {
+    const auto& op = task->get_operator();
+    ASSERT_TRUE(op->memory_resource());
+    EXPECT_EQ(op->memory_resource()->parent(), memory_resource.get());
+    EXPECT_EQ(op->performance_data().peak_memory_bytes, op->memory_resource()->peak_bytes());
+
+    if (std::dynamic_pointer_cast<JoinHash>(op)) {
+      ++join_count;
+      EXPECT_GT(op->memory_resource()->peak_bytes(), 0u);
+    }
+  }
+  EXPECT_EQ(join_count, 1u);
+}
+
+TEST_F(SQLPipelineStatementTest, AdmissionControl) {
+  AdmissionController::get().set_memory_limit(1'000'000);
+
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline_statement();
+  const auto& table = sql_pipeline.get_result_table();
+  EXPECT_TABLE_EQ_UNORDERED(table, _join_result);
+
+  // The admitted query receives the whole limit as its budget, as no other query is running
+  EXPECT_GT(sql_pipeline.metrics()->projected_memory_bytes, 0u);
+  EXPECT_EQ(sql_pipeline.memory_resource()->budget(), 1'000'000u);
+  EXPECT_EQ(AdmissionController::get().admitted_query_count(), 0u);
+}
+
+TEST_F(SQLPipelineStatementTest, QueuedQueryDoesNotBlockWorker) {
+  Topology::use_fake_numa_topology(1, 1);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  AdmissionController::get().set_memory_limit(1);
+  auto admission = AdmissionController::get().admit(1);
+
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline_statement();
+  const auto query_task = std::make_shared<JobTask>([&]() { sql_pipeline.get_result_table(); });
+  query_task->schedule();
+  while (AdmissionController::get().queued_query_count() == 0) {
+    std::this_thread::yield();
+  }
+
+  // The only worker executes the query. While the query is queued, the worker can still release the admission.
+  const auto release_task = std::make_shared<JobTask>([&]() { admission.reset(); });
+  release_task->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{query_task, release_task});
+
+  EXPECT_TABLE_EQ_UNORDERED(sql_pipeline.get_result_table(), _join_result);
+}
+
 TEST_F(SQLPipelineStatementTest, ParseErrorDebugMessage) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
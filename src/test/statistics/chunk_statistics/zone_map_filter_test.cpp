@@ -0,0 +1,74 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "statistics/chunk_statistics/zone_map_filter.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ZoneMapFilterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _segment = std::make_shared<ValueSegment<int32_t>>(true);
+    for (const auto& value : {AllTypeVariant{10}, AllTypeVariant{20}, NULL_VALUE, AllTypeVariant{5}}) {
+      _segment->append(value);
+    }
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> _segment;
+};
+
+TEST_F(ZoneMapFilterTest, EmptyZoneMap) {
+  const auto filter = ZoneMapFilter<int32_t>{};
+
+  // Without any rows, no predicate matches
+  EXPECT_TRUE(filter.can_prune(PredicateCondition::Equals, {10}));
+  EXPECT_TRUE(filter.can_prune(PredicateCondition::LessThan, {10}));
+  EXPECT_TRUE(filter.can_prune(PredicateCondition::Between, {0}, AllTypeVariant{100}));
+  EXPECT_TRUE(filter.can_prune(PredicateCondition::IsNull, NULL_VALUE));
+  EXPECT_TRUE(filter.can_prune(PredicateCondition::IsNotNull, NULL_VALUE));
+}
+
+TEST_F(ZoneMapFilterTest, Widen) {
+  auto filter = ZoneMapFilter<int32_t>{};
+
+  EXPECT_TRUE(filter.widen(*_segment, 0, 2));
+  EXPECT_EQ(filter.min(), 10);
+  EXPECT_EQ(filter.max(), 20);
+  EXPECT_EQ(filter.null_count(), 0u);
+
+  // Rows within the bounds do not change the zone map
+  EXPECT_FALSE(filter.widen(*_segment, 1, 2));
+
+  EXPECT_TRUE(filter.widen(*_segment, 2, 4));
+  EXPECT_EQ(filter.min(), 5);
+  EXPECT_EQ(filter.max(), 20);
+  EXPECT_EQ(filter.null_count(), 1u);
+}
+
+TEST_F(ZoneMapFilterTest, CanPrune) {
+  auto filter = ZoneMapFilter<int32_t>{};
+  filter.widen(*_segment, 0, 2);
+
+  EXPECT_TRUE(filter.can_prune(PredicateCondition::Equals, {5}));
+  EXPECT_FALSE(filter.can_prune(PredicateCondition::Equals, {15}));
+  EXPECT_TRUE(filter.can_prune(PredicateCondition::GreaterThan, {20}));
+  EXPECT_FALSE(filter.can_prune(PredicateCondition::GreaterThanEquals, {20}));
+  EXPECT_TRUE(filter.can_prune(PredicateCondition::LessThan, {10}));
+  EXPECT_TRUE(filter.can_prune(PredicateCondition::Between, {21}, AllTypeVariant{30}));
+  EXPECT_FALSE(filter.can_prune(PredicateCondition::Equals, NULL_VALUE));
+
+  // The segment does not contain NULLs yet
+  EXPECT_TRUE(filter.can_prune(PredicateCondition::IsNull, NULL_VALUE));
+  EXPECT_FALSE(filter.can_prune(PredicateCondition::IsNotNull, NULL_VALUE));
+
+  filter.widen(*_segment, 2, 4);
+  EXPECT_FALSE(filter.can_prune(PredicateCondition::Equals, {5}));
+  EXPECT_FALSE(filter.can_prune(PredicateCondition::IsNull, NULL_VALUE));
+}
+
+}  // namespace opossum
@@ -11,6 +11,8 @@
 #include "storage/base_value_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -146,4 +148,47 @@ TEST_F(ChunkEncoderTest, EncodeMultipleChunksUsingSameEncoding) {
   verify_encoding(_table->get_chunk(ChunkID{1u}), unencoded_chunk_spec);
 }
 
+TEST_F(ChunkEncoderTest, ReencodeChunk) {
+  auto types = _table->column_data_types();
+  auto chunk = _table->get_chunk(ChunkID{1u});
+
+  ChunkEncoder::encode_chunk(chunk, types, SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto kept_segment = chunk->get_segment(ColumnID{0u});
+
+  const auto chunk_encoding_spec =
+      ChunkEncodingSpec{{EncodingType::Dictionary}, {EncodingType::RunLength}, {EncodingType::Unencoded}};
+  ChunkEncoder::encode_chunk(chunk, types, chunk_encoding_spec);
+  verify_encoding(chunk, chunk_encoding_spec);
+
+  // Segments that already have the requested encoding are kept
+  EXPECT_EQ(chunk->get_segment(ColumnID{0u}), kept_segment);
+
+  for (auto column_id = ColumnID{0u}; column_id < chunk->column_count(); ++column_id) {
+    const auto& segment = *chunk->get_segment(column_id);
+    for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < chunk->size(); ++chunk_offset) {
+      EXPECT_EQ(segment[chunk_offset], AllTypeVariant{static_cast<int32_t>(5u + chunk_offset)});
+    }
+  }
+}
+
+TEST_F(ChunkEncoderTest, ReencodeIndexedChunk) {
+  auto types = _table->column_data_types();
+  auto chunk = _table->get_chunk(ChunkID{1u});
+
+  ChunkEncoder::encode_chunk(chunk, types, SegmentEncodingSpec{EncodingType::Dictionary});
+  chunk->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0u}});
+  chunk->create_index<CompositeGroupKeyIndex>(std::vector<ColumnID>{ColumnID{0u}, ColumnID{2u}});
+
+  // Indexed segments (also those that are not the first segment of a composite index) are kept, so that the indexes
+  // can still be found
+  ChunkEncoder::encode_chunk(chunk, types, SegmentEncodingSpec{EncodingType::RunLength});
+  verify_encoding(chunk, {{EncodingType::Dictionary}, {EncodingType::RunLength}, {EncodingType::Dictionary}});
+
+  const auto group_key_index = chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0u}});
+  ASSERT_TRUE(group_key_index);
+  EXPECT_EQ(std::distance(group_key_index->lower_bound({7}), group_key_index->upper_bound({7})), 1);
+  EXPECT_TRUE(chunk->get_index(SegmentIndexType::CompositeGroupKey,
+                               std::vector<ColumnID>{ColumnID{0u}, ColumnID{2u}}));
+}
+
 }  // namespace opossum
@@ -0,0 +1,163 @@
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/decimal_scaled_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageDecimalScaledSegmentTest : public BaseTest {
+ protected:
+  // Two blocks and a bit more
+  static constexpr auto row_count = size_t{DecimalScaledSegment<double>::block_size * 2 + 100};
+
+  template <typename T>
+  std::shared_ptr<DecimalScaledSegment<T>> encode(
+      const std::vector<T>& values, const std::vector<bool>& null_values = {},
+      const VectorCompressionType vector_compression_type = VectorCompressionType::SimdBp128) {
+    auto value_segment = std::make_shared<ValueSegment<T>>(
+        pmr_concurrent_vector<T>{values.cbegin(), values.cend()},
+        null_values.empty() ? pmr_concurrent_vector<bool>(values.size())
+                            : pmr_concurrent_vector<bool>{null_values.cbegin(), null_values.cend()});
+    const auto encoded_segment = encode_segment(EncodingType::DecimalScaled, data_type_from_type<T>(), value_segment,
+                                                vector_compression_type);
+    return std::dynamic_pointer_cast<DecimalScaledSegment<T>>(encoded_segment);
+  }
+
+  // Compares bit by bit, so that NaN equals NaN and -0.0 does not equal 0.0
+  template <typename T>
+  static bool identical(const T lhs, const T rhs) {
+    if (std::isnan(lhs)) return std::isnan(rhs);
+    return lhs == rhs && std::signbit(lhs) == std::signbit(rhs);
+  }
+};
+
+TEST_F(StorageDecimalScaledSegmentTest, EncodeDecimals) {
+  // Sensor readings with two decimal places
+  auto values = std::vector<double>(row_count);
+  for (auto index = size_t{0}; index < row_count; ++index) {
+    values[index] = static_cast<double>(2'000 + (index * 37) % 500) / 100.0;
+  }
+
+  const auto segment = encode(values);
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->size(), row_count);
+  EXPECT_EQ(segment->block_exponents()[0], 2u);
+  EXPECT_TRUE(segment->exception_offsets().empty());
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    EXPECT_EQ(segment->get_typed_value(chunk_offset), values[chunk_offset]);
+  }
+
+  // The scaled values are below 500 and need nine bits instead of 64
+  EXPECT_LT(segment->estimate_memory_usage() * 5, row_count * sizeof(double));
+}
+
+TEST_F(StorageDecimalScaledSegmentTest, EncodeFloats) {
+  const auto values = std::vector<float>{21.5f, -3.25f, 0.1f, 1e-3f, 100.0f, 7.0f};
+  const auto segment = encode(values);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    EXPECT_EQ(segment->get_typed_value(chunk_offset), values[chunk_offset]);
+  }
+  EXPECT_TRUE(segment->exception_offsets().empty());
+}
+
+TEST_F(StorageDecimalScaledSegmentTest, Exceptions) {
+  const auto values = std::vector<double>{1.5,
+                                          1.0 / 3.0,
+                                          std::numeric_limits<double>::quiet_NaN(),
+                                          std::numeric_limits<double>::infinity(),
+                                          -0.0,
+                                          1e300,
+                                          2.75,
+                                          0.0};
+  const auto null_values = std::vector<bool>{false, false, false, false, false, false, true, false};
+  const auto segment = encode(values, null_values);
+
+  EXPECT_EQ(segment->exception_offsets(), (pmr_vector<ChunkOffset>{1, 2, 3, 4, 5}));
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    const auto value = segment->get_typed_value(chunk_offset);
+    ASSERT_EQ(!value, null_values[chunk_offset]);
+    if (value) {
+      EXPECT_TRUE(identical(*value, values[chunk_offset])) << "at " << chunk_offset;
+    }
+  }
+
+  auto chunk_offset = ChunkOffset{0};
+  create_iterable_from_segment(*segment).for_each([&](const auto& position) {
+    EXPECT_EQ(position.is_null(), null_values[chunk_offset]);
+    if (!position.is_null()) {
+      EXPECT_TRUE(identical(position.value(), values[chunk_offset])) << "at " << chunk_offset;
+    }
+    ++chunk_offset;
+  });
+  EXPECT_EQ(chunk_offset, values.size());
+
+  const auto position_filter = std::make_shared<PosList>(PosList{
+      RowID{ChunkID{0}, ChunkOffset{5}}, RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{1}},
+      RowID{ChunkID{0}, ChunkOffset{6}}, RowID{ChunkID{0}, ChunkOffset{4}}});
+  position_filter->guarantee_single_chunk();
+
+  auto index = size_t{0};
+  create_iterable_from_segment(*segment).for_each(position_filter, [&](const auto& position) {
+    const auto referenced_offset = (*position_filter)[index].chunk_offset;
+    EXPECT_EQ(position.is_null(), null_values[referenced_offset]);
+    if (!position.is_null()) {
+      EXPECT_TRUE(identical(position.value(), values[referenced_offset])) << "at " << referenced_offset;
+    }
+    ++index;
+  });
+}
+
+TEST_F(StorageDecimalScaledSegmentTest, ExponentPerBlock) {
+  // The first block has integers, the second one has three decimal places, and the third one is not decimal at all
+  auto values = std::vector<double>(row_count);
+  for (auto index = size_t{0}; index < row_count; ++index) {
+    if (index < DecimalScaledSegment<double>::block_size) {
+      values[index] = static_cast<double>(index);
+    } else if (index < 2 * DecimalScaledSegment<double>::block_size) {
+      values[index] = static_cast<double>(index) / 1'000.0;
+    } else {
+      values[index] = std::sqrt(static_cast<double>(index));
+    }
+  }
+
+  const auto segment = encode(values, {}, VectorCompressionType::FixedSizeByteAligned);
+  EXPECT_EQ(segment->block_exponents()[0], 0u);
+  EXPECT_EQ(segment->block_exponents()[1], 3u);
+  // All square roots in the third block are exceptions, except for the one of 2116 = 46 * 46
+  EXPECT_EQ(segment->exception_offsets().size(), 99u);
+
+  create_iterable_from_segment<double, false>(*segment).with_iterators([&](auto begin, auto end) {
+    auto chunk_offset = row_count - 1;
+    auto it = begin + (row_count - 1);
+    EXPECT_EQ(std::next(it), end);
+    for (; it != begin; --it, --chunk_offset) {
+      EXPECT_EQ(it->value(), values[chunk_offset]);
+    }
+    EXPECT_EQ(it->value(), values[0]);
+
+    EXPECT_EQ((begin + 2'100)->value(), values[2'100]);
+  });
+}
+
+TEST_F(StorageDecimalScaledSegmentTest, EncodeAndDecode) {
+  EXPECT_EQ(DecimalScaledSegment<double>::encode(4.99, 2), 499);
+  EXPECT_EQ(DecimalScaledSegment<double>::encode(4.99, 3), 4'990);
+  EXPECT_FALSE(DecimalScaledSegment<double>::encode(4.99, 1));
+  EXPECT_FALSE(DecimalScaledSegment<double>::encode(-0.0, 0));
+  EXPECT_FALSE(DecimalScaledSegment<double>::encode(1e20, 0));
+  EXPECT_EQ(DecimalScaledSegment<float>::encode(0.1f, 1), 1);
+  EXPECT_EQ(DecimalScaledSegment<double>::decode(-325, 2), -3.25);
+}
+
+}  // namespace opossum
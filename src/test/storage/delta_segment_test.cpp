@@ -0,0 +1,154 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/delta_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageDeltaSegmentTest : public BaseTest {
+ protected:
+  // Three blocks and a bit more
+  static constexpr auto row_count = size_t{DeltaSegment<int64_t>::block_size * 3 + 17};
+
+  void SetUp() override {
+    // Timestamps in milliseconds, roughly one per second
+    auto timestamp = int64_t{1'500'000'000'000};
+    for (auto index = size_t{0}; index < row_count; ++index) {
+      timestamp += 1'000 + static_cast<int64_t>(index % 7);
+      _timestamps.push_back(timestamp);
+    }
+  }
+
+  template <typename T>
+  std::shared_ptr<DeltaSegment<T>> encode(const std::shared_ptr<ValueSegment<T>>& value_segment,
+                                          const VectorCompressionType vector_compression_type) {
+    const auto encoded_segment = encode_segment(EncodingType::Delta, data_type_from_type<T>(), value_segment,
+                                                vector_compression_type);
+    return std::dynamic_pointer_cast<DeltaSegment<T>>(encoded_segment);
+  }
+
+  std::vector<int64_t> _timestamps;
+};
+
+TEST_F(StorageDeltaSegmentTest, EncodeMonotonicSequence) {
+  auto value_segment =
+      std::make_shared<ValueSegment<int64_t>>(pmr_concurrent_vector<int64_t>{_timestamps.cbegin(), _timestamps.cend()});
+  const auto delta_segment = encode(value_segment, VectorCompressionType::SimdBp128);
+  ASSERT_TRUE(delta_segment);
+
+  EXPECT_EQ(delta_segment->size(), row_count);
+  EXPECT_EQ(delta_segment->block_bases().size(), 4u);
+  EXPECT_EQ(delta_segment->block_minimum_deltas()[0], 1'000);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    EXPECT_EQ(delta_segment->get_typed_value(chunk_offset), _timestamps[chunk_offset]);
+  }
+
+  // The offsets of the deltas only need three bits, whereas frame-of-reference encoding needs to store the offsets
+  // from the block minimum (up to 2048 seconds)
+  const auto frame_of_reference_segment =
+      encode_segment(EncodingType::FrameOfReference, DataType::Long, value_segment, VectorCompressionType::SimdBp128);
+  EXPECT_LT(delta_segment->estimate_memory_usage() * 2, frame_of_reference_segment->estimate_memory_usage());
+  EXPECT_LT(delta_segment->estimate_memory_usage() * 4, row_count * sizeof(int64_t));
+}
+
+TEST_F(StorageDeltaSegmentTest, IterateNullableSegment) {
+  auto null_values = pmr_concurrent_vector<bool>(row_count);
+  for (auto index = size_t{0}; index < row_count; index += 5) null_values[index] = true;
+
+  auto value_segment = std::make_shared<ValueSegment<int64_t>>(
+      pmr_concurrent_vector<int64_t>{_timestamps.cbegin(), _timestamps.cend()}, std::move(null_values));
+  const auto delta_segment = encode(value_segment, VectorCompressionType::FixedSizeByteAligned);
+
+  auto iterable = create_iterable_from_segment(*delta_segment);
+
+  auto chunk_offset = ChunkOffset{0};
+  iterable.for_each([&](const auto& position) {
+    EXPECT_EQ(position.is_null(), chunk_offset % 5 == 0);
+    if (!position.is_null()) {
+      EXPECT_EQ(position.value(), _timestamps[chunk_offset]);
+    }
+    EXPECT_EQ(position.chunk_offset(), chunk_offset);
+    ++chunk_offset;
+  });
+  EXPECT_EQ(chunk_offset, row_count);
+
+  // Point accesses across blocks, including the first and last position of a block
+  const auto position_filter = std::make_shared<PosList>(PosList{
+      RowID{ChunkID{0}, ChunkOffset{400}}, RowID{ChunkID{0}, ChunkOffset{127}}, RowID{ChunkID{0}, ChunkOffset{128}},
+      RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{0}, ChunkOffset{5}}});
+  position_filter->guarantee_single_chunk();
+
+  auto index = size_t{0};
+  iterable.for_each(position_filter, [&](const auto& position) {
+    const auto referenced_offset = (*position_filter)[index].chunk_offset;
+    EXPECT_EQ(position.is_null(), referenced_offset % 5 == 0);
+    if (!position.is_null()) {
+      EXPECT_EQ(position.value(), _timestamps[referenced_offset]);
+    }
+    ++index;
+  });
+  EXPECT_EQ(index, position_filter->size());
+}
+
+TEST_F(StorageDeltaSegmentTest, DecrementIterator) {
+  auto value_segment =
+      std::make_shared<ValueSegment<int64_t>>(pmr_concurrent_vector<int64_t>{_timestamps.cbegin(), _timestamps.cend()});
+  const auto delta_segment = encode(value_segment, VectorCompressionType::SimdBp128);
+
+  create_iterable_from_segment<int64_t, false>(*delta_segment).with_iterators([&](auto begin, auto end) {
+    // Walk backwards from the last position, which crosses the boundaries of the blocks
+    auto chunk_offset = row_count - 1;
+    auto it = begin + (row_count - 1);
+    EXPECT_EQ(std::next(it), end);
+    for (; it != begin; --it, --chunk_offset) {
+      EXPECT_EQ(it->value(), _timestamps[chunk_offset]);
+    }
+    EXPECT_EQ(it->value(), _timestamps[0]);
+
+    EXPECT_EQ((begin + 300)->value(), _timestamps[300]);
+  });
+}
+
+TEST_F(StorageDeltaSegmentTest, NonMonotonicAndExtremeValues) {
+  // Deltas may be negative and may wrap around
+  const auto values = std::vector<int32_t>{5,
+                                           -3,
+                                           std::numeric_limits<int32_t>::max(),
+                                           std::numeric_limits<int32_t>::min(),
+                                           0,
+                                           std::numeric_limits<int32_t>::max() - 1,
+                                           42};
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>(pmr_concurrent_vector<int32_t>{values.cbegin(),
+                                                                                               values.cend()});
+  const auto delta_segment = encode(value_segment, VectorCompressionType::FixedSizeByteAligned);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    EXPECT_EQ(delta_segment->get_typed_value(chunk_offset), values[chunk_offset]);
+  }
+}
+
+TEST_F(StorageDeltaSegmentTest, LeadingNulls) {
+  // Leading NULLs take the first value, so that the first delta is not huge
+  auto value_segment = std::make_shared<ValueSegment<int64_t>>(true);
+  value_segment->append(NULL_VALUE);
+  value_segment->append(NULL_VALUE);
+  value_segment->append(int64_t{1'500'000'000'000});
+  value_segment->append(int64_t{1'500'000'001'000});
+
+  const auto delta_segment = encode(value_segment, VectorCompressionType::FixedSizeByteAligned);
+  EXPECT_EQ(delta_segment->block_minimum_deltas()[0], 0);
+  EXPECT_FALSE(delta_segment->get_typed_value(ChunkOffset{0}));
+  EXPECT_FALSE(delta_segment->get_typed_value(ChunkOffset{1}));
+  EXPECT_EQ(delta_segment->get_typed_value(ChunkOffset{3}), 1'500'000'001'000);
+}
+
+}  // namespace opossum
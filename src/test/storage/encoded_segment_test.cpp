@@ -35,6 +35,8 @@ class EncodedSegmentTest : public BaseTestWithParam<SegmentEncodingSpec> {
       case EncodingType::FrameOfReference:
         // fill three blocks and a bit more
         return static_cast<size_t>(FrameOfReferenceSegment<int32_t>::block_size * (3.3));
+      case EncodingType::Delta:
+        return static_cast<size_t>(DeltaSegment<int32_t>::block_size * (3.3));
       default:
         return default_row_count;
     }
@@ -125,6 +127,8 @@ INSTANTIATE_TEST_CASE_P(
                       SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned},
                       SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::SimdBp128},
                       SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::FixedSizeByteAligned},
+                      SegmentEncodingSpec{EncodingType::Delta, VectorCompressionType::SimdBp128},
+                      SegmentEncodingSpec{EncodingType::Delta, VectorCompressionType::FixedSizeByteAligned},
                       SegmentEncodingSpec{EncodingType::RunLength},
                       SegmentEncodingSpec{EncodingType::LZ4, VectorCompressionType::SimdBp128},
                       SegmentEncodingSpec{EncodingType::LZ4, VectorCompressionType::FixedSizeByteAligned}),
@@ -0,0 +1,196 @@
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+using namespace opossum::expression_functional;  // NOLINT
+
+class EncodingAdvisorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 10 distinct values in random order, so that run-length encoding does not pay off
+    auto generator = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<int32_t>{0, 9};
+
+    auto values = std::vector<int32_t>(10'000);
+    for (auto& value : values) value = distribution(generator);
+    _random_segment = std::make_shared<ValueSegment<int32_t>>(std::move(values));
+
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 5'000,
+                                     UseMvcc::Yes);
+    for (auto row_id = size_t{0}; row_id < 10'000; ++row_id) {
+      _table->append({static_cast<int32_t>(row_id % 10)});
+    }
+  }
+
+  void TearDown() override { SegmentAccessCounter::set_enabled(false); }
+
+  std::shared_ptr<ValueSegment<int32_t>> _random_segment;
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(EncodingAdvisorTest, AnalyzeSegment) {
+  const auto segment = ValueSegment<int32_t>{std::vector<int32_t>{1, 1, 2, 3, 3, 3, 0},
+                                             std::vector<bool>{false, false, false, false, false, false, true}};
+
+  const auto characteristics = EncodingAdvisor::analyze_segment(segment, DataType::Int);
+  EXPECT_EQ(characteristics.row_count, 7u);
+  EXPECT_EQ(characteristics.null_count, 1u);
+  EXPECT_EQ(characteristics.distinct_count, 3u);
+  EXPECT_EQ(characteristics.run_count, 4u);
+  EXPECT_TRUE(characteristics.is_sorted);
+  EXPECT_EQ(characteristics.value_range, 2u);
+  EXPECT_GT(characteristics.entropy, 1.0);
+  EXPECT_LT(characteristics.entropy, 2.0);
+
+  const auto string_segment = ValueSegment<pmr_string>{std::vector<pmr_string>{"bb", "a", "dddd"}};
+  const auto string_characteristics = EncodingAdvisor::analyze_segment(string_segment, DataType::String);
+  EXPECT_FALSE(string_characteristics.is_sorted);
+  EXPECT_FALSE(string_characteristics.value_range);
+  EXPECT_EQ(string_characteristics.average_string_length, 2u);
+  EXPECT_EQ(string_characteristics.max_string_length, 4u);
+}
+
+TEST_F(EncodingAdvisorTest, CandidateEncodings) {
+  // Unencoded, Dictionary (2x), RunLength, FrameOfReference (2x), Delta (2x), LZ4
+  EXPECT_EQ(EncodingAdvisor::candidate_encodings(DataType::Int).size(), 9u);
+  // Unencoded, Dictionary (2x), RunLength, FixedStringDictionary (2x), LZ4
+  EXPECT_EQ(EncodingAdvisor::candidate_encodings(DataType::String).size(), 7u);
+  // Unencoded, Dictionary (2x), RunLength, DecimalScaled (2x), LZ4
+  EXPECT_EQ(EncodingAdvisor::candidate_encodings(DataType::Float).size(), 7u);
+}
+
+TEST_F(EncodingAdvisorTest, EstimateMemoryUsage) {
+  const auto characteristics = EncodingAdvisor::analyze_segment(*_random_segment, DataType::Int);
+  const auto estimate = [&](const SegmentEncodingSpec& spec) {
+    return EncodingAdvisor::estimate_memory_usage(spec, DataType::Int, characteristics);
+  };
+
+  EXPECT_EQ(estimate({EncodingType::Unencoded}), 40'000u);
+  EXPECT_LT(estimate({EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned}), 11'000u);
+  EXPECT_LT(estimate({EncodingType::Dictionary, VectorCompressionType::SimdBp128}),
+            estimate({EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned}));
+  EXPECT_GT(estimate({EncodingType::RunLength}), estimate({EncodingType::Unencoded}));
+}
+
+TEST_F(EncodingAdvisorTest, RecommendationDependsOnAccesses) {
+  const auto advisor = EncodingAdvisor{};
+
+  // Segments that are not accessed are compressed as much as possible
+  auto access_counter = SegmentAccessCounter{};
+  const auto cold_spec = advisor.recommend_segment_encoding(*_random_segment, DataType::Int, access_counter);
+  EXPECT_EQ(cold_spec.encoding_type, EncodingType::LZ4);
+
+  // Segments that are accessed randomly need an encoding that supports fast point accesses
+  access_counter.increase(SegmentAccessType::PointAccess, 1'000'000);
+  const auto hot_spec = advisor.recommend_segment_encoding(*_random_segment, DataType::Int, access_counter);
+  EXPECT_EQ(hot_spec.encoding_type, EncodingType::Dictionary);
+  EXPECT_EQ(hot_spec.vector_compression_type, VectorCompressionType::FixedSizeByteAligned);
+
+  // Without any weight on memory, the segment is left unencoded
+  const auto memory_agnostic_advisor = EncodingAdvisor{EncodingAdvisor::Config{0.0, 1.0}};
+  const auto unencoded_spec =
+      memory_agnostic_advisor.recommend_segment_encoding(*_random_segment, DataType::Int, access_counter);
+  EXPECT_EQ(unencoded_spec.encoding_type, EncodingType::Unencoded);
+}
+
+TEST_F(EncodingAdvisorTest, WideLongRange) {
+  // Sorted values with gaps of up to 2^40. Neither the values nor their deltas fit into the uint32_t offsets of
+  // frame-of-reference and delta encoding, which would otherwise be cheap for scanned, sorted segments.
+  auto generator = std::mt19937_64{42};
+  auto distribution = std::uniform_int_distribution<int64_t>{0, int64_t{1} << 40};
+
+  auto values = std::vector<int64_t>(10'000);
+  auto value = int64_t{0};
+  for (auto& element : values) {
+    value += distribution(generator);
+    element = value;
+  }
+  const auto segment = std::make_shared<ValueSegment<int64_t>>(std::move(values));
+
+  const auto characteristics = EncodingAdvisor::analyze_segment(*segment, DataType::Long);
+  EXPECT_GT(characteristics.value_range, std::numeric_limits<uint32_t>::max());
+  EXPECT_GT(characteristics.delta_range, std::numeric_limits<uint32_t>::max());
+
+  const auto advisor = EncodingAdvisor{};
+  for (const auto access_type :
+       {SegmentAccessType::Scan, SegmentAccessType::PointAccess, SegmentAccessType::Materialization}) {
+    auto access_counter = SegmentAccessCounter{};
+    access_counter.increase(access_type, 1'000'000);
+
+    const auto spec = advisor.recommend_segment_encoding(*segment, DataType::Long, access_counter);
+    EXPECT_NE(spec.encoding_type, EncodingType::FrameOfReference);
+    EXPECT_NE(spec.encoding_type, EncodingType::Delta);
+
+    const auto chunk = std::make_shared<Chunk>(Segments{segment});
+    EXPECT_NO_THROW(ChunkEncoder::encode_chunk(chunk, {DataType::Long}, spec));
+  }
+}
+
+TEST_F(EncodingAdvisorTest, RecordAccesses) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto& access_counter = _table->get_chunk(ChunkID{0})->access_counter(ColumnID{0});
+
+  // Accesses are not recorded by default
+  std::make_shared<TableScan>(table_wrapper, greater_than_(column_a, 4))->execute();
+  EXPECT_EQ(access_counter.row_count(SegmentAccessType::Scan), 0u);
+
+  SegmentAccessCounter::set_enabled(true);
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_(column_a, 4));
+  table_scan->execute();
+  EXPECT_EQ(access_counter.row_count(SegmentAccessType::Scan), 5'000u);
+  EXPECT_EQ(access_counter.row_count(SegmentAccessType::PointAccess), 0u);
+
+  // Accesses through the ReferenceSegments of the scan result are point accesses to the data segments
+  const auto sort = std::make_shared<Sort>(table_scan, ColumnID{0});
+  sort->execute();
+  EXPECT_EQ(access_counter.row_count(SegmentAccessType::PointAccess), 2'500u);
+  EXPECT_EQ(access_counter.row_count(SegmentAccessType::Materialization), 0u);
+}
+
+TEST_F(EncodingAdvisorTest, ScheduleReencoding) {
+  ChunkEncoder::encode_all_chunks(_table, EncodingType::Unencoded);
+  StorageManager::get().add_table("table_a", _table);
+
+  const auto advisor = EncodingAdvisor{};
+  const auto tasks = advisor.schedule_reencoding("table_a");
+  EXPECT_EQ(tasks.size(), 2u);
+  CurrentScheduler::wait_for_tasks(tasks);
+
+  auto segments = std::vector<std::shared_ptr<BaseSegment>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto segment = _table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    EXPECT_TRUE(std::dynamic_pointer_cast<const BaseEncodedSegment>(segment));
+    segments.emplace_back(segment);
+  }
+
+  // The encodings are now as recommended, so the segments are not replaced again
+  CurrentScheduler::wait_for_tasks(advisor.schedule_reencoding("table_a"));
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(_table->get_chunk(chunk_id)->get_segment(ColumnID{0}), segments[chunk_id]);
+  }
+}
+
+}  // namespace opossum
@@ -33,6 +33,8 @@ class EncodingTest : public ::testing::TestWithParam<SegmentEncodingSpec> {
 
 const SegmentEncodingSpec all_segment_encoding_specs[]{
     {EncodingType::Unencoded},
+    {EncodingType::DecimalScaled},
+    {EncodingType::Delta},
     {EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned},
     {EncodingType::Dictionary, VectorCompressionType::SimdBp128},
     {EncodingType::FrameOfReference},
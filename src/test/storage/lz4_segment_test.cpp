@@ -8,6 +8,7 @@
 #include "storage/chunk_encoder.hpp"
 #include "storage/lz4/lz4_encoder.hpp"
 #include "storage/lz4_segment.hpp"
+#include "storage/segment_accessor.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/value_segment.hpp"
 
@@ -246,4 +247,78 @@ TEST_F(StorageLZ4SegmentTest, CompressMultiBlockStringSegment) {
   EXPECT_EQ(result.second, 2u);
 }
 
+TEST_F(StorageLZ4SegmentTest, DecompressUnorderedPositions) {
+  // Four blocks of integers
+  auto values = pmr_concurrent_vector<int32_t>(LZ4Encoder::_block_size);
+  for (auto index = size_t{0u}; index < values.size(); ++index) {
+    values[index] = static_cast<int32_t>(index * 7 % 1000);
+  }
+  auto lz4_segment =
+      compress(std::make_shared<ValueSegment<int32_t>>(pmr_concurrent_vector<int32_t>(values)), DataType::Int);
+
+  // Alternate between the first and the last block, as the output of a hash join would
+  auto position_filter = PosList{};
+  for (auto index = ChunkOffset{0u}; index < 1000u; ++index) {
+    position_filter.emplace_back(RowID{ChunkID{0u}, index});
+    position_filter.emplace_back(RowID{ChunkID{0u}, static_cast<ChunkOffset>(values.size() - 1 - index)});
+  }
+
+  const auto decompressed_values = lz4_segment->decompress(position_filter);
+  ASSERT_EQ(decompressed_values.size(), position_filter.size());
+  for (auto index = size_t{0u}; index < position_filter.size(); ++index) {
+    EXPECT_EQ(decompressed_values[index], values[position_filter[index].chunk_offset]);
+  }
+
+  EXPECT_TRUE(lz4_segment->decompress(PosList{}).empty());
+}
+
+TEST_F(StorageLZ4SegmentTest, DecompressUnorderedStringPositions) {
+  const auto block_size = LZ4Encoder::_block_size;
+
+  // The second string spans three blocks
+  const auto string1 = pmr_string(block_size - 1000u, 'a');
+  const auto string2 = pmr_string(block_size + 2000u, 'b');
+  const auto string3 = pmr_string(1000u, 'c');
+  vs_str->append(string1);
+  vs_str->append(string2);
+  vs_str->append(string3);
+  vs_str->append(NULL_VALUE);
+  auto lz4_segment = compress(vs_str, DataType::String);
+
+  const auto position_filter = PosList{RowID{ChunkID{0u}, ChunkOffset{2u}}, RowID{ChunkID{0u}, ChunkOffset{0u}},
+                                       RowID{ChunkID{0u}, ChunkOffset{1u}}, RowID{ChunkID{0u}, ChunkOffset{2u}},
+                                       RowID{ChunkID{0u}, ChunkOffset{0u}}, RowID{ChunkID{0u}, ChunkOffset{3u}}};
+  const auto decompressed_values = lz4_segment->decompress(position_filter);
+  EXPECT_EQ(decompressed_values,
+            (std::vector<pmr_string>{string3, string1, string2, string3, string1, pmr_string{""}}));
+
+  // Segments that only contain empty strings have no blocks
+  auto empty_strings = std::make_shared<ValueSegment<pmr_string>>(pmr_concurrent_vector<pmr_string>{"", ""});
+  EXPECT_EQ(compress(empty_strings, DataType::String)->decompress(position_filter).size(), position_filter.size());
+}
+
+TEST_F(StorageLZ4SegmentTest, SegmentAccessor) {
+  auto values = pmr_concurrent_vector<int32_t>(row_count);
+  auto null_values = pmr_concurrent_vector<bool>(row_count);
+  for (auto index = size_t{0u}; index < row_count; ++index) {
+    values[index] = static_cast<int32_t>(index);
+    null_values[index] = index % 10 == 0;
+  }
+  auto lz4_segment = compress(std::make_shared<ValueSegment<int32_t>>(pmr_concurrent_vector<int32_t>(values),
+                                                                     std::move(null_values)),
+                              DataType::Int);
+
+  const auto accessor = create_segment_accessor<int32_t>(lz4_segment);
+  for (const auto chunk_offset : {ChunkOffset{1u}, ChunkOffset{row_count - 1}, ChunkOffset{2u}, ChunkOffset{10u},
+                                  ChunkOffset{row_count - 2}, ChunkOffset{row_count - 2}}) {
+    const auto value = accessor->access(chunk_offset);
+    if (chunk_offset % 10 == 0) {
+      EXPECT_FALSE(value);
+    } else {
+      ASSERT_TRUE(value);
+      EXPECT_EQ(*value, static_cast<int32_t>(chunk_offset));
+    }
+  }
+}
+
 }  // namespace opossum
@@ -1,4 +1,5 @@
 #include <memory>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -128,4 +129,83 @@ TEST_F(SegmentAccessorTest, TestSingleChunkReferenceSegmentAccessorNull) {
   EXPECT_FALSE(rc_single_chunk_accessor->access(ChunkOffset{0}));
 }
 
+TEST_F(SegmentAccessorTest, TestBatchedAccess) {
+  const auto chunk_offsets = std::vector<ChunkOffset>{ChunkOffset{2}, ChunkOffset{3}, ChunkOffset{0}};
+
+  for (const auto& segment : std::vector<std::shared_ptr<BaseSegment>>{vc_int, dc_int}) {
+    auto values = std::vector<int32_t>(3);
+    bool null_values[3];
+    create_segment_accessor<int32_t>(segment)->access(chunk_offsets.data(), 3, values.data(), null_values);
+    EXPECT_EQ(values[0], 3);
+    EXPECT_EQ(values[2], 4);
+    EXPECT_FALSE(null_values[0]);
+    EXPECT_TRUE(null_values[1]);
+    EXPECT_FALSE(null_values[2]);
+  }
+
+  auto values = std::vector<pmr_string>(3);
+  bool null_values[3];
+  create_segment_accessor<pmr_string>(rc_str)->access(chunk_offsets.data(), 3, values.data(), null_values);
+  EXPECT_EQ(values[0], "Hello,");
+  EXPECT_EQ(values[2], "world");
+  EXPECT_FALSE(null_values[0]);
+  EXPECT_TRUE(null_values[1]);
+  EXPECT_FALSE(null_values[2]);
+}
+
+TEST_F(SegmentAccessorTest, TestBatchedAccessDictionarySegmentManyValues) {
+  // Enough offsets for the accessor to decompress the attribute vector with a typed decompressor
+  auto chunk_offsets = std::vector<ChunkOffset>(40);
+  for (auto index = size_t{0}; index < chunk_offsets.size(); ++index) {
+    chunk_offsets[index] = static_cast<ChunkOffset>((index * 3) % 4);
+  }
+
+  auto values = std::vector<pmr_string>(chunk_offsets.size());
+  auto null_values = std::make_unique<bool[]>(chunk_offsets.size());
+  create_segment_accessor<pmr_string>(dc_str)->access(chunk_offsets.data(), chunk_offsets.size(), values.data(),
+                                                      null_values.get());
+
+  const auto expected_values = std::vector<pmr_string>{"Hello,", "world", "!"};
+  for (auto index = size_t{0}; index < chunk_offsets.size(); ++index) {
+    if (chunk_offsets[index] == 3) {
+      EXPECT_TRUE(null_values[index]);
+    } else {
+      EXPECT_FALSE(null_values[index]);
+      EXPECT_EQ(values[index], expected_values[chunk_offsets[index]]);
+    }
+  }
+}
+
+TEST_F(SegmentAccessorTest, TestBatchedAccessMultipleChunks) {
+  tbl->append_chunk(std::make_shared<Chunk>(Segments{{dc_int, vc_str}}));
+
+  const auto row_ids = std::vector<RowID>{RowID{ChunkID{1}, ChunkOffset{0}}, RowID{ChunkID{1}, ChunkOffset{3}},
+                                          NULL_ROW_ID, RowID{ChunkID{0}, ChunkOffset{1}},
+                                          RowID{ChunkID{1}, ChunkOffset{2}}};
+  const auto expected_values = std::vector<int32_t>{4, 0, 0, 6, 3};
+  const auto expected_null_values = std::vector<bool>{false, true, true, false, false};
+
+  auto accessors = std::vector<std::unique_ptr<AbstractSegmentAccessor<int32_t>>>(tbl->chunk_count());
+  auto values = std::vector<int32_t>(row_ids.size());
+  bool null_values[5];
+  access_row_ids(*tbl, ColumnID{0}, row_ids.cbegin(), row_ids.cend(), accessors, values.data(), null_values);
+
+  for (auto index = size_t{0}; index < row_ids.size(); ++index) {
+    EXPECT_EQ(null_values[index], expected_null_values[index]);
+    if (!null_values[index]) EXPECT_EQ(values[index], expected_values[index]);
+  }
+
+  // The same through a ReferenceSegment that references both chunks
+  const auto reference_segment =
+      std::make_shared<ReferenceSegment>(tbl, ColumnID{0}, std::make_shared<PosList>(row_ids.cbegin(), row_ids.cend()));
+  const auto chunk_offsets = std::vector<ChunkOffset>{ChunkOffset{0}, ChunkOffset{1}, ChunkOffset{2}, ChunkOffset{3},
+                                                      ChunkOffset{4}};
+  create_segment_accessor<int32_t>(reference_segment)->access(chunk_offsets.data(), 5, values.data(), null_values);
+
+  for (auto index = size_t{0}; index < row_ids.size(); ++index) {
+    EXPECT_EQ(null_values[index], expected_null_values[index]);
+    if (!null_values[index]) EXPECT_EQ(values[index], expected_values[index]);
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,69 @@
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/selection_bitmap.hpp"
+
+namespace opossum {
+
+class SelectionBitmapTest : public BaseTest {};
+
+TEST_F(SelectionBitmapTest, SetAndCount) {
+  auto bitmap = SelectionBitmap{ChunkOffset{130}};
+  EXPECT_EQ(bitmap.size(), 130u);
+  EXPECT_TRUE(bitmap.empty());
+
+  bitmap.set(ChunkOffset{0});
+  bitmap.set(ChunkOffset{64});
+  bitmap.set(ChunkOffset{129});
+  bitmap.set(ChunkOffset{64});
+
+  EXPECT_FALSE(bitmap.empty());
+  EXPECT_EQ(bitmap.count(), 3u);
+  EXPECT_TRUE(bitmap.is_set(ChunkOffset{0}));
+  EXPECT_FALSE(bitmap.is_set(ChunkOffset{1}));
+  EXPECT_TRUE(bitmap.is_set(ChunkOffset{64}));
+  EXPECT_TRUE(bitmap.is_set(ChunkOffset{129}));
+}
+
+TEST_F(SelectionBitmapTest, ShrinkClearsTrailingBits) {
+  auto bitmap = SelectionBitmap{ChunkOffset{10}};
+  bitmap.set(ChunkOffset{8});
+  bitmap.resize(ChunkOffset{5});
+  bitmap.resize(ChunkOffset{10});
+  EXPECT_FALSE(bitmap.is_set(ChunkOffset{8}));
+  EXPECT_EQ(bitmap.count(), 0u);
+}
+
+TEST_F(SelectionBitmapTest, UnionAndIntersection) {
+  auto left = SelectionBitmap{ChunkOffset{100}};
+  auto right = SelectionBitmap{ChunkOffset{100}};
+  left.set(ChunkOffset{3});
+  left.set(ChunkOffset{70});
+  right.set(ChunkOffset{70});
+  right.set(ChunkOffset{99});
+
+  auto union_bitmap = left;
+  union_bitmap |= right;
+  EXPECT_EQ(union_bitmap.count(), 3u);
+
+  auto intersection_bitmap = left;
+  intersection_bitmap &= right;
+  EXPECT_EQ(intersection_bitmap.count(), 1u);
+  EXPECT_TRUE(intersection_bitmap.is_set(ChunkOffset{70}));
+}
+
+TEST_F(SelectionBitmapTest, AppendToPosList) {
+  auto bitmap = SelectionBitmap{ChunkOffset{200}};
+  bitmap.set(ChunkOffset{150});
+  bitmap.set(ChunkOffset{2});
+  bitmap.set(ChunkOffset{63});
+
+  auto pos_list = PosList{RowID{ChunkID{0}, ChunkOffset{1}}};
+  bitmap.append_to_pos_list(ChunkID{4}, pos_list);
+
+  const auto expected_pos_list = PosList{RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{4}, ChunkOffset{2}},
+                                         RowID{ChunkID{4}, ChunkOffset{63}}, RowID{ChunkID{4}, ChunkOffset{150}}};
+  EXPECT_EQ(pos_list, expected_pos_list);
+}
+
+}  // namespace opossum
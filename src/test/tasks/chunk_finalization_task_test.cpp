@@ -0,0 +1,141 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/value_segment.hpp"
+#include "tasks/chunk_finalization_task.hpp"
+
+namespace opossum {
+
+class ChunkFinalizationTaskTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 4u, UseMvcc::Yes);
+    _table->set_finalization_encoding_spec(SegmentEncodingSpec{EncodingType::Dictionary});
+    _table->create_index<GroupKeyIndex>({ColumnID{0}});
+    StorageManager::get().add_table("table_a", _table);
+
+    // 10 rows
+    StorageManager::get().add_table("table_b", load_table("resources/test_data/tbl/10_ints.tbl"));
+    _get_table = std::make_shared<GetTable>("table_b");
+    _get_table->execute();
+  }
+
+  std::shared_ptr<TransactionContext> _insert(const std::shared_ptr<const AbstractOperator>& values_to_insert) {
+    const auto insert = std::make_shared<Insert>("table_a", values_to_insert);
+    auto context = TransactionManager::get().new_transaction_context();
+    insert->set_transaction_context(context);
+    insert->execute();
+    return context;
+  }
+
+  bool _is_finalized(const ChunkID chunk_id) const {
+    const auto chunk = _table->get_chunk(chunk_id);
+    return !chunk->is_mutable() &&
+           std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(ColumnID{0})) &&
+           chunk->statistics() && chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}});
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<GetTable> _get_table;
+};
+
+TEST_F(ChunkFinalizationTaskTest, FinalizeFullChunksOnCommit) {
+  _insert(_get_table)->commit();
+
+  ASSERT_EQ(_table->chunk_count(), 3u);
+  EXPECT_TRUE(_is_finalized(ChunkID{0}));
+  EXPECT_TRUE(_is_finalized(ChunkID{1}));
+
+  // The last chunk is not full and remains mutable
+  EXPECT_TRUE(_table->get_chunk(ChunkID{2})->is_mutable());
+  EXPECT_TRUE(std::dynamic_pointer_cast<const ValueSegment<int32_t>>(
+      _table->get_chunk(ChunkID{2})->get_segment(ColumnID{0})));
+}
+
+TEST_F(ChunkFinalizationTaskTest, FinalizeFullChunksOnRollback) {
+  _insert(_get_table)->rollback();
+
+  ASSERT_EQ(_table->chunk_count(), 3u);
+  EXPECT_TRUE(_is_finalized(ChunkID{0}));
+  EXPECT_TRUE(_is_finalized(ChunkID{1}));
+}
+
+TEST_F(ChunkFinalizationTaskTest, WaitForPendingInserts) {
+  // Both inserts go to the third chunk, which is only complete once both of them have committed
+  auto first_context = _insert(_get_table);
+  auto second_context = _insert(_get_table);
+  ASSERT_EQ(_table->chunk_count(), 5u);
+
+  second_context->commit();
+  EXPECT_FALSE(_is_finalized(ChunkID{0}));
+  EXPECT_FALSE(_is_finalized(ChunkID{2}));
+  EXPECT_TRUE(_table->get_chunk(ChunkID{2})->is_mutable());
+  EXPECT_TRUE(_is_finalized(ChunkID{3}));
+  EXPECT_TRUE(_is_finalized(ChunkID{4}));
+
+  first_context->commit();
+  EXPECT_TRUE(_is_finalized(ChunkID{0}));
+  EXPECT_TRUE(_is_finalized(ChunkID{1}));
+  EXPECT_TRUE(_is_finalized(ChunkID{2}));
+}
+
+TEST_F(ChunkFinalizationTaskTest, DisabledFinalization) {
+  // Finalization is opt-in
+  const auto table = Table{TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 4u, UseMvcc::Yes};
+  EXPECT_FALSE(table.finalization_encoding_spec());
+
+  _table->set_finalization_encoding_spec(std::nullopt);
+  _insert(_get_table)->commit();
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_TRUE(_table->get_chunk(chunk_id)->is_mutable());
+  }
+}
+
+TEST_F(ChunkFinalizationTaskTest, ClusteringColumn) {
+  const auto ordered_by = std::make_pair(ColumnID{0}, OrderByMode::Ascending);
+  _table->set_clustering_column(ordered_by);
+  _insert(_get_table)->commit();
+
+  // The Insert sorted its rows, so that the finalized chunks are sorted
+  ASSERT_EQ(_table->chunk_count(), 3u);
+  EXPECT_EQ(_table->get_value<int32_t>(ColumnID{0}, 0u), 1);
+  EXPECT_EQ(_table->get_value<int32_t>(ColumnID{0}, 9u), 234);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->ordered_by(), ordered_by);
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->ordered_by(), ordered_by);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2})->ordered_by());
+}
+
+TEST_F(ChunkFinalizationTaskTest, ClusteringColumnWithInterleavedInserts) {
+  const auto ordered_by = std::make_pair(ColumnID{0}, OrderByMode::Ascending);
+  _table->set_clustering_column(ordered_by);
+  _insert(_get_table)->commit();
+  _insert(_get_table)->commit();
+
+  // The third chunk holds the largest values of the first and the smallest values of the second Insert
+  ASSERT_EQ(_table->chunk_count(), 5u);
+  EXPECT_TRUE(_is_finalized(ChunkID{2}));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2})->ordered_by());
+  EXPECT_EQ(_table->get_chunk(ChunkID{3})->ordered_by(), ordered_by);
+  EXPECT_EQ(_table->get_chunk(ChunkID{4})->ordered_by(), ordered_by);
+}
+
+TEST_F(ChunkFinalizationTaskTest, ChunkIsComplete) {
+  auto context = _insert(_get_table);
+  EXPECT_FALSE(ChunkFinalizationTask::chunk_is_complete(*_table->get_chunk(ChunkID{0}), 4u));
+
+  context->commit();
+  EXPECT_TRUE(ChunkFinalizationTask::chunk_is_complete(*_table->get_chunk(ChunkID{0}), 4u));
+  EXPECT_FALSE(ChunkFinalizationTask::chunk_is_complete(*_table->get_chunk(ChunkID{2}), 4u));
+}
+
+}  // namespace opossum
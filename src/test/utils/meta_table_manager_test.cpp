@@ -0,0 +1,113 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "logical_query_plan/meta_table_node.hpp"
+#include "operators/get_meta_table.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/meta_table_manager.hpp"
+
+namespace opossum {
+
+class MetaTableManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("int_float", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  }
+
+  static std::shared_ptr<const Table> _execute(const std::string& query) {
+    auto pipeline_statement = SQLPipelineBuilder{query}.create_pipeline_statement();
+    return pipeline_statement.get_result_table();
+  }
+};
+
+TEST_F(MetaTableManagerTest, TableNames) {
+  const auto& meta_table_manager = MetaTableManager::get();
+  EXPECT_EQ(meta_table_manager.table_names().size(), 6u);
+
+  for (const auto& name : meta_table_manager.table_names()) {
+    EXPECT_TRUE(MetaTableManager::is_meta_table_name(name));
+    EXPECT_TRUE(meta_table_manager.has_table(name));
+
+    const auto table = meta_table_manager.generate_table(name);
+    EXPECT_EQ(table->column_definitions(), meta_table_manager.column_definitions(name));
+  }
+
+  EXPECT_FALSE(meta_table_manager.has_table("int_float"));
+  EXPECT_FALSE(meta_table_manager.has_table("meta_unknown"));
+  EXPECT_THROW(meta_table_manager.generate_table("meta_unknown"), std::logic_error);
+}
+
+TEST_F(MetaTableManagerTest, TablesAndChunks) {
+  const auto tables = MetaTableManager::get().generate_table("meta_tables");
+  ASSERT_EQ(tables->row_count(), 1u);
+  EXPECT_EQ(tables->get_value<pmr_string>(ColumnID{0}, 0), "int_float");
+  EXPECT_EQ(tables->get_value<int32_t>(ColumnID{1}, 0), 2);
+  EXPECT_EQ(tables->get_value<int64_t>(ColumnID{2}, 0), 3);
+  EXPECT_EQ(tables->get_value<int32_t>(ColumnID{3}, 0), 2);
+
+  const auto chunks = MetaTableManager::get().generate_table("meta_chunks");
+  ASSERT_EQ(chunks->row_count(), 2u);
+  EXPECT_EQ(chunks->get_value<int64_t>(ColumnID{2}, 0) + chunks->get_value<int64_t>(ColumnID{2}, 1), 3);
+}
+
+TEST_F(MetaTableManagerTest, SegmentsReflectEncoding) {
+  const auto encoding_type = [&]() {
+    const auto segments = _execute("SELECT encoding_type FROM meta_segments WHERE chunk_id = 0 AND column_id = 0");
+    EXPECT_EQ(segments->row_count(), 1u);
+    return segments->get_value<pmr_string>(ColumnID{0}, 0);
+  };
+
+  EXPECT_EQ(encoding_type(), "Unencoded");
+
+  // The meta table is generated when the (cached) plan is executed, so the new encoding is visible
+  ChunkEncoder::encode_all_chunks(StorageManager::get().get_table("int_float"), EncodingType::Dictionary);
+  EXPECT_EQ(encoding_type(), "Dictionary");
+}
+
+TEST_F(MetaTableManagerTest, PlanCache) {
+  _execute("SELECT a FROM int_float WHERE a > 1000");
+
+  const auto plan_cache = _execute("SELECT * FROM meta_plan_cache");
+  ASSERT_GE(plan_cache->row_count(), 1u);
+
+  auto found_query = false;
+  for (auto row = size_t{0}; row < plan_cache->row_count(); ++row) {
+    if (plan_cache->get_value<pmr_string>(ColumnID{0}, row) == "SELECT a FROM int_float WHERE a > 1000") {
+      found_query = true;
+    }
+  }
+  EXPECT_TRUE(found_query);
+}
+
+TEST_F(MetaTableManagerTest, SQLTranslation) {
+  auto pipeline_statement = SQLPipelineBuilder{"SELECT table_name FROM meta_tables"}.create_pipeline_statement();
+  const auto lqp = pipeline_statement.get_unoptimized_logical_plan();
+
+  // Meta tables contain no invalidated rows and are not validated
+  ASSERT_TRUE(lqp->left_input());
+  EXPECT_EQ(lqp->left_input()->type, LQPNodeType::MetaTable);
+
+  const auto result = pipeline_statement.get_result_table();
+  ASSERT_EQ(result->row_count(), 1u);
+  EXPECT_EQ(result->get_value<pmr_string>(ColumnID{0}, 0), "int_float");
+}
+
+TEST_F(MetaTableManagerTest, GetMetaTableOperator) {
+  const auto get_meta_table = std::make_shared<GetMetaTable>("meta_tables");
+  EXPECT_EQ(get_meta_table->name(), "GetMetaTable");
+  get_meta_table->execute();
+  EXPECT_EQ(get_meta_table->get_output()->row_count(), 1u);
+
+  const auto copy = get_meta_table->deep_copy();
+  copy->execute();
+  EXPECT_EQ(copy->get_output()->row_count(), 1u);
+}
+
+}  // namespace opossum